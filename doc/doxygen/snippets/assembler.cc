@@ -47,6 +47,26 @@ void matrix() {
   //![matrix_usage]
 }
 
+void sparsity_pattern() {
+  //! [sparsity_usage]
+  // initialize triangular 2d mesh somehow
+  std::shared_ptr<mesh::Mesh> mesh;
+  assemble::UniformFEDofHandler dofh(mesh, {{base::RefEl::kPoint(), 1}});
+  uscalfe::LinearFELaplaceElementMatrix entity_matrix_provider;
+
+  // Symbolic phase, done once: pattern of the Galerkin matrix and scatter maps
+  const assemble::SparsityPattern pattern(0, dofh, dofh);
+  Eigen::SparseMatrix<double, Eigen::RowMajor> A{pattern.MakeMatrix<double>()};
+
+  for (int step = 0; step < 10; ++step) {
+    // Numeric phase, repeated: reset values and scatter element matrices
+    A.coeffs().setZero();
+    assemble::AssembleMatrixLocally(pattern, entity_matrix_provider, A);
+    // ... use A
+  }
+  //! [sparsity_usage]
+}
+
 void vector() {
   //![vector_usage]
   // initialize a 2d mesh somehow
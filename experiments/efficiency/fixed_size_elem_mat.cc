@@ -0,0 +1,91 @@
+/** @file fixed_size_elem_mat.cc
+ *  @brief Runtime comparison of element matrix computations with dynamic and
+ *  compile-time fixed matrix sizes for Lagrangian finite elements
+ */
+
+#include <boost/timer/timer.hpp>
+#include <iostream>
+
+#include "lf/mesh/hybrid2d/hybrid2d.h"
+#include "lf/mesh/utils/utils.h"
+#include "lf/uscalfe/uscalfe.h"
+
+// Compute all element matrices of a mesh `reps` times
+template <class PROVIDER>
+double EvalAll(const lf::mesh::Mesh &mesh, PROVIDER &provider, int reps) {
+  double s = 0.0;
+  for (int r = 0; r < reps; ++r) {
+    for (const lf::mesh::Entity *cell : mesh.Entities(0)) {
+      const auto elem_mat{provider.Eval(*cell)};
+      s += elem_mat(0, 0);
+    }
+  }
+  return s;
+}
+
+template <class FE_SPACE>
+void CompareProviders(const std::shared_ptr<lf::mesh::Mesh> &mesh_p,
+                      const char *name, int reps) {
+  auto fe_space = std::make_shared<FE_SPACE>(mesh_p);
+  auto alpha = lf::mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> double { return 1.0 + x[0] * x[1]; });
+  auto gamma = lf::mesh::utils::MeshFunctionConstant(1.0);
+  lf::uscalfe::ReactionDiffusionElementMatrixProvider dyn_builder(
+      fe_space, alpha, gamma);
+  lf::uscalfe::FixedSizeReactionDiffusionElementMatrixProvider fix_builder(
+      fe_space, alpha, gamma);
+
+  std::cout << name << ", dynamic size: ";
+  double s_dyn = 0.0;
+  {
+    boost::timer::auto_cpu_timer t;
+    s_dyn = EvalAll(*mesh_p, dyn_builder, reps);
+  }
+  std::cout << name << ", fixed size:   ";
+  double s_fix = 0.0;
+  {
+    boost::timer::auto_cpu_timer t;
+    s_fix = EvalAll(*mesh_p, fix_builder, reps);
+  }
+  std::cout << "  checksum difference = " << std::abs(s_dyn - s_fix)
+            << std::endl;
+}
+
+int main(int /*argc*/, const char * /*unused*/[]) {
+  const int N = 100;
+  const int reps = 5;
+  std::cout << "Runtime test for element matrix computations on " << N << "x"
+            << N << " tensor product meshes" << std::endl;
+
+  lf::mesh::hybrid2d::TPTriagMeshBuilder tria_builder(
+      std::make_unique<lf::mesh::hybrid2d::MeshFactory>(2));
+  tria_builder.setBottomLeftCorner(Eigen::Vector2d{0, 0})
+      .setTopRightCorner(Eigen::Vector2d{1, 1})
+      .setNumXCells(N)
+      .setNumYCells(N);
+  auto tria_mesh = tria_builder.Build();
+
+  lf::mesh::hybrid2d::TPQuadMeshBuilder quad_builder(
+      std::make_unique<lf::mesh::hybrid2d::MeshFactory>(2));
+  quad_builder.setBottomLeftCorner(Eigen::Vector2d{0, 0})
+      .setTopRightCorner(Eigen::Vector2d{1, 1})
+      .setNumXCells(N)
+      .setNumYCells(N);
+  auto quad_mesh = quad_builder.Build();
+
+  std::cout << "I. Triangles" << std::endl;
+  CompareProviders<lf::uscalfe::FeSpaceLagrangeO1<double>>(tria_mesh, "O1",
+                                                           reps);
+  CompareProviders<lf::uscalfe::FeSpaceLagrangeO2<double>>(tria_mesh, "O2",
+                                                           reps);
+  CompareProviders<lf::uscalfe::FeSpaceLagrangeO3<double>>(tria_mesh, "O3",
+                                                           reps);
+  std::cout << "II. Quadrilaterals" << std::endl;
+  CompareProviders<lf::uscalfe::FeSpaceLagrangeO1<double>>(quad_mesh, "O1",
+                                                           reps);
+  CompareProviders<lf::uscalfe::FeSpaceLagrangeO2<double>>(quad_mesh, "O2",
+                                                           reps);
+  CompareProviders<lf::uscalfe::FeSpaceLagrangeO3<double>>(quad_mesh, "O3",
+                                                           reps);
+  return 0;
+}
@@ -0,0 +1,107 @@
+/** @file simd_lin_fe.cc
+ *  @brief Runtime comparison of cell-by-cell and cross-cell SIMD computation
+ *  of element matrices for the Laplacian and linear finite elements
+ */
+
+#include <boost/timer/timer.hpp>
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "lf/mesh/hybrid2d/hybrid2d.h"
+#include "lf/mesh/utils/utils.h"
+#include "lf/uscalfe/uscalfe.h"
+
+int main(int /*argc*/, const char * /*unused*/[]) {
+  const int N = 400;
+  const int reps = 10;
+  std::cout << "Runtime test for P1 Laplace element matrices on a " << N << "x"
+            << N << " triangular tensor product mesh" << std::endl;
+  std::cout << "Widest SIMD level supported: " << lf::uscalfe::DetectSimdLevel()
+            << std::endl;
+
+  lf::mesh::hybrid2d::TPTriagMeshBuilder builder(
+      std::make_unique<lf::mesh::hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0, 0})
+      .setTopRightCorner(Eigen::Vector2d{1, 1})
+      .setNumXCells(N)
+      .setNumYCells(N);
+  auto mesh_p = builder.Build();
+  std::vector<const lf::mesh::Entity *> cells;
+  for (const lf::mesh::Entity *cell : mesh_p->Entities(0)) {
+    cells.push_back(cell);
+  }
+  const std::size_t n = cells.size();
+  lf::uscalfe::LinearFELaplaceElementMatrix provider;
+
+  // I. Existing provider, one cell at a time
+  double s_cell = 0.0;
+  std::cout << "Eval(), cell by cell:       ";
+  {
+    boost::timer::auto_cpu_timer t;
+    for (int r = 0; r < reps; ++r) {
+      for (const lf::mesh::Entity *cell : cells) {
+        s_cell += provider.Eval(*cell)(0, 1);
+      }
+    }
+  }
+  // II. Batched evaluation in blocks as used by AssembleMatrixLocally(),
+  // including the gathering of vertex coordinates
+  double s_batch = 0.0;
+  std::vector<lf::uscalfe::LinearFELaplaceElementMatrix::ElemMat> mats;
+  std::cout << "EvalBatch(), dispatched:    ";
+  {
+    boost::timer::auto_cpu_timer t;
+    for (int r = 0; r < reps; ++r) {
+      for (std::size_t first = 0; first < n;
+           first += lf::assemble::kEvalBatchSize) {
+        const std::size_t len =
+            std::min<std::size_t>(lf::assemble::kEvalBatchSize, n - first);
+        const lf::mesh::Entity *const *begin = cells.data() + first;
+        provider.EvalBatch(
+            nonstd::span<const lf::mesh::Entity *const>(begin, begin + len),
+            mats);
+        for (std::size_t k = 0; k < len; ++k) {
+          s_batch += mats[k](0, 1);
+        }
+      }
+    }
+  }
+  std::cout << "  checksum difference = " << std::abs(s_cell - s_batch)
+            << std::endl;
+
+  // III. Pure kernel on coordinates in structure-of-arrays layout
+  std::vector<double> xy(6 * n);
+  for (std::size_t k = 0; k < n; ++k) {
+    const Eigen::MatrixXd vertices{cells[k]->Geometry()->Global(
+        lf::base::RefEl::kTria().NodeCoords())};
+    for (int c = 0; c < 2; ++c) {
+      for (int v = 0; v < 3; ++v) {
+        xy[(3 * c + v) * n + k] = vertices(c, v);
+      }
+    }
+  }
+  std::vector<double> lapl(6 * n);
+  std::vector<double> area(n);
+  for (const lf::uscalfe::SimdLevel level :
+       {lf::uscalfe::SimdLevel::kScalar, lf::uscalfe::SimdLevel::kAVX2,
+        lf::uscalfe::SimdLevel::kAVX512}) {
+    if (static_cast<int>(level) >
+        static_cast<int>(lf::uscalfe::DetectSimdLevel())) {
+      continue;
+    }
+    std::cout << "kernel only, " << level << ":\t    ";
+    {
+      boost::timer::auto_cpu_timer t;
+      for (int r = 0; r < reps; ++r) {
+        lf::uscalfe::LinearFETriaKernel(level, n, xy.data(), lapl.data(),
+                                        area.data());
+      }
+    }
+    // The areas of all triangles add up to the area of the unit square
+    std::cout << "  total area = "
+              << std::accumulate(area.begin(), area.end(), 0.0) << std::endl;
+  }
+  return 0;
+}
@@ -16,10 +16,21 @@
 #define __cb2024b1c029404f85ca46a0178b43f1
 
 #include "assembler.h"
+#include "assembly_capacity.h"
+#include "assembly_profiler.h"
 #include "assembly_types.h"
+#include "block_dofhandler.h"
+#include "bsr_matrix.h"
+#include "coloring.h"
 #include "coomatrix.h"
 #include "dofhandler.h"
+#include "element_matrix_cache.h"
 #include "fix_dof.h"
+#include "incremental_assembly.h"
+#include "parallel_assembler.h"
+#include "partitioned_dofhandler.h"
+#include "sparsity_pattern.h"
+#include "static_condensation.h"
 
 /** @brief D.o.f. index mapping and assembly facilities
  *
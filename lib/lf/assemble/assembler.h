@@ -17,7 +17,10 @@
 #define _LF_ASSEMBLE_H
 
 #include <iostream>
+#include <type_traits>
+#include <vector>
 
+#include "assembly_profiler.h"
 #include "dofhandler.h"
 
 namespace lf::assemble {
@@ -45,6 +48,89 @@ const unsigned int amd_lass = 16;
 // EXTERNDECLAREINFO(ass_mat_dbg_ctrl, "Assembly_ctrl",
 //                  "Debugging output control for AssembleMatrixLocally()");
 
+/**
+ * @brief Maximal number of entities passed to a single call of the
+ * `EvalBatch()` method of an \ref entity_matrix_provider
+ */
+constexpr size_type kEvalBatchSize = 64;
+
+namespace internal {
+/**
+ * @brief Debugging output controlled by #ass_mat_dbg_ctrl for an active
+ * entity, shared by all variants of AssembleMatrixLocally()
+ */
+inline void PrintEntityInfo(const lf::mesh::Mesh &mesh,
+                            const lf::mesh::Entity &entity) {
+  SWITCHEDSTATEMENT(ass_mat_dbg_ctrl, amd_entity,
+                    std::cout << "ASM: " << entity << '(' << mesh.Index(entity)
+                              << ')' << std::endl);
+}
+
+/**
+ * @brief Debugging output controlled by #ass_mat_dbg_ctrl for an element
+ * matrix about to be added to the global matrix, shared by all variants of
+ * AssembleMatrixLocally()
+ */
+template <class ELEM_MAT>
+void PrintElementMatrixInfo(nonstd::span<const gdof_idx_t> row_idx,
+                            nonstd::span<const gdof_idx_t> col_idx,
+                            size_type nrows_loc, size_type ncols_loc,
+                            const ELEM_MAT &elem_mat) {
+  // clang-format off
+  SWITCHEDSTATEMENT(
+      ass_mat_dbg_ctrl, amd_gdof,
+      std::cout << "ASM: row_idx = ";
+      for (auto gdof_idx: row_idx) {
+        std::cout << gdof_idx << ' ';
+      }
+      std::cout << std::endl << "ASM: col_idx = ";
+      for (auto gdof_idx : col_idx) {
+        std::cout << gdof_idx << ' ';
+      }
+      std::cout << std::endl);
+  // clang-format on
+  SWITCHEDSTATEMENT(ass_mat_dbg_ctrl, amd_lmdim,
+                    std::cout << "ASM: " << nrows_loc << " x " << ncols_loc
+                              << " element matrix" << std::endl);
+  SWITCHEDSTATEMENT(
+      ass_mat_dbg_ctrl, amd_locmat, for (size_type i = 0; i < nrows_loc; i++) {
+        std::cout << "[ ";
+        for (size_type j = 0; j < ncols_loc; j++) {
+          std::cout << elem_mat(i, j) << ' ';
+        }
+        std::cout << "]" << std::endl;
+      });
+}
+
+template <class EMP, class = void>
+struct HasEvalBatch : std::false_type {};
+
+template <class EMP>
+struct HasEvalBatch<
+    EMP, std::void_t<decltype(std::declval<EMP &>().EvalBatch(
+             std::declval<nonstd::span<const lf::mesh::Entity *const>>(),
+             std::declval<std::vector<std::decay_t<decltype(
+                 std::declval<EMP &>().Eval(
+                     std::declval<const lf::mesh::Entity &>()))>> &>()))>>
+    : std::true_type {};
+}  // namespace internal
+
+/**
+ * @brief Determine whether an \ref entity_matrix_provider offers the optional
+ * batched evaluation method `EvalBatch()`
+ *
+ * @tparam EMP type modelling the concept \ref entity_matrix_provider
+ *
+ * The signature of the method must be
+ * ~~~
+ * void EvalBatch(nonstd::span<const lf::mesh::Entity *const> entities,
+ *                std::vector<ElemMat> &mats);
+ * ~~~
+ * where `ElemMat` is the (decayed) return type of `Eval()`.
+ */
+template <class EMP>
+constexpr bool isBatchEntityMatrixProvider = internal::HasEvalBatch<EMP>::value;
+
 /**
  * @defgroup assemble_matrix_locally Cell-Oriented Assembly of Galerkin Matrices
  * @brief Based on helper objects that provide element matrices these functions
@@ -70,6 +156,88 @@ const unsigned int amd_lass = 16;
  *  @{
  */
 
+/**
+ * @brief Variant of AssembleMatrixLocally() for entity matrix providers
+ * offering `EvalBatch()`
+ *
+ * Active entities are collected in blocks of at most #kEvalBatchSize entities
+ * of the same reference element type, which are passed to `EvalBatch()`. The
+ * buffer for the element matrices is reused for all blocks. Matrix entries are
+ * updated in exactly the same order as in the non-batched version, which
+ * also holds for the debugging output controlled by #ass_mat_dbg_ctrl.
+ */
+template <typename TMPMATRIX, class ENTITY_MATRIX_PROVIDER>
+void AssembleMatrixLocallyBatched(
+    dim_t codim, const DofHandler &dof_handler_trial,
+    const DofHandler &dof_handler_test,
+    ENTITY_MATRIX_PROVIDER &entity_matrix_provider, TMPMATRIX &matrix) {
+  using elem_mat_t = std::decay_t<decltype(entity_matrix_provider.Eval(
+      std::declval<const lf::mesh::Entity &>()))>;
+  auto mesh = dof_handler_trial.Mesh();
+  LF_ASSERT_MSG(mesh == dof_handler_test.Mesh(),
+                "Trial and test space must be defined on the same mesh");
+  // Current block of active entities and their element matrices
+  std::vector<const lf::mesh::Entity *> batch;
+  batch.reserve(kEvalBatchSize);
+  std::vector<elem_mat_t> elem_mats;
+  auto flush = [&]() -> void {
+    if (batch.empty()) {
+      return;
+    }
+    {
+      LF_ASSEMBLY_TIMER(eval_timer, kEval);
+      entity_matrix_provider.EvalBatch(
+          nonstd::span<const lf::mesh::Entity *const>(batch.data(),
+                                                      batch.size()),
+          elem_mats);
+    }
+    LF_ASSERT_MSG(elem_mats.size() >= batch.size(),
+                  "EvalBatch() returned too few element matrices");
+    for (size_type k = 0; k < batch.size(); ++k) {
+      const lf::mesh::Entity &entity{*batch[k]};
+      const elem_mat_t &elem_mat{elem_mats[k]};
+      const size_type nrows_loc = dof_handler_test.NumLocalDofs(entity);
+      const size_type ncols_loc = dof_handler_trial.NumLocalDofs(entity);
+      nonstd::span<const gdof_idx_t> row_idx(LF_ASSEMBLY_TIMED(
+          kDofLookup, dof_handler_test.GlobalDofIndices(entity)));
+      nonstd::span<const gdof_idx_t> col_idx(LF_ASSEMBLY_TIMED(
+          kDofLookup, dof_handler_trial.GlobalDofIndices(entity)));
+      LF_ASSERT_MSG((elem_mat.rows() >= nrows_loc) &&
+                        (elem_mat.cols() >= ncols_loc),
+                    "Element matrix too small for entity "
+                        << mesh->Index(entity));
+      internal::PrintEntityInfo(*mesh, entity);
+      internal::PrintElementMatrixInfo(row_idx, col_idx, nrows_loc, ncols_loc,
+                                       elem_mat);
+      LF_ASSEMBLY_COUNT(kTripletsAdded, nrows_loc * ncols_loc);
+      LF_ASSEMBLY_TIMER(add_timer, kAddToEntry);
+      for (size_type i = 0; i < nrows_loc; i++) {
+        for (size_type j = 0; j < ncols_loc; j++) {
+          matrix.AddToEntry(row_idx[i], col_idx[j], elem_mat(i, j));
+          SWITCHEDSTATEMENT(ass_mat_dbg_ctrl, amd_lass,
+                            std::cout << "(" << row_idx[i] << ',' << col_idx[j]
+                                      << ")+= " << elem_mat(i, j) << ", ";);
+        }
+      }
+      SWITCHEDSTATEMENT(ass_mat_dbg_ctrl, amd_lass, std::cout << std::endl;);
+    }
+    batch.clear();
+  };
+  for (const lf::mesh::Entity *entity : mesh->Entities(codim)) {
+    LF_ASSEMBLY_COUNT(kEntitiesVisited, 1);
+    if (entity_matrix_provider.isActive(*entity)) {
+      LF_ASSEMBLY_COUNT(kEntitiesActive, 1);
+      // A block must only contain entities of the same type
+      if ((batch.size() == kEvalBatchSize) ||
+          (!batch.empty() && (batch.front()->RefEl() != entity->RefEl()))) {
+        flush();
+      }
+      batch.push_back(entity);
+    }
+  }
+  flush();
+}
+
 /**
  * @brief Assembly function for standard assembly of finite element matrices
  *
@@ -113,6 +281,10 @@ const unsigned int amd_lass = 16;
  * number of local shape functions. In this case only its upper left block is
  * accessed.
  *
+ * @note If ENTITY_MATRIX_PROVIDER offers the optional method `EvalBatch()`,
+ * see #isBatchEntityMatrixProvider, element matrices are requested in blocks
+ * of entities of the same type, see AssembleMatrixLocallyBatched().
+ *
  * #### Example Usage
  * @snippet assembler.cc matrix_usage
  */
@@ -121,6 +293,11 @@ void AssembleMatrixLocally(dim_t codim, const DofHandler &dof_handler_trial,
                            const DofHandler &dof_handler_test,
                            ENTITY_MATRIX_PROVIDER &entity_matrix_provider,
                            TMPMATRIX &matrix) {
+  if constexpr (isBatchEntityMatrixProvider<ENTITY_MATRIX_PROVIDER>) {
+    AssembleMatrixLocallyBatched(codim, dof_handler_trial, dof_handler_test,
+                                 entity_matrix_provider, matrix);
+    return;
+  }
   // Fetch pointer to underlying mesh
   auto mesh = dof_handler_trial.Mesh();
   LF_ASSERT_MSG(mesh == dof_handler_test.Mesh(),
@@ -128,54 +305,35 @@ void AssembleMatrixLocally(dim_t codim, const DofHandler &dof_handler_trial,
   // Central assembly loop over entities of co-dimension specified by
   // the function argument codim
   for (const lf::mesh::Entity *entity : mesh->Entities(codim)) {
+    LF_ASSEMBLY_COUNT(kEntitiesVisited, 1);
     // Some entities may be skipped
     if (entity_matrix_provider.isActive(*entity)) {
-      SWITCHEDSTATEMENT(ass_mat_dbg_ctrl, amd_entity,
-                        std::cout << "ASM: " << *entity << '('
-                                  << mesh->Index(*entity) << ')' << std::endl);
+      LF_ASSEMBLY_COUNT(kEntitiesActive, 1);
+      internal::PrintEntityInfo(*mesh, *entity);
       // Size, aka number of rows and columns, of element matrix
       const size_type nrows_loc = dof_handler_test.NumLocalDofs(*entity);
       const size_type ncols_loc = dof_handler_trial.NumLocalDofs(*entity);
       // row indices of for contributions of cells
-      nonstd::span<const gdof_idx_t> row_idx(
-          dof_handler_test.GlobalDofIndices(*entity));
+      nonstd::span<const gdof_idx_t> row_idx(LF_ASSEMBLY_TIMED(
+          kDofLookup, dof_handler_test.GlobalDofIndices(*entity)));
       // Column indices of for contributions of cells
-      nonstd::span<const gdof_idx_t> col_idx(
-          dof_handler_trial.GlobalDofIndices(*entity));
+      nonstd::span<const gdof_idx_t> col_idx(LF_ASSEMBLY_TIMED(
+          kDofLookup, dof_handler_trial.GlobalDofIndices(*entity)));
       // Request local matrix from entity_matrix_provider object. In the
       // case codim = 0, when `entity` is a cell, this is the element matrix
-      const auto elem_mat{entity_matrix_provider.Eval(*entity)};
+      const auto elem_mat{
+          LF_ASSEMBLY_TIMED(kEval, entity_matrix_provider.Eval(*entity))};
       LF_ASSERT_MSG(elem_mat.rows() >= nrows_loc,
                     "nrows mismatch " << elem_mat.rows() << " <-> " << nrows_loc
                                       << ", entity " << mesh->Index(*entity));
       LF_ASSERT_MSG(elem_mat.cols() >= ncols_loc,
                     "ncols mismatch " << elem_mat.cols() << " <-> " << nrows_loc
                                       << ", entity " << mesh->Index(*entity));
-      // clang-format off
-      SWITCHEDSTATEMENT(
-          ass_mat_dbg_ctrl, amd_gdof,
-	  std::cout << "ASM: row_idx = ";
-          for (auto gdof_idx: row_idx) {
-	    std::cout << gdof_idx << ' ';
-	  }
-	  std::cout << std::endl << "ASM: col_idx = ";
-	  for (auto gdof_idx : col_idx) {
-            std::cout << gdof_idx << ' ';
-          }
-	  std::cout << std::endl);
-      // clang-format on
-      SWITCHEDSTATEMENT(ass_mat_dbg_ctrl, amd_lmdim,
-                        std::cout << "ASM: " << nrows_loc << " x " << ncols_loc
-                                  << " element matrix" << std::endl);
-      SWITCHEDSTATEMENT(
-          ass_mat_dbg_ctrl, amd_locmat, for (int i = 0; i < nrows_loc; i++) {
-            std::cout << "[ ";
-            for (int j = 0; j < ncols_loc; j++) {
-              std::cout << elem_mat(i, j) << ' ';
-            }
-            std::cout << "]" << std::endl;
-          });
+      internal::PrintElementMatrixInfo(row_idx, col_idx, nrows_loc, ncols_loc,
+                                       elem_mat);
       // Assembly double loop
+      LF_ASSEMBLY_COUNT(kTripletsAdded, nrows_loc * ncols_loc);
+      LF_ASSEMBLY_TIMER(add_timer, kAddToEntry);
       for (int i = 0; i < nrows_loc; i++) {
         for (int j = 0; j < ncols_loc; j++) {
           // Add the element at position (i,j) of the local matrix
@@ -246,6 +404,86 @@ TMPMATRIX AssembleMatrixLocally(
   return AssembleMatrixLocally<TMPMATRIX, ENTITY_MATRIX_PROVIDER>(
       codim, dof_handler, dof_handler, entity_matrix_provider);
 }
+
+/**
+ * @brief Assembly of the upper triangular part of a symmetric Galerkin matrix
+ *
+ * @tparam TMPMATRIX a type fitting the concept of COOMatrix
+ * @tparam ENTITY_MATRIX_PROVIDER a type providing the computation of
+ * _symmetric_ element matrices, must model the concept \ref
+ * entity_matrix_provider
+ * @param codim co-dimension of mesh entities which should be traversed
+ *              in the course of assembly
+ * @param dof_handler dof handler object for both trial and test space
+ * @param entity_matrix_provider @ref entity_matrix_provider object
+ * @param matrix matrix object to which the contributions to entries
+ * \f$(i,j)\f$ with \f$i \leq j\f$ are added
+ *
+ * Works like AssembleMatrixLocally(), but only those entries of element
+ * matrices are passed to `matrix.AddToEntry()` that belong to the upper
+ * triangle of the global matrix. This roughly halves the number of triplets
+ * stored in a COOMatrix and, thus, peak memory during assembly.
+ *
+ * The resulting sparse matrix `A` holds only the upper triangular part. It has
+ * to be used through `A.selfadjointView<Eigen::Upper>()`, e.g., for
+ * matrix-vector products, or with solvers that read only one triangle like
+ * `Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>, Eigen::Upper>` or
+ * `Eigen::ConjugateGradient<Eigen::SparseMatrix<double>, Eigen::Upper>`.
+ *
+ * @note Symmetry of the element matrices is not checked: for an entry below
+ * the diagonal of the global matrix the contribution of its mirror entry is
+ * used instead.
+ */
+template <typename TMPMATRIX, class ENTITY_MATRIX_PROVIDER>
+void AssembleSymmetricMatrixLocally(
+    dim_t codim, const DofHandler &dof_handler,
+    ENTITY_MATRIX_PROVIDER &entity_matrix_provider, TMPMATRIX &matrix) {
+  auto mesh = dof_handler.Mesh();
+  for (const lf::mesh::Entity *entity : mesh->Entities(codim)) {
+    LF_ASSEMBLY_COUNT(kEntitiesVisited, 1);
+    if (entity_matrix_provider.isActive(*entity)) {
+      LF_ASSEMBLY_COUNT(kEntitiesActive, 1);
+      const size_type n_loc = dof_handler.NumLocalDofs(*entity);
+      nonstd::span<const gdof_idx_t> dof_idx(LF_ASSEMBLY_TIMED(
+          kDofLookup, dof_handler.GlobalDofIndices(*entity)));
+      const auto elem_mat{
+          LF_ASSEMBLY_TIMED(kEval, entity_matrix_provider.Eval(*entity))};
+      LF_ASSERT_MSG((elem_mat.rows() >= n_loc) && (elem_mat.cols() >= n_loc),
+                    "element matrix too small for entity "
+                        << mesh->Index(*entity));
+      // The global indices of an entity are distinct, so that exactly the
+      // upper triangle of the element matrix is added
+      LF_ASSEMBLY_COUNT(kTripletsAdded, n_loc * (n_loc + 1) / 2);
+      LF_ASSEMBLY_TIMER(add_timer, kAddToEntry);
+      for (size_type i = 0; i < n_loc; i++) {
+        for (size_type j = 0; j < n_loc; j++) {
+          if (dof_idx[i] <= dof_idx[j]) {
+            matrix.AddToEntry(dof_idx[i], dof_idx[j], elem_mat(i, j));
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Assembly of the upper triangular part of a symmetric Galerkin matrix
+ * @sa AssembleSymmetricMatrixLocally(dim_t, const DofHandler &,
+ * ENTITY_MATRIX_PROVIDER &, TMPMATRIX &)
+ *
+ * @return upper triangular part of the Galerkin matrix in a format determined
+ * by the template argument TMPMATRIX
+ */
+template <typename TMPMATRIX, class ENTITY_MATRIX_PROVIDER>
+TMPMATRIX AssembleSymmetricMatrixLocally(
+    dim_t codim, const DofHandler &dof_handler,
+    ENTITY_MATRIX_PROVIDER &entity_matrix_provider) {
+  TMPMATRIX matrix{dof_handler.NumDofs(), dof_handler.NumDofs()};
+  matrix.setZero();
+  AssembleSymmetricMatrixLocally<TMPMATRIX, ENTITY_MATRIX_PROVIDER>(
+      codim, dof_handler, entity_matrix_provider, matrix);
+  return matrix;
+}
 /** @} */  // end of group assemble_matrix_locally
 
 /**
@@ -304,20 +542,24 @@ void AssembleVectorLocally(dim_t codim, const DofHandler &dof_handler,
   // Central assembly loop over entities of the co-dimension specified via
   // the template argument CODIM
   for (const lf::mesh::Entity *entity : mesh->Entities(codim)) {
+    LF_ASSEMBLY_COUNT(kEntitiesVisited, 1);
     // Some cells may be skipped
     if (entity_vector_provider.isActive(*entity)) {
+      LF_ASSEMBLY_COUNT(kEntitiesActive, 1);
       // Length of element vector
       const size_type veclen = dof_handler.NumLocalDofs(*entity);
       // global dof indices for contribution of the entity
-      nonstd::span<const gdof_idx_t> dof_idx(
-          dof_handler.GlobalDofIndices(*entity));
+      nonstd::span<const gdof_idx_t> dof_idx(LF_ASSEMBLY_TIMED(
+          kDofLookup, dof_handler.GlobalDofIndices(*entity)));
       // Request local vector from entity_vector_provider object. In the case
       // CODIM = 0, when `entity` is a cell, this is the element vector
-      const auto elem_vec{entity_vector_provider.Eval(*entity)};
+      const auto elem_vec{
+          LF_ASSEMBLY_TIMED(kEval, entity_vector_provider.Eval(*entity))};
       LF_ASSERT_MSG(elem_vec.size() >= veclen,
                     "length mismatch " << elem_vec.size() << " <-> " << veclen
                                        << ", entity " << mesh->Index(*entity));
       // Assembly (single) loop
+      LF_ASSEMBLY_TIMER(add_timer, kAddToEntry);
       for (int i = 0; i < veclen; i++) {
         resultvector[dof_idx[i]] += elem_vec[i];
       }  // end assembly localloop
@@ -357,6 +599,84 @@ VECTOR AssembleVectorLocally(dim_t codim, const DofHandler &dof_handler,
   return resultvector;
 }  // end AssembleVectorLocally
 
+/**
+ * @brief entity-local assembly of several (right-hand-side) vectors in a
+ * single traversal of the mesh
+ *
+ * @tparam MATRIX a dense matrix type with Eigen-style `row()` access
+ * @tparam ENTITY_MULTIVECTOR_PROVIDER type for objects computing
+ * entity-local blocks of vectors, see below
+ * @param codim co-dimension of entities over which assembly should be carried
+ * out
+ * @param dof_handler object providing local-to-global dof index mapping, see
+ * DofHandler
+ * @param entity_multivector_provider local provider object (passed as
+ * non-const!)
+ * @param resultmatrix matrix with `dof_handler.NumDofs()` rows, one column
+ * for every vector, to which the contributions are added
+ *
+ * The provider satisfies the requirements of \ref entity_vector_provider
+ * except that `Eval()` returns a `n_loc x k` matrix, whose column `j` is the
+ * element vector belonging to column `j` of `resultmatrix`. Thus geometric
+ * information about an entity, e.g., quadrature points and metric factors,
+ * has to be computed only once for all `k` vectors, see
+ * lf::uscalfe::ScalarLoadElementMultiVectorProvider.
+ *
+ * @note Contributions are added to the entries of `resultmatrix`, which has
+ * to be initialized before calling this function.
+ */
+template <typename MATRIX, class ENTITY_MULTIVECTOR_PROVIDER>
+void AssembleMultiVectorLocally(
+    dim_t codim, const DofHandler &dof_handler,
+    ENTITY_MULTIVECTOR_PROVIDER &entity_multivector_provider,
+    MATRIX &resultmatrix) {
+  auto mesh = dof_handler.Mesh();
+  for (const lf::mesh::Entity *entity : mesh->Entities(codim)) {
+    LF_ASSEMBLY_COUNT(kEntitiesVisited, 1);
+    if (entity_multivector_provider.isActive(*entity)) {
+      LF_ASSEMBLY_COUNT(kEntitiesActive, 1);
+      const size_type veclen = dof_handler.NumLocalDofs(*entity);
+      nonstd::span<const gdof_idx_t> dof_idx(LF_ASSEMBLY_TIMED(
+          kDofLookup, dof_handler.GlobalDofIndices(*entity)));
+      const auto elem_vecs{
+          LF_ASSEMBLY_TIMED(kEval, entity_multivector_provider.Eval(*entity))};
+      LF_ASSERT_MSG(elem_vecs.rows() >= veclen,
+                    "length mismatch " << elem_vecs.rows() << " <-> " << veclen
+                                       << ", entity " << mesh->Index(*entity));
+      LF_ASSERT_MSG(elem_vecs.cols() == resultmatrix.cols(),
+                    "number of vectors mismatch " << elem_vecs.cols() << " <-> "
+                                                  << resultmatrix.cols());
+      // Every local d.o.f. contributes to a whole row of the result
+      LF_ASSEMBLY_TIMER(add_timer, kAddToEntry);
+      for (size_type i = 0; i < veclen; i++) {
+        resultmatrix.row(dof_idx[i]) += elem_vecs.row(i);
+      }
+    }
+  }
+}
+
+/**
+ * @brief entity-local assembly of several (right-hand-side) vectors in a
+ * single traversal of the mesh
+ *
+ * @param num_vectors number of vectors to be assembled, must agree with the
+ * number of columns of the local blocks supplied by the provider
+ * @return `dof_handler.NumDofs() x num_vectors` matrix of type `MATRIX`
+ *
+ * @sa AssembleMultiVectorLocally(dim_t, const DofHandler &,
+ * ENTITY_MULTIVECTOR_PROVIDER &, MATRIX &)
+ */
+template <typename MATRIX, class ENTITY_MULTIVECTOR_PROVIDER>
+MATRIX AssembleMultiVectorLocally(
+    dim_t codim, const DofHandler &dof_handler, Eigen::Index num_vectors,
+    ENTITY_MULTIVECTOR_PROVIDER &entity_multivector_provider) {
+  MATRIX resultmatrix(dof_handler.NumDofs(), num_vectors);
+  resultmatrix.setZero();
+  AssembleMultiVectorLocally<MATRIX, ENTITY_MULTIVECTOR_PROVIDER>(
+      codim, dof_handler, entity_multivector_provider, resultmatrix);
+  return resultmatrix;
+}
+
 /** @} */  // end group assemble_vector_locally
 
 }  // namespace lf::assemble
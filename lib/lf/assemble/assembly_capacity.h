@@ -0,0 +1,146 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Predicting the number of triplets and the memory needed for
+ * assembling a Galerkin matrix in COO format
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#ifndef _LF_ASSEMBLE_CAPACITY_H
+#define _LF_ASSEMBLE_CAPACITY_H
+
+#include <lf/base/base.h>
+
+#include <cstddef>
+#include <utility>
+
+#include "coomatrix.h"
+#include "dofhandler.h"
+
+namespace lf::assemble {
+
+/**
+ * @brief Exact number of calls of `AddToEntry()` made by
+ * AssembleMatrixLocally()
+ *
+ * @tparam SELECTOR predicate type compliant with `std::function<bool(const
+ * lf::mesh::Entity &)>`
+ * @param codim co-dimension of the entities to be visited
+ * @param dof_handler_trial dof handler for the column space
+ * @param dof_handler_test dof handler for the row space
+ * @param is_active selects the entities taken into account; pass a lambda
+ * calling `isActive()` of the \ref entity_matrix_provider to obtain the
+ * precise count for that provider.
+ * @return sum of `NumLocalDofs_test * NumLocalDofs_trial` over all selected
+ * entities
+ *
+ * Only the local d.o.f. counts of the entities are examined, so the cost is
+ * negligible compared to assembly.
+ */
+template <class SELECTOR = base::PredicateTrue>
+std::size_t CountAssemblyTriplets(dim_t codim,
+                                  const DofHandler &dof_handler_trial,
+                                  const DofHandler &dof_handler_test,
+                                  SELECTOR &&is_active = {}) {
+  auto mesh = dof_handler_trial.Mesh();
+  LF_ASSERT_MSG(mesh == dof_handler_test.Mesh(),
+                "Trial and test space must be defined on the same mesh");
+  std::size_t num_triplets = 0;
+  for (const lf::mesh::Entity *entity : mesh->Entities(codim)) {
+    if (is_active(*entity)) {
+      num_triplets +=
+          static_cast<std::size_t>(dof_handler_test.NumLocalDofs(*entity)) *
+          dof_handler_trial.NumLocalDofs(*entity);
+    }
+  }
+  return num_triplets;
+}
+
+/**
+ * @brief Memory requirements of assembling a Galerkin matrix into a
+ * COOMatrix and converting it with COOMatrix::makeSparse()
+ *
+ * All sizes are in bytes. Sparse matrix sizes are upper bounds, because the
+ * number of non-zero entries is bounded by the number of triplets.
+ */
+struct AssemblyMemoryEstimate {
+  /** number of triplets produced by local assembly */
+  std::size_t num_triplets;
+  /** memory for the triplet vector of the COOMatrix */
+  std::size_t triplet_bytes;
+  /** upper bound for the memory of the resulting `Eigen::SparseMatrix` */
+  std::size_t sparse_bytes;
+
+  /**
+   * @brief Upper bound for the peak memory of assembly and conversion
+   *
+   * `Eigen::SparseMatrix::setFromTriplets()` builds a temporary matrix of the
+   * same size as the result while the triplets are still alive.
+   */
+  [[nodiscard]] std::size_t PeakBytes() const {
+    return triplet_bytes + 2 * sparse_bytes;
+  }
+};
+
+/**
+ * @brief Predict the memory needed for assembling a Galerkin matrix in COO
+ * format, without assembling it
+ *
+ * @tparam SCALAR scalar type of the matrix
+ * @tparam SELECTOR see CountAssemblyTriplets()
+ *
+ * The arguments have the same meaning as for CountAssemblyTriplets(). This
+ * allows to reject computations exceeding the available memory before
+ * spending time on assembly.
+ */
+template <typename SCALAR, class SELECTOR = base::PredicateTrue>
+AssemblyMemoryEstimate EstimateAssemblyMemory(
+    dim_t codim, const DofHandler &dof_handler_trial,
+    const DofHandler &dof_handler_test, SELECTOR &&is_active = {}) {
+  using StorageIndex = typename Eigen::SparseMatrix<SCALAR>::StorageIndex;
+  AssemblyMemoryEstimate estimate{};
+  estimate.num_triplets =
+      CountAssemblyTriplets(codim, dof_handler_trial, dof_handler_test,
+                            std::forward<SELECTOR>(is_active));
+  estimate.triplet_bytes =
+      COOMatrix<SCALAR>::MemoryEstimate(estimate.num_triplets);
+  estimate.sparse_bytes =
+      estimate.num_triplets * (sizeof(SCALAR) + sizeof(StorageIndex)) +
+      (static_cast<std::size_t>(dof_handler_trial.NumDofs()) + 1) *
+          sizeof(StorageIndex);
+  return estimate;
+}
+
+/**
+ * @brief Reserve exactly the memory for the triplets AssembleMatrixLocally()
+ * will add to a COOMatrix
+ *
+ * @param matrix COO matrix the Galerkin matrix will be assembled into.
+ * Triplets already stored are taken into account.
+ * @return number of triplets the assembly will add
+ *
+ * The remaining arguments have the same meaning as for
+ * CountAssemblyTriplets(). With this capacity no reallocation of the triplet
+ * vector happens during assembly.
+ */
+template <typename SCALAR, class SELECTOR = base::PredicateTrue>
+std::size_t ReserveTriplets(COOMatrix<SCALAR> &matrix, dim_t codim,
+                            const DofHandler &dof_handler_trial,
+                            const DofHandler &dof_handler_test,
+                            SELECTOR &&is_active = {}) {
+  const std::size_t num_triplets =
+      CountAssemblyTriplets(codim, dof_handler_trial, dof_handler_test,
+                            std::forward<SELECTOR>(is_active));
+  matrix.reserve(matrix.triplets().size() + num_triplets);
+  return num_triplets;
+}
+
+}  // namespace lf::assemble
+
+#endif
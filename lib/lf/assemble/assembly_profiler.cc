@@ -0,0 +1,90 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Implementation of the JSON summary of assembly profiling
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#include "assembly_profiler.h"
+
+#include <iomanip>
+#include <sstream>
+
+namespace lf::assemble {
+
+void AssemblyProfiler::Reset() {
+  for (unsigned int p = 0; p < kNumPhases; ++p) {
+    nanoseconds_[p].store(0, std::memory_order_relaxed);
+    calls_[p].store(0, std::memory_order_relaxed);
+  }
+  for (auto &counter : counters_) {
+    counter.store(0, std::memory_order_relaxed);
+  }
+}
+
+const char *AssemblyProfiler::Name(Phase phase) {
+  switch (phase) {
+    case kEval:
+      return "eval";
+    case kDofLookup:
+      return "dof_lookup";
+    case kAddToEntry:
+      return "add_to_entry";
+    case kMakeSparse:
+      return "make_sparse";
+    case kCompress:
+      return "compress";
+    default:
+      return "unknown";
+  }
+}
+
+const char *AssemblyProfiler::Name(Counter counter) {
+  switch (counter) {
+    case kEntitiesVisited:
+      return "entities_visited";
+    case kEntitiesActive:
+      return "entities_active";
+    case kTripletsAdded:
+      return "triplets_added";
+    case kTripletReallocations:
+      return "triplet_reallocations";
+    default:
+      return "unknown";
+  }
+}
+
+void AssemblyProfiler::WriteJson(std::ostream &o) const {
+  std::ostringstream json;
+  json << std::setprecision(9);
+  json << "{\"enabled\": " << (Enabled() ? "true" : "false")
+       << ", \"phases\": {";
+  for (unsigned int p = 0; p < kNumPhases; ++p) {
+    const auto phase = static_cast<Phase>(p);
+    json << (p > 0 ? ", " : "") << '"' << Name(phase)
+         << "\": {\"calls\": " << Calls(phase)
+         << ", \"seconds\": " << Seconds(phase) << '}';
+  }
+  json << "}, \"counters\": {";
+  for (unsigned int c = 0; c < kNumCounters; ++c) {
+    const auto counter = static_cast<Counter>(c);
+    json << (c > 0 ? ", " : "") << '"' << Name(counter)
+         << "\": " << Value(counter);
+  }
+  json << "}}";
+  o << json.str();
+}
+
+std::string AssemblyProfiler::ToJson() const {
+  std::ostringstream o;
+  WriteJson(o);
+  return o.str();
+}
+
+}  // namespace lf::assemble
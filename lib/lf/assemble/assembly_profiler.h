@@ -0,0 +1,252 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Low-overhead counters and timers for the phases of matrix assembly
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#ifndef _LF_ASSEMBLE_ASSEMBLY_PROFILER_H
+#define _LF_ASSEMBLE_ASSEMBLY_PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace lf::assemble {
+
+/**
+ * @brief Collects timings and counts of the phases of assembly
+ *
+ * The assembly functions in assembler.h and the COOMatrix class report to
+ * the single global instance returned by Get():
+ * - time spent in the `Eval()`/`EvalBatch()` methods of entity matrix and
+ *   vector providers,
+ * - time spent looking up global d.o.f. indices,
+ * - time spent adding entries with `AddToEntry()` or into vectors,
+ * - time spent in COOMatrix::makeSparse() and COOMatrix::Compress(),
+ * - the numbers of visited and active entities, of triplets added and of
+ *   re-allocations of the triplet storage of COOMatrix.
+ *
+ * ### Switches
+ * - _compile time_: the instrumentation is compiled in, if the macro
+ *   `LF_ASSEMBLY_PROFILING` is defined, which is controlled by the CMake
+ *   option `LF_ENABLE_ASSEMBLY_PROFILING` (default `OFF`). Otherwise it
+ *   vanishes completely.
+ * - _run time_: recording is off by default and switched on by
+ *   `AssemblyProfiler::Get().Enable()`. When disabled, the instrumentation
+ *   costs a few well-predicted branches per entity and none per matrix
+ *   entry.
+ *
+ * Counters are atomic, so that concurrent assembly, e.g., with
+ * ParallelAssembleMatrixLocally(), can be profiled, too. Times of concurrent
+ * threads add up.
+ *
+ * ToJson() produces a machine-readable summary, which can be stored and
+ * compared across versions to detect regressions:
+ * ~~~
+ * lf::assemble::AssemblyProfiler::Get().Enable();
+ * auto A = lf::assemble::AssembleMatrixLocally<COOMatrix<double>>(...);
+ * auto A_crs = A.makeSparse();
+ * std::cout << lf::assemble::AssemblyProfiler::Get().ToJson() << std::endl;
+ * ~~~
+ */
+class AssemblyProfiler {
+ public:
+  /** @brief Timed phases of assembly */
+  enum Phase : unsigned int {
+    kEval = 0,    ///< computation of element matrices/vectors
+    kDofLookup,   ///< retrieval of global d.o.f. indices
+    kAddToEntry,  ///< adding element contributions to the global object
+    kMakeSparse,  ///< conversion COOMatrix -> Eigen::SparseMatrix
+    kCompress,    ///< in-place compression of COOMatrix triplets
+    kNumPhases
+  };
+  /** @brief Event counters */
+  enum Counter : unsigned int {
+    kEntitiesVisited = 0,   ///< entities traversed by assembly loops
+    kEntitiesActive,        ///< entities for which `isActive()` was true
+    kTripletsAdded,         ///< entries passed to `AddToEntry()`
+    kTripletReallocations,  ///< growth of the triplet storage of COOMatrix
+    kNumCounters
+  };
+
+  AssemblyProfiler(const AssemblyProfiler &) = delete;
+  AssemblyProfiler(AssemblyProfiler &&) = delete;
+  AssemblyProfiler &operator=(const AssemblyProfiler &) = delete;
+  AssemblyProfiler &operator=(AssemblyProfiler &&) = delete;
+  ~AssemblyProfiler() = default;
+
+  /** @brief the global profiler instance */
+  static AssemblyProfiler &Get() {
+    static AssemblyProfiler instance;
+    return instance;
+  }
+
+  /** @brief switch recording on or off */
+  void Enable(bool on = true) { enabled_.store(on, std::memory_order_relaxed); }
+  /** @brief whether events are recorded */
+  [[nodiscard]] bool Enabled() const {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+  /** @brief Set all timers and counters to zero */
+  void Reset();
+
+  /** @brief add the duration of one execution of a phase */
+  void AddTime(Phase phase, std::chrono::steady_clock::duration duration) {
+    nanoseconds_[phase].fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(),
+        std::memory_order_relaxed);
+    calls_[phase].fetch_add(1, std::memory_order_relaxed);
+  }
+  /** @brief increment a counter */
+  void Count(Counter counter, std::uint64_t n = 1) {
+    counters_[counter].fetch_add(n, std::memory_order_relaxed);
+  }
+
+  /** @brief accumulated time spent in a phase, in seconds */
+  [[nodiscard]] double Seconds(Phase phase) const {
+    return 1.0E-9 * static_cast<double>(
+                         nanoseconds_[phase].load(std::memory_order_relaxed));
+  }
+  /** @brief number of timed executions of a phase */
+  [[nodiscard]] std::uint64_t Calls(Phase phase) const {
+    return calls_[phase].load(std::memory_order_relaxed);
+  }
+  /** @brief current value of a counter */
+  [[nodiscard]] std::uint64_t Value(Counter counter) const {
+    return counters_[counter].load(std::memory_order_relaxed);
+  }
+
+  /** @brief name of a phase as used in the JSON summary */
+  static const char *Name(Phase phase);
+  /** @brief name of a counter as used in the JSON summary */
+  static const char *Name(Counter counter);
+
+  /**
+   * @brief Summary of all timers and counters as a JSON object
+   *
+   * Layout:
+   * ~~~
+   * {"enabled": true,
+   *  "phases": {"eval": {"calls": 9, "seconds": 1.2e-05}, ...},
+   *  "counters": {"entities_visited": 9, ...}}
+   * ~~~
+   */
+  [[nodiscard]] std::string ToJson() const;
+  /** @brief Write the JSON summary to a stream */
+  void WriteJson(std::ostream &o) const;
+
+ private:
+  AssemblyProfiler() = default;
+
+  std::atomic<bool> enabled_{false};
+  std::array<std::atomic<std::uint64_t>, kNumPhases> nanoseconds_{};
+  std::array<std::atomic<std::uint64_t>, kNumPhases> calls_{};
+  std::array<std::atomic<std::uint64_t>, kNumCounters> counters_{};
+};
+
+/**
+ * @brief Adds the lifetime of the object to a phase of the AssemblyProfiler,
+ * if recording is enabled at construction
+ *
+ * Timers nest: while a timer is alive, the enclosing timer of the same thread
+ * is paused. Thus, the automatic compression triggered by
+ * COOMatrix::AddToEntry() counts for the phase `kCompress` only and not also
+ * for the phase `kAddToEntry` of the surrounding assembly loop.
+ */
+class ScopedAssemblyTimer {
+ public:
+  explicit ScopedAssemblyTimer(AssemblyProfiler::Phase phase)
+      : phase_(phase), active_(AssemblyProfiler::Get().Enabled()) {
+    if (active_) {
+      start_ = std::chrono::steady_clock::now();
+      enclosing_ = Innermost();
+      if (enclosing_ != nullptr) {
+        enclosing_->elapsed_ += start_ - enclosing_->start_;
+      }
+      Innermost() = this;
+    }
+  }
+  ScopedAssemblyTimer(const ScopedAssemblyTimer &) = delete;
+  ScopedAssemblyTimer(ScopedAssemblyTimer &&) = delete;
+  ScopedAssemblyTimer &operator=(const ScopedAssemblyTimer &) = delete;
+  ScopedAssemblyTimer &operator=(ScopedAssemblyTimer &&) = delete;
+  ~ScopedAssemblyTimer() {
+    if (active_) {
+      const auto stop = std::chrono::steady_clock::now();
+      AssemblyProfiler::Get().AddTime(phase_, elapsed_ + (stop - start_));
+      Innermost() = enclosing_;
+      if (enclosing_ != nullptr) {
+        enclosing_->start_ = stop;
+      }
+    }
+  }
+
+ private:
+  /** innermost running timer of the current thread */
+  static ScopedAssemblyTimer *&Innermost() {
+    thread_local ScopedAssemblyTimer *innermost = nullptr;
+    return innermost;
+  }
+
+  AssemblyProfiler::Phase phase_;
+  bool active_;
+  std::chrono::steady_clock::time_point start_;
+  /** time accumulated before the timer was last paused */
+  std::chrono::steady_clock::duration elapsed_{0};
+  /** timer paused by this one */
+  ScopedAssemblyTimer *enclosing_{nullptr};
+};
+
+}  // namespace lf::assemble
+
+#ifdef LF_ASSEMBLY_PROFILING
+/**
+ * @brief Time the rest of the enclosing scope as a phase of assembly
+ * @param var name of the local timer object
+ * @param phase enumerator of lf::assemble::AssemblyProfiler::Phase
+ */
+#define LF_ASSEMBLY_TIMER(var, phase)            \
+  const ::lf::assemble::ScopedAssemblyTimer var( \
+      ::lf::assemble::AssemblyProfiler::phase)
+/**
+ * @brief Evaluate an expression, timing it as a phase of assembly
+ * @param phase enumerator of lf::assemble::AssemblyProfiler::Phase
+ * @param expr expression, whose value is passed on unchanged
+ */
+#define LF_ASSEMBLY_TIMED(phase, expr)         \
+  [&]() -> decltype(auto) {                    \
+    LF_ASSEMBLY_TIMER(lf_assembly_tmr, phase); \
+    return expr;                               \
+  }()
+/**
+ * @brief Increment a counter of the lf::assemble::AssemblyProfiler, if
+ * recording is enabled
+ * @param counter enumerator of lf::assemble::AssemblyProfiler::Counter
+ * @param n increment
+ */
+#define LF_ASSEMBLY_COUNT(counter, n)                        \
+  do {                                                       \
+    if (::lf::assemble::AssemblyProfiler::Get().Enabled()) { \
+      ::lf::assemble::AssemblyProfiler::Get().Count(         \
+          ::lf::assemble::AssemblyProfiler::counter, n);     \
+    }                                                        \
+  } while (false)
+#else
+#define LF_ASSEMBLY_TIMER(var, phase)
+#define LF_ASSEMBLY_TIMED(phase, expr) expr
+#define LF_ASSEMBLY_COUNT(counter, n) \
+  do {                                \
+  } while (false)
+#endif
+
+#endif
@@ -0,0 +1,76 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Implementation of BlockDofHandler
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#include "block_dofhandler.h"
+
+namespace lf::assemble {
+
+BlockDofHandler::BlockDofHandler(const DofHandler &scalar_dof_handler,
+                                 size_type num_components,
+                                 BlockDofLayout layout)
+    : scalar_dofh_(&scalar_dof_handler),
+      mesh_p_(scalar_dof_handler.Mesh()),
+      num_comp_(num_components),
+      layout_(layout),
+      num_scalar_dofs_(scalar_dof_handler.NumDofs()) {
+  LF_VERIFY_MSG(num_components > 0, "At least one component required");
+  const lf::mesh::Mesh *mesh = mesh_p_.get();
+  const dim_t dim_mesh = mesh->DimMesh();
+  offsets_.resize(dim_mesh + 1);
+  dofs_.resize(dim_mesh + 1);
+  int_offsets_.resize(dim_mesh + 1);
+  int_dofs_.resize(dim_mesh + 1);
+
+  // Expand the scalar indices of an entity node by node
+  auto expand = [this](nonstd::span<const gdof_idx_t> scalar_dofs,
+                       std::vector<gdof_idx_t> &block_dofs) {
+    for (const gdof_idx_t dof : scalar_dofs) {
+      for (size_type c = 0; c < num_comp_; ++c) {
+        block_dofs.push_back(GlobalIndex(dof, c));
+      }
+    }
+  };
+  for (dim_t codim = 0; codim <= dim_mesh; ++codim) {
+    const size_type num_entities = mesh->NumEntities(codim);
+    offsets_[codim].resize(num_entities + 1);
+    int_offsets_[codim].resize(num_entities + 1);
+    offsets_[codim][0] = 0;
+    int_offsets_[codim][0] = 0;
+    for (glb_idx_t idx = 0; idx < num_entities; ++idx) {
+      const lf::mesh::Entity *entity = mesh->EntityByIndex(codim, idx);
+      expand(scalar_dof_handler.GlobalDofIndices(*entity), dofs_[codim]);
+      expand(scalar_dof_handler.InteriorGlobalDofIndices(*entity),
+             int_dofs_[codim]);
+      offsets_[codim][idx + 1] = dofs_[codim].size();
+      int_offsets_[codim][idx + 1] = int_dofs_[codim].size();
+    }
+  }
+}
+
+nonstd::span<const gdof_idx_t> BlockDofHandler::GlobalDofIndices(
+    const lf::mesh::Entity &entity) const {
+  const dim_t codim = mesh_p_->DimMesh() - entity.RefEl().Dimension();
+  const glb_idx_t idx = mesh_p_->Index(entity);
+  const gdof_idx_t *data = dofs_[codim].data();
+  return {data + offsets_[codim][idx], data + offsets_[codim][idx + 1]};
+}
+
+nonstd::span<const gdof_idx_t> BlockDofHandler::InteriorGlobalDofIndices(
+    const lf::mesh::Entity &entity) const {
+  const dim_t codim = mesh_p_->DimMesh() - entity.RefEl().Dimension();
+  const glb_idx_t idx = mesh_p_->Index(entity);
+  const gdof_idx_t *data = int_dofs_[codim].data();
+  return {data + int_offsets_[codim][idx], data + int_offsets_[codim][idx + 1]};
+}
+
+}  // namespace lf::assemble
@@ -0,0 +1,204 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief D.o.f. handler for vector-valued finite element spaces built from a
+ * scalar one, and component-wise assembly
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#ifndef _LF_ASSEMBLE_BLOCK_DOFHANDLER_H
+#define _LF_ASSEMBLE_BLOCK_DOFHANDLER_H
+
+#include <vector>
+
+#include "dofhandler.h"
+
+namespace lf::assemble {
+
+/**
+ * @brief Numbering of the global d.o.f.s of a vector-valued finite element
+ * space
+ */
+enum class BlockDofLayout {
+  /** all components of a scalar d.o.f. are numbered consecutively:
+      \f$ k \cdot \mathrm{NumComponents} + c \f$ */
+  kInterleaved,
+  /** all d.o.f.s of a component are numbered consecutively:
+      \f$ c \cdot \mathrm{NumScalarDofs} + k \f$ */
+  kBlocked
+};
+
+/**
+ * @brief Local-to-global index map for the Cartesian product of a scalar
+ * finite element space with itself
+ *
+ * A BlockDofHandler attaches `num_components` global shape functions to every
+ * global shape function of a scalar DofHandler, one for every component of a
+ * vector field, e.g., the displacement in linear elasticity, or the
+ * concentrations of several species.
+ *
+ * The global numbering is selected by BlockDofLayout. The interleaved layout
+ * yields Galerkin matrices composed of dense `num_components x
+ * num_components` blocks, which can be stored in a BSRMatrix. The blocked
+ * layout yields a matrix composed of blocks coupling two components, each of
+ * which has the sparsity pattern of the scalar Galerkin matrix.
+ *
+ * Independently of the layout, the local d.o.f.s of an entity are ordered
+ * node by node: local index `l * num_components + c` refers to component `c`
+ * of the local scalar shape function `l`.
+ *
+ * @note The scalar DofHandler must be alive as long as this object is used.
+ */
+class BlockDofHandler : public DofHandler {
+ public:
+  /**
+   * @brief Set up index arrays for all entities of the mesh
+   *
+   * @param scalar_dof_handler d.o.f. handler of the scalar finite element
+   * space
+   * @param num_components number of components, at least 1
+   * @param layout global numbering scheme
+   */
+  BlockDofHandler(const DofHandler &scalar_dof_handler,
+                  size_type num_components,
+                  BlockDofLayout layout = BlockDofLayout::kInterleaved);
+
+  /** @brief the underlying scalar d.o.f. handler */
+  [[nodiscard]] const DofHandler &ScalarDofHandler() const {
+    return *scalar_dofh_;
+  }
+  /** @brief number of components of the vector field */
+  [[nodiscard]] size_type NumComponents() const { return num_comp_; }
+  /** @brief global numbering scheme */
+  [[nodiscard]] BlockDofLayout Layout() const { return layout_; }
+
+  /**
+   * @brief global index of component `comp` belonging to the scalar d.o.f.
+   * `scalar_dof`
+   */
+  [[nodiscard]] gdof_idx_t GlobalIndex(gdof_idx_t scalar_dof,
+                                       size_type comp) const {
+    LF_ASSERT_MSG(comp < num_comp_, "Illegal component " << comp);
+    return (layout_ == BlockDofLayout::kInterleaved)
+               ? scalar_dof * num_comp_ + comp
+               : comp * num_scalar_dofs_ + scalar_dof;
+  }
+  /** @brief scalar d.o.f. belonging to a global d.o.f. */
+  [[nodiscard]] gdof_idx_t ScalarIndex(gdof_idx_t dofnum) const {
+    return (layout_ == BlockDofLayout::kInterleaved)
+               ? dofnum / num_comp_
+               : dofnum % num_scalar_dofs_;
+  }
+  /** @brief component a global d.o.f. belongs to */
+  [[nodiscard]] size_type Component(gdof_idx_t dofnum) const {
+    return static_cast<size_type>((layout_ == BlockDofLayout::kInterleaved)
+                                      ? dofnum % num_comp_
+                                      : dofnum / num_scalar_dofs_);
+  }
+
+  /** @copydoc DofHandler::NumDofs() */
+  [[nodiscard]] size_type NumDofs() const override {
+    return num_comp_ * num_scalar_dofs_;
+  }
+  /** @copydoc DofHandler::NumLocalDofs() */
+  [[nodiscard]] size_type NumLocalDofs(
+      const lf::mesh::Entity &entity) const override {
+    return num_comp_ * scalar_dofh_->NumLocalDofs(entity);
+  }
+  /** @copydoc DofHandler::NumInteriorDofs() */
+  [[nodiscard]] size_type NumInteriorDofs(
+      const lf::mesh::Entity &entity) const override {
+    return num_comp_ * scalar_dofh_->NumInteriorDofs(entity);
+  }
+  /** @copydoc DofHandler::GlobalDofIndices() */
+  [[nodiscard]] nonstd::span<const gdof_idx_t> GlobalDofIndices(
+      const lf::mesh::Entity &entity) const override;
+  /** @copydoc DofHandler::InteriorGlobalDofIndices() */
+  [[nodiscard]] nonstd::span<const gdof_idx_t> InteriorGlobalDofIndices(
+      const lf::mesh::Entity &entity) const override;
+  /** @copydoc DofHandler::Entity() */
+  [[nodiscard]] const lf::mesh::Entity &Entity(
+      gdof_idx_t dofnum) const override {
+    LF_ASSERT_MSG(dofnum < NumDofs(), "Illegal dof index " << dofnum);
+    return scalar_dofh_->Entity(ScalarIndex(dofnum));
+  }
+  /** @copydoc DofHandler::Mesh() */
+  [[nodiscard]] std::shared_ptr<const lf::mesh::Mesh> Mesh() const override {
+    return mesh_p_;
+  }
+
+ private:
+  const DofHandler *scalar_dofh_;                /**< scalar FE space */
+  std::shared_ptr<const lf::mesh::Mesh> mesh_p_; /**< underlying mesh */
+  size_type num_comp_;                           /**< number of components */
+  BlockDofLayout layout_;                        /**< global numbering */
+  size_type num_scalar_dofs_;                    /**< dim. of scalar space */
+  /** for every co-dimension start of the indices of an entity in dofs_ */
+  std::vector<std::vector<size_type>> offsets_;
+  /** global indices of local shape functions, for every co-dimension */
+  std::vector<std::vector<gdof_idx_t>> dofs_;
+  /** same as offsets_ for interior shape functions */
+  std::vector<std::vector<size_type>> int_offsets_;
+  /** same as dofs_ for interior shape functions */
+  std::vector<std::vector<gdof_idx_t>> int_dofs_;
+};
+
+/**
+ * @ingroup assemble_matrix_locally
+ * @brief Assemble a scalar Galerkin matrix into the block of a vector-valued
+ * Galerkin matrix coupling two components
+ *
+ * @tparam TMPMATRIX matrix type offering `AddToEntry()`
+ * @tparam ENTITY_MATRIX_PROVIDER models \ref entity_matrix_provider for the
+ * scalar finite element space
+ * @param codim co-dimension of entities to be visited
+ * @param block_dof_handler d.o.f. handler of the vector-valued space, used
+ * both for trial and test space
+ * @param row_comp component of the test space
+ * @param col_comp component of the trial space
+ * @param entity_matrix_provider provider of scalar element matrices
+ * @param matrix matrix of size `block_dof_handler.NumDofs()`, to which the
+ * block is added
+ *
+ * This replaces the stitching of separately assembled scalar matrices by
+ * means of index offsets: for instance, a system of two reaction-diffusion
+ * equations coupled through their reaction terms is assembled by four calls
+ * with the component pairs (0,0), (0,1), (1,0), (1,1).
+ */
+template <typename TMPMATRIX, class ENTITY_MATRIX_PROVIDER>
+void AssembleComponentBlockLocally(
+    dim_t codim, const BlockDofHandler &block_dof_handler, size_type row_comp,
+    size_type col_comp, ENTITY_MATRIX_PROVIDER &entity_matrix_provider,
+    TMPMATRIX &matrix) {
+  const DofHandler &scalar_dofh{block_dof_handler.ScalarDofHandler()};
+  auto mesh = scalar_dofh.Mesh();
+  for (const lf::mesh::Entity *entity : mesh->Entities(codim)) {
+    if (entity_matrix_provider.isActive(*entity)) {
+      const size_type n_loc = scalar_dofh.NumLocalDofs(*entity);
+      const nonstd::span<const gdof_idx_t> dofs{
+          scalar_dofh.GlobalDofIndices(*entity)};
+      const auto elem_mat{entity_matrix_provider.Eval(*entity)};
+      LF_ASSERT_MSG((elem_mat.rows() >= n_loc) && (elem_mat.cols() >= n_loc),
+                    "size mismatch " << elem_mat.rows() << " x "
+                                     << elem_mat.cols() << " <-> " << n_loc);
+      for (size_type i = 0; i < n_loc; ++i) {
+        const gdof_idx_t row = block_dof_handler.GlobalIndex(dofs[i], row_comp);
+        for (size_type j = 0; j < n_loc; ++j) {
+          matrix.AddToEntry(row,
+                            block_dof_handler.GlobalIndex(dofs[j], col_comp),
+                            elem_mat(i, j));
+        }
+      }
+    }
+  }
+}
+
+}  // namespace lf::assemble
+
+#endif
@@ -0,0 +1,241 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Block compressed sparse row format for Galerkin matrices of
+ * vector-valued problems
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#ifndef _LF_ASSEMBLE_BSR_MATRIX_H
+#define _LF_ASSEMBLE_BSR_MATRIX_H
+
+#include <Eigen/Sparse>
+#include <algorithm>
+#include <vector>
+
+#include "coomatrix.h"
+
+namespace lf::assemble {
+
+/**
+ * @brief Sparse matrix composed of dense square blocks of fixed size, stored
+ * in block compressed sparse row (BSR) format
+ *
+ * @tparam SCALAR scalar type of the matrix
+ * @tparam BLOCK_SIZE size of the blocks, e.g., the number of components of a
+ * vector field
+ *
+ * The Galerkin matrix of a vector-valued problem with a component-interleaved
+ * numbering, see BlockDofHandler and BlockDofLayout::kInterleaved, consists of
+ * dense `BLOCK_SIZE x BLOCK_SIZE` blocks, one for every pair of coupled scalar
+ * d.o.f.s. The BSR format stores a single column index per block instead of
+ * one per entry, and the matrix x vector product works on small dense blocks
+ * of compile-time size.
+ *
+ * Blocks are stored row-major, each one occupying `BLOCK_SIZE*BLOCK_SIZE`
+ * consecutive entries of the value array.
+ */
+template <typename SCALAR, int BLOCK_SIZE>
+class BSRMatrix {
+  static_assert(BLOCK_SIZE > 0, "Block size must be positive");
+
+ public:
+  using Scalar = SCALAR;
+  using StorageIndex = int;
+  /** @brief type of a dense block */
+  using Block = Eigen::Matrix<SCALAR, BLOCK_SIZE, BLOCK_SIZE, Eigen::RowMajor>;
+  /** @brief number of scalar entries of a block */
+  static constexpr int kBlockEntries = BLOCK_SIZE * BLOCK_SIZE;
+
+  /**
+   * @brief Convert a matrix in COO format
+   *
+   * @param mat matrix whose numbers of rows and columns are multiples of
+   * `BLOCK_SIZE`. Triplets for the same entry are summed up.
+   *
+   * Every block containing at least one triplet is stored, missing entries
+   * of a stored block are zero.
+   */
+  explicit BSRMatrix(const COOMatrix<SCALAR> &mat);
+
+  BSRMatrix(const BSRMatrix &) = default;
+  BSRMatrix(BSRMatrix &&) noexcept = default;
+  BSRMatrix &operator=(const BSRMatrix &) = default;
+  BSRMatrix &operator=(BSRMatrix &&) noexcept = default;
+  ~BSRMatrix() = default;
+
+  /** @brief number of rows */
+  [[nodiscard]] Eigen::Index rows() const {
+    return static_cast<Eigen::Index>(block_rows_) * BLOCK_SIZE;
+  }
+  /** @brief number of columns */
+  [[nodiscard]] Eigen::Index cols() const {
+    return static_cast<Eigen::Index>(block_cols_) * BLOCK_SIZE;
+  }
+  /** @brief number of block rows */
+  [[nodiscard]] size_type BlockRows() const { return block_rows_; }
+  /** @brief number of block columns */
+  [[nodiscard]] size_type BlockCols() const { return block_cols_; }
+  /** @brief number of stored blocks */
+  [[nodiscard]] size_type NonZeroBlocks() const {
+    return static_cast<size_type>(inner_.size());
+  }
+
+  /** @brief block row pointers, length BlockRows()+1 */
+  [[nodiscard]] nonstd::span<const StorageIndex> OuterIndices() const {
+    return {outer_.data(), outer_.data() + outer_.size()};
+  }
+  /** @brief block column indices, sorted within each block row */
+  [[nodiscard]] nonstd::span<const StorageIndex> InnerIndices() const {
+    return {inner_.data(), inner_.data() + inner_.size()};
+  }
+  /** @brief read access to the `k`-th stored block */
+  [[nodiscard]] Eigen::Map<const Block> BlockValues(size_type k) const {
+    return Eigen::Map<const Block>(values_.data() + k * kBlockEntries);
+  }
+
+  /**
+   * @brief In-situ computes the product of a (scaled) vector with the matrix
+   *
+   * @param alpha scalar with which to multiply the argument vector
+   * @param vec argument vector of length cols()
+   * @param resvec vector of length rows(), to which the product is added
+   *
+   * Same semantics as COOMatrix::MatVecMult(SCALAR, const VECTOR &,
+   * RESULTVECTOR &).
+   */
+  template <typename VECTOR, typename RESULTVECTOR>
+  void MatVecMult(SCALAR alpha, const VECTOR &vec, RESULTVECTOR &resvec) const;
+
+  /**
+   * @brief Computes the product of a (scaled) vector with the matrix
+   * @return result vector, a dense vector of Eigen
+   */
+  template <typename VECTOR>
+  [[nodiscard]] Eigen::Matrix<SCALAR, Eigen::Dynamic, 1> MatVecMult(
+      SCALAR alpha, const VECTOR &vec) const {
+    Eigen::Matrix<SCALAR, Eigen::Dynamic, 1> result =
+        Eigen::Matrix<SCALAR, Eigen::Dynamic, 1>::Zero(rows());
+    MatVecMult(alpha, vec, result);
+    return result;
+  }
+
+  /** @brief Create an Eigen::SparseMatrix, entries of stored blocks included */
+  [[nodiscard]] Eigen::SparseMatrix<SCALAR> makeSparse() const;
+
+ private:
+  size_type block_rows_;            /**< number of block rows */
+  size_type block_cols_;            /**< number of block columns */
+  std::vector<StorageIndex> outer_; /**< block row pointers */
+  std::vector<StorageIndex> inner_; /**< block column indices */
+  std::vector<SCALAR> values_;      /**< blocks, row-major */
+};
+
+template <typename SCALAR, int BLOCK_SIZE>
+BSRMatrix<SCALAR, BLOCK_SIZE>::BSRMatrix(const COOMatrix<SCALAR> &mat)
+    : block_rows_(static_cast<size_type>(mat.rows() / BLOCK_SIZE)),
+      block_cols_(static_cast<size_type>(mat.cols() / BLOCK_SIZE)) {
+  LF_VERIFY_MSG((mat.rows() % BLOCK_SIZE == 0) && (mat.cols() % BLOCK_SIZE == 0),
+                "Matrix size " << mat.rows() << " x " << mat.cols()
+                               << " is not a multiple of " << BLOCK_SIZE);
+  const auto &triplets = mat.triplets();
+  // Bucket triplets by block row (counting sort)
+  std::vector<std::size_t> row_ptr(block_rows_ + 1, 0);
+  for (const auto &trp : triplets) {
+    row_ptr[trp.row() / BLOCK_SIZE + 1]++;
+  }
+  for (size_type br = 0; br < block_rows_; ++br) {
+    row_ptr[br + 1] += row_ptr[br];
+  }
+  std::vector<std::size_t> by_row(triplets.size());
+  {
+    std::vector<std::size_t> fill(row_ptr.begin(), row_ptr.end() - 1);
+    for (std::size_t k = 0; k < triplets.size(); ++k) {
+      by_row[fill[triplets[k].row() / BLOCK_SIZE]++] = k;
+    }
+  }
+  // Determine block columns of every block row and accumulate values
+  outer_.assign(block_rows_ + 1, 0);
+  std::vector<StorageIndex> row_cols;
+  for (size_type br = 0; br < block_rows_; ++br) {
+    row_cols.clear();
+    for (std::size_t k = row_ptr[br]; k < row_ptr[br + 1]; ++k) {
+      row_cols.push_back(triplets[by_row[k]].col() / BLOCK_SIZE);
+    }
+    std::sort(row_cols.begin(), row_cols.end());
+    row_cols.erase(std::unique(row_cols.begin(), row_cols.end()),
+                   row_cols.end());
+    const std::size_t first_block = inner_.size();
+    inner_.insert(inner_.end(), row_cols.begin(), row_cols.end());
+    values_.resize(inner_.size() * kBlockEntries, SCALAR(0));
+    for (std::size_t k = row_ptr[br]; k < row_ptr[br + 1]; ++k) {
+      const auto &trp = triplets[by_row[k]];
+      const std::size_t pos =
+          std::lower_bound(row_cols.begin(), row_cols.end(),
+                           trp.col() / BLOCK_SIZE) -
+          row_cols.begin();
+      values_[(first_block + pos) * kBlockEntries +
+              (trp.row() % BLOCK_SIZE) * BLOCK_SIZE + trp.col() % BLOCK_SIZE] +=
+          trp.value();
+    }
+    outer_[br + 1] = static_cast<StorageIndex>(inner_.size());
+  }
+}
+
+template <typename SCALAR, int BLOCK_SIZE>
+template <typename VECTOR, typename RESULTVECTOR>
+void BSRMatrix<SCALAR, BLOCK_SIZE>::MatVecMult(SCALAR alpha,
+                                               const VECTOR &vec,
+                                               RESULTVECTOR &resvec) const {
+  using BlockVector = Eigen::Matrix<SCALAR, BLOCK_SIZE, 1>;
+  LF_ASSERT_MSG(vec.size() >= cols(),
+                "Vector vec size mismatch: " << cols() << " <-> " << vec.size());
+  LF_ASSERT_MSG(resvec.size() >= rows(), "Vector result size mismatch: "
+                                             << rows() << " <-> "
+                                             << resvec.size());
+  BlockVector x_blk;
+  for (size_type br = 0; br < block_rows_; ++br) {
+    BlockVector y_blk = BlockVector::Zero();
+    for (StorageIndex k = outer_[br]; k < outer_[br + 1]; ++k) {
+      const Eigen::Index col0 = static_cast<Eigen::Index>(inner_[k]) * BLOCK_SIZE;
+      for (int j = 0; j < BLOCK_SIZE; ++j) {
+        x_blk[j] = vec[col0 + j];
+      }
+      y_blk.noalias() += BlockValues(k) * x_blk;
+    }
+    const Eigen::Index row0 = static_cast<Eigen::Index>(br) * BLOCK_SIZE;
+    for (int i = 0; i < BLOCK_SIZE; ++i) {
+      resvec[row0 + i] += alpha * y_blk[i];
+    }
+  }
+}
+
+template <typename SCALAR, int BLOCK_SIZE>
+Eigen::SparseMatrix<SCALAR> BSRMatrix<SCALAR, BLOCK_SIZE>::makeSparse() const {
+  std::vector<Eigen::Triplet<SCALAR>> triplets;
+  triplets.reserve(values_.size());
+  for (size_type br = 0; br < block_rows_; ++br) {
+    for (StorageIndex k = outer_[br]; k < outer_[br + 1]; ++k) {
+      const auto blk = BlockValues(k);
+      for (int i = 0; i < BLOCK_SIZE; ++i) {
+        for (int j = 0; j < BLOCK_SIZE; ++j) {
+          triplets.emplace_back(br * BLOCK_SIZE + i,
+                                inner_[k] * BLOCK_SIZE + j, blk(i, j));
+        }
+      }
+    }
+  }
+  Eigen::SparseMatrix<SCALAR> result(rows(), cols());
+  result.setFromTriplets(triplets.begin(), triplets.end());
+  return result;
+}
+
+}  // namespace lf::assemble
+
+#endif
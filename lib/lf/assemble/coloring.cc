@@ -0,0 +1,87 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Greedy conflict-free coloring of mesh entities
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#include "coloring.h"
+
+namespace lf::assemble {
+
+CellColoring::CellColoring(const DofHandler &dof_handler, dim_t codim)
+    : mesh_p_(dof_handler.Mesh()), dofh_(&dof_handler), codim_(codim) {
+  const size_type num_entities = mesh_p_->NumEntities(codim);
+  const size_type num_dofs = dof_handler.NumDofs();
+
+  // Step I: inverse incidence relation dof -> entities in CSR format
+  std::vector<size_type> dof_offsets(num_dofs + 1, 0);
+  for (glb_idx_t idx = 0; idx < num_entities; ++idx) {
+    const lf::mesh::Entity *entity = mesh_p_->EntityByIndex(codim, idx);
+    for (const gdof_idx_t dof : dof_handler.GlobalDofIndices(*entity)) {
+      dof_offsets[dof + 1]++;
+    }
+  }
+  for (size_type k = 0; k < num_dofs; ++k) {
+    dof_offsets[k + 1] += dof_offsets[k];
+  }
+  std::vector<glb_idx_t> dof_entities(dof_offsets[num_dofs]);
+  {
+    std::vector<size_type> fill(dof_offsets.begin(), dof_offsets.end() - 1);
+    for (glb_idx_t idx = 0; idx < num_entities; ++idx) {
+      const lf::mesh::Entity *entity = mesh_p_->EntityByIndex(codim, idx);
+      for (const gdof_idx_t dof : dof_handler.GlobalDofIndices(*entity)) {
+        dof_entities[fill[dof]++] = idx;
+      }
+    }
+  }
+
+  // Step II: greedy coloring in the order of entity indices
+  const size_type kUncolored = lf::base::kIdxNil;
+  colors_.assign(num_entities, kUncolored);
+  // used_by[c] == idx means that color c is taken by a neighbor of entity idx
+  std::vector<glb_idx_t> used_by;
+  size_type num_colors = 0;
+  for (glb_idx_t idx = 0; idx < num_entities; ++idx) {
+    const lf::mesh::Entity *entity = mesh_p_->EntityByIndex(codim, idx);
+    for (const gdof_idx_t dof : dof_handler.GlobalDofIndices(*entity)) {
+      for (size_type k = dof_offsets[dof]; k < dof_offsets[dof + 1]; ++k) {
+        const size_type nb_color = colors_[dof_entities[k]];
+        if (nb_color != kUncolored) {
+          used_by[nb_color] = idx;
+        }
+      }
+    }
+    size_type color = 0;
+    while ((color < num_colors) && (used_by[color] == idx)) {
+      ++color;
+    }
+    if (color == num_colors) {
+      used_by.push_back(kUncolored);
+      ++num_colors;
+    }
+    colors_[idx] = color;
+  }
+
+  // Step III: group entities by color; counting sort keeps them sorted
+  color_offsets_.assign(num_colors + 1, 0);
+  for (const size_type c : colors_) {
+    color_offsets_[c + 1]++;
+  }
+  for (size_type c = 0; c < num_colors; ++c) {
+    color_offsets_[c + 1] += color_offsets_[c];
+  }
+  entities_by_color_.resize(num_entities);
+  std::vector<size_type> fill(color_offsets_.begin(), color_offsets_.end() - 1);
+  for (glb_idx_t idx = 0; idx < num_entities; ++idx) {
+    entities_by_color_[fill[colors_[idx]]++] = idx;
+  }
+}
+
+}  // namespace lf::assemble
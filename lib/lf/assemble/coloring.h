@@ -0,0 +1,291 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Conflict-free coloring of mesh entities and colored parallel
+ * assembly directly into compressed sparse matrices
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#ifndef _LF_ASSEMBLE_COLORING_H
+#define _LF_ASSEMBLE_COLORING_H
+
+#include <Eigen/Sparse>
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include "assembler.h"
+
+namespace lf::assemble {
+
+/**
+ * @brief Partition of the entities of one co-dimension into _colors_ such
+ * that no two entities of the same color share a global degree of freedom.
+ *
+ * The coloring is computed from the local-to-global index map provided by a
+ * DofHandler: two entities are in conflict, if their `GlobalDofIndices()`
+ * overlap. Since contributions of an entity to a Galerkin matrix only touch
+ * the rows belonging to its test-space d.o.f.s, all entities of the same color
+ * can be assembled concurrently without any synchronization, see
+ * ColoredAssembleMatrixLocally().
+ *
+ * The coloring is computed by a greedy algorithm that visits entities in the
+ * order of their indices and assigns the smallest color not used by any
+ * conflicting entity visited before. The result is deterministic.
+ *
+ * Computing a coloring costs about as much as one assembly of the Galerkin
+ * matrix. In order to amortize this cost, e.g., for time stepping or Newton
+ * iterations, a CellColoring object should be created once for a pair of mesh
+ * and DofHandler and be passed to every subsequent colored assembly.
+ * The object keeps a pointer to the mesh and remembers the DofHandler it was
+ * built from; using it with another DofHandler triggers an assertion.
+ */
+class CellColoring {
+ public:
+  /**
+   * @brief Compute coloring of entities of a given co-dimension
+   *
+   * @param dof_handler the DofHandler (for the test space) whose global
+   * d.o.f. indices define conflicts between entities. The object must stay
+   * alive as long as the CellColoring object is used.
+   * @param codim co-dimension of the entities to be colored
+   */
+  explicit CellColoring(const DofHandler &dof_handler, dim_t codim = 0);
+
+  CellColoring(const CellColoring &) = default;
+  CellColoring(CellColoring &&) noexcept = default;
+  CellColoring &operator=(const CellColoring &) = default;
+  CellColoring &operator=(CellColoring &&) noexcept = default;
+  ~CellColoring() = default;
+
+  /** @brief number of colors used */
+  [[nodiscard]] size_type NumColors() const {
+    return static_cast<size_type>(color_offsets_.size() - 1);
+  }
+
+  /** @brief color of an entity identified through its index */
+  [[nodiscard]] size_type Color(glb_idx_t entity_index) const {
+    LF_ASSERT_MSG(entity_index < colors_.size(),
+                  "Index " << entity_index << " out of range");
+    return colors_[entity_index];
+  }
+
+  /**
+   * @brief Indices of all entities of a given color, sorted in ascending
+   * order
+   */
+  [[nodiscard]] nonstd::span<const glb_idx_t> EntitiesOfColor(
+      size_type color) const {
+    LF_ASSERT_MSG(color < NumColors(), "Illegal color " << color);
+    return {entities_by_color_.data() + color_offsets_[color],
+            entities_by_color_.data() + color_offsets_[color + 1]};
+  }
+
+  /** @brief co-dimension of colored entities */
+  [[nodiscard]] dim_t Codim() const { return codim_; }
+
+  /** @brief underlying mesh */
+  [[nodiscard]] std::shared_ptr<const lf::mesh::Mesh> Mesh() const {
+    return mesh_p_;
+  }
+
+  /** @brief Check whether this coloring was built from the given DofHandler */
+  [[nodiscard]] bool BuiltFrom(const DofHandler &dof_handler) const {
+    return (&dof_handler == dofh_) && (dof_handler.Mesh() == mesh_p_);
+  }
+
+ private:
+  std::shared_ptr<const lf::mesh::Mesh> mesh_p_; /**< underlying mesh */
+  const DofHandler *dofh_;                       /**< used for checks only */
+  dim_t codim_;                                  /**< co-dimension */
+  std::vector<size_type> colors_; /**< color of every entity */
+  /** entity indices grouped by color (CSR format) */
+  std::vector<glb_idx_t> entities_by_color_;
+  std::vector<size_type> color_offsets_;
+};
+
+/**
+ * @brief Locate an existing entry in a compressed Eigen sparse matrix
+ *
+ * @return pointer to the value of entry `(i,j)` or `nullptr`, if the entry is
+ * not part of the sparsity pattern.
+ *
+ * In contrast to `Eigen::SparseMatrix::coeffRef()` this function never
+ * inserts an entry and, therefore, may be called concurrently.
+ */
+template <typename SCALAR, int OPTIONS, typename STORAGE_INDEX>
+SCALAR *FindSparseEntry(
+    Eigen::SparseMatrix<SCALAR, OPTIONS, STORAGE_INDEX> &matrix, gdof_idx_t i,
+    gdof_idx_t j) {
+  constexpr bool kRowMajor = (OPTIONS & Eigen::RowMajorBit) != 0;
+  const gdof_idx_t outer = kRowMajor ? i : j;
+  const auto inner = static_cast<STORAGE_INDEX>(kRowMajor ? j : i);
+  const STORAGE_INDEX *inner_idx = matrix.innerIndexPtr();
+  const STORAGE_INDEX *begin = inner_idx + matrix.outerIndexPtr()[outer];
+  const STORAGE_INDEX *end = inner_idx + matrix.outerIndexPtr()[outer + 1];
+  const STORAGE_INDEX *pos = std::lower_bound(begin, end, inner);
+  if ((pos == end) || (*pos != inner)) {
+    return nullptr;
+  }
+  return matrix.valuePtr() + (pos - inner_idx);
+}
+
+/**
+ * @brief Set up the sparsity pattern of a Galerkin matrix with all values zero
+ *
+ * @param codim co-dimension of entities that contribute to the matrix
+ * @param dof_handler_trial dof handler for the _column space_
+ * @param dof_handler_test dof handler for the _row space_
+ * @param matrix compressed sparse matrix, overwritten
+ *
+ * The pattern contains entry `(i,j)` if and only if there is an entity of
+ * co-dimension `codim` to which both test d.o.f. `i` and trial d.o.f. `j`
+ * belong.
+ */
+template <typename SCALAR, int OPTIONS, typename STORAGE_INDEX>
+void InitSparsityPattern(
+    dim_t codim, const DofHandler &dof_handler_trial,
+    const DofHandler &dof_handler_test,
+    Eigen::SparseMatrix<SCALAR, OPTIONS, STORAGE_INDEX> &matrix) {
+  constexpr bool kRowMajor = (OPTIONS & Eigen::RowMajorBit) != 0;
+  auto mesh = dof_handler_trial.Mesh();
+  LF_ASSERT_MSG(mesh == dof_handler_test.Mesh(),
+                "Trial and test space must be defined on the same mesh");
+  const size_type num_outer =
+      kRowMajor ? dof_handler_test.NumDofs() : dof_handler_trial.NumDofs();
+  // Collect inner indices for every outer index
+  std::vector<std::vector<STORAGE_INDEX>> inner(num_outer);
+  for (const lf::mesh::Entity *entity : mesh->Entities(codim)) {
+    nonstd::span<const gdof_idx_t> row_idx(
+        dof_handler_test.GlobalDofIndices(*entity));
+    nonstd::span<const gdof_idx_t> col_idx(
+        dof_handler_trial.GlobalDofIndices(*entity));
+    const nonstd::span<const gdof_idx_t> &outer_idx =
+        kRowMajor ? row_idx : col_idx;
+    const nonstd::span<const gdof_idx_t> &inner_idx =
+        kRowMajor ? col_idx : row_idx;
+    for (const gdof_idx_t o : outer_idx) {
+      for (const gdof_idx_t in : inner_idx) {
+        inner[o].push_back(static_cast<STORAGE_INDEX>(in));
+      }
+    }
+  }
+  Eigen::Matrix<STORAGE_INDEX, Eigen::Dynamic, 1> nnz_per_outer(num_outer);
+  for (size_type o = 0; o < num_outer; ++o) {
+    std::sort(inner[o].begin(), inner[o].end());
+    inner[o].erase(std::unique(inner[o].begin(), inner[o].end()),
+                   inner[o].end());
+    nnz_per_outer[o] = static_cast<STORAGE_INDEX>(inner[o].size());
+  }
+  matrix.resize(dof_handler_test.NumDofs(), dof_handler_trial.NumDofs());
+  matrix.reserve(nnz_per_outer);
+  for (size_type o = 0; o < num_outer; ++o) {
+    for (const STORAGE_INDEX in : inner[o]) {
+      matrix.insert(kRowMajor ? o : in, kRowMajor ? in : o) = SCALAR(0);
+    }
+    // Release memory early
+    std::vector<STORAGE_INDEX>().swap(inner[o]);
+  }
+  matrix.makeCompressed();
+}
+
+/**
+ * @ingroup assemble_matrix_locally
+ * @brief Colored multithreaded assembly directly into a compressed sparse
+ * matrix with fixed sparsity pattern
+ *
+ * @tparam ENTITY_MATRIX_PROVIDER a _copy-constructible_ type modelling the
+ * concept \ref entity_matrix_provider
+ * @param coloring coloring of entities built from `dof_handler_test`
+ * @param dof_handler_trial a dof handler object for _column space_
+ * @param dof_handler_test a dof handler object for _row space_
+ * @param entity_matrix_provider prototype @ref entity_matrix_provider object
+ * @param matrix compressed Eigen sparse matrix whose sparsity pattern
+ * comprises all entries that receive contributions, see
+ * InitSparsityPattern(). Contributions are added to existing values.
+ * @param num_threads number of worker threads, `0` means "as many as there
+ * are hardware threads".
+ *
+ * The colors are processed one after another. The entities of one color are
+ * split into chunks that are processed concurrently, each worker using its own
+ * copy of `entity_matrix_provider`. Since no two entities of the same color
+ * share a row, workers never write to the same matrix entry: neither atomics
+ * nor triplet buffers are needed.
+ *
+ * The same thread-safety contract as for ParallelAssembleMatrixLocally()
+ * applies to the entity matrix provider.
+ *
+ * @note Summation order differs from serial assembly, which means that
+ * results may differ in the last bits.
+ * @note An entry missing from the sparsity pattern of `matrix` is a fatal
+ * error.
+ */
+template <class ENTITY_MATRIX_PROVIDER, typename SCALAR, int OPTIONS,
+          typename STORAGE_INDEX>
+void ColoredAssembleMatrixLocally(
+    const CellColoring &coloring, const DofHandler &dof_handler_trial,
+    const DofHandler &dof_handler_test,
+    const ENTITY_MATRIX_PROVIDER &entity_matrix_provider,
+    Eigen::SparseMatrix<SCALAR, OPTIONS, STORAGE_INDEX> &matrix,
+    unsigned int num_threads = 0) {
+  static_assert(std::is_copy_constructible_v<ENTITY_MATRIX_PROVIDER>,
+                "ColoredAssembleMatrixLocally() needs one copy of the entity "
+                "matrix provider per thread");
+  LF_VERIFY_MSG(coloring.BuiltFrom(dof_handler_test),
+                "Coloring was not built from the test space DofHandler");
+  LF_VERIFY_MSG(matrix.isCompressed(), "Matrix must be in compressed format");
+  LF_VERIFY_MSG((matrix.rows() == dof_handler_test.NumDofs()) &&
+                    (matrix.cols() == dof_handler_trial.NumDofs()),
+                "Matrix size mismatch");
+  auto mesh = coloring.Mesh();
+  const dim_t codim = coloring.Codim();
+  num_threads = lf::base::NumWorkerThreads(num_threads);
+  // One provider per worker thread, reused for all colors
+  std::vector<ENTITY_MATRIX_PROVIDER> providers(num_threads,
+                                                entity_matrix_provider);
+  for (size_type color = 0; color < coloring.NumColors(); ++color) {
+    const nonstd::span<const glb_idx_t> entity_indices{
+        coloring.EntitiesOfColor(color)};
+    lf::base::ParallelForChunks(
+        entity_indices.size(), num_threads,
+        [&](unsigned int chunk, size_type begin, size_type end) {
+          ENTITY_MATRIX_PROVIDER &provider{providers[chunk]};
+          for (size_type k = begin; k < end; ++k) {
+            const lf::mesh::Entity &entity{
+                *mesh->EntityByIndex(codim, entity_indices[k])};
+            if (!provider.isActive(entity)) {
+              continue;
+            }
+            const size_type nrows_loc = dof_handler_test.NumLocalDofs(entity);
+            const size_type ncols_loc = dof_handler_trial.NumLocalDofs(entity);
+            nonstd::span<const gdof_idx_t> row_idx(
+                dof_handler_test.GlobalDofIndices(entity));
+            nonstd::span<const gdof_idx_t> col_idx(
+                dof_handler_trial.GlobalDofIndices(entity));
+            const auto elem_mat{provider.Eval(entity)};
+            LF_ASSERT_MSG((elem_mat.rows() >= nrows_loc) &&
+                              (elem_mat.cols() >= ncols_loc),
+                          "Element matrix too small");
+            for (size_type i = 0; i < nrows_loc; i++) {
+              for (size_type j = 0; j < ncols_loc; j++) {
+                SCALAR *entry = FindSparseEntry(matrix, row_idx[i], col_idx[j]);
+                LF_VERIFY_MSG(entry != nullptr,
+                              "Entry (" << row_idx[i] << ',' << col_idx[j]
+                                        << ") missing in sparsity pattern");
+                *entry += elem_mat(i, j);
+              }
+            }
+          }
+        });
+  }
+}
+
+}  // namespace lf::assemble
+
+#endif
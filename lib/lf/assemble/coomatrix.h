@@ -15,6 +15,11 @@
  */
 
 #include <Eigen/Sparse>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include "assembly_profiler.h"
 #include "assembly_types.h"
 
 namespace lf::assemble {
@@ -45,6 +50,18 @@ namespace lf::assemble {
  * #### sample usage:
  * @snippet coomatrix.cpp usage
  *
+ * #### Compression
+ *
+ * Local assembly adds a separate triplet for every contribution to a matrix
+ * entry, so that the number of triplets may exceed the number of non-zero
+ * entries by an order of magnitude. Compress() sorts the triplets and sums
+ * duplicates in place. Through SetCompressionThreshold() this can also be done
+ * automatically, which bounds the memory footprint of the triplet vector
+ * during assembly. After compression more triplets can be added by
+ * AddToEntry() as usual, and makeSparse() avoids the sorting step of
+ * `Eigen::SparseMatrix::setFromTriplets()` as long as no entry has been added
+ * since the last compression.
+ *
  */
 template <typename SCALAR>
 class COOMatrix {
@@ -85,15 +102,97 @@ class COOMatrix {
   void AddToEntry(gdof_idx_t i, gdof_idx_t j, SCALAR increment) {
     rows_ = (i + 1 > rows_) ? i + 1 : rows_;
     cols_ = (j + 1 > cols_) ? j + 1 : cols_;
+    if (triplets_.size() == triplets_.capacity()) {
+      LF_ASSEMBLY_COUNT(kTripletReallocations, 1);
+    }
     triplets_.push_back(Eigen::Triplet<SCALAR>(i, j, increment));
+    if ((compression_threshold_ > 0) &&
+        (triplets_.size() >= next_compression_)) {
+      SortAndSumDuplicates(0);
+      next_compression_ =
+          triplets_.size() + std::max(compression_threshold_, triplets_.size());
+    }
+  }
+
+  /**
+   * @brief Reserve memory for a given total number of triplets
+   *
+   * Avoids repeated reallocation of the triplet vector during assembly, see
+   * ReserveTriplets() for determining the number of triplets produced by
+   * AssembleMatrixLocally().
+   */
+  void reserve(std::size_t num_triplets) { triplets_.reserve(num_triplets); }
+  /** @brief Number of triplets that can be stored without reallocation */
+  [[nodiscard]] std::size_t capacity() const { return triplets_.capacity(); }
+
+  /**
+   * @brief Memory in bytes occupied by the triplets of a COO matrix
+   * @param num_triplets number of triplets
+   */
+  [[nodiscard]] static constexpr std::size_t MemoryEstimate(
+      std::size_t num_triplets) {
+    return num_triplets * sizeof(Triplet);
+  }
+
+  /**
+   * @brief Sort triplets and sum up triplets belonging to the same entry
+   *
+   * @param num_threads number of threads used for sorting, `0` selects
+   * lf::base::NumWorkerThreads(). Small matrices are always sorted by the
+   * calling thread only.
+   *
+   * Afterwards every matrix entry is represented by at most one triplet and
+   * the triplets are ordered by column and, within a column, by row, which is
+   * the storage order of `Eigen::SparseMatrix<SCALAR>`. Unused capacity of the
+   * triplet vector is released.
+   *
+   * Only the triplets added since the last compression are sorted, using a
+   * least-significant-digit radix sort, and then merged with the previously
+   * compressed ones. Triplets with value zero are kept.
+   */
+  void Compress(unsigned int num_threads = 0) {
+    SortAndSumDuplicates(num_threads);
+    triplets_.shrink_to_fit();
+  }
+
+  /**
+   * @brief Tells whether every entry is represented by at most one triplet
+   * and triplets are sorted as described for Compress()
+   */
+  [[nodiscard]] bool IsCompressed() const {
+    CheckCompressedPart();
+    return num_compressed_ == triplets_.size();
+  }
+
+  /**
+   * @brief Enable automatic compression during AddToEntry()
+   *
+   * @param threshold compression is triggered as soon as the number of
+   * triplets added since the last compression reaches the larger of
+   * `threshold` and the number of triplets after the last compression. `0`
+   * (the default) disables automatic compression.
+   *
+   * The growth condition ensures that the total cost of automatic compression
+   * stays proportional to the number of calls of AddToEntry(). Capacity of the
+   * triplet vector is retained for further additions.
+   */
+  void SetCompressionThreshold(std::size_t threshold) {
+    compression_threshold_ = threshold;
+    next_compression_ = triplets_.size() + threshold;
   }
+
   /**
    * @brief Erase all entries of the matrix
    *
    * This method clears the vector of triplets, effectively setting the
    * matrix to zero. It does not affect the size information about the matrix.
    */
-  void setZero() { triplets_.clear(); }
+  void setZero() {
+    triplets_.clear();
+    num_compressed_ = 0;
+    triplets_exposed_ = false;
+    next_compression_ = compression_threshold_;
+  }
   /**
    * @brief Erase specific entries of the COO matrix, that is, set them to zero
    * @tparam PREDICATE a predicate type compliant with
@@ -105,9 +204,17 @@ class COOMatrix {
    */
   template <typename PREDICATE>
   void setZero(PREDICATE &&pred) {
-    auto new_last = std::remove_if(
-        triplets_.begin(), triplets_.end(),
-        [pred](Triplet &trp) { return (pred(trp.row(), trp.col())); });
+    auto selector = [pred](Triplet &trp) {
+      return (pred(trp.row(), trp.col()));
+    };
+    // Filter compressed and uncompressed parts separately; std::remove_if()
+    // preserves the relative order, so the compressed part stays sorted
+    CheckCompressedPart();
+    const auto tail = triplets_.begin() + num_compressed_;
+    const auto new_tail = std::remove_if(triplets_.begin(), tail, selector);
+    const auto new_last = std::move(
+        tail, std::remove_if(tail, triplets_.end(), selector), new_tail);
+    num_compressed_ = new_tail - triplets_.begin();
     // Adjust size of triplet vector
     triplets_.erase(new_last, triplets_.end());
   }
@@ -118,8 +225,17 @@ class COOMatrix {
    *
    * Use of this method is deprecated. Use setZero(pred) and AddToEntry()
    * instead.
+   *
+   * @note Since the triplets may be modified through the returned reference,
+   * the sorted leading part of the triplet vector left by the last
+   * compression is checked again when it is needed next, see IsCompressed().
+   * Merely reading the triplets does not discard it.
    */
-  [[nodiscard]] TripletVec &triplets() { return triplets_; }
+  [[nodiscard]] TripletVec &triplets() {
+    triplets_exposed_ = true;
+    return triplets_;
+  }
+  /** @brief Read-only access to the vector of triplets */
   [[nodiscard]] const TripletVec &triplets() const { return triplets_; }
 
   /**
@@ -166,14 +282,34 @@ class COOMatrix {
    *
    * @note This method can be called multiple times and it does not modify the
    * data stored in this COOMatrix.
+   *
+   * If the matrix is compressed, see IsCompressed(), the triplets are copied
+   * directly into the arrays of the sparse matrix.
    */
   [[nodiscard]] Eigen::SparseMatrix<Scalar> makeSparse() const {
+    LF_ASSEMBLY_TIMER(make_sparse_timer, kMakeSparse);
     Eigen::SparseMatrix<Scalar> result;
     LF_VERIFY_MSG(
         rows_ > 0 && cols_ > 0,
         "matrix has zero rows or columns, this is probably an error.");
     result.resize(rows_, cols_);
-    result.setFromTriplets(triplets_.cbegin(), triplets_.cend());
+    if (IsCompressed()) {
+      const auto nnz = static_cast<Eigen::Index>(triplets_.size());
+      result.resizeNonZeros(nnz);
+      auto *outer = result.outerIndexPtr();
+      auto *inner = result.innerIndexPtr();
+      Scalar *values = result.valuePtr();
+      std::fill(outer, outer + cols_ + 1, 0);
+      for (Eigen::Index k = 0; k < nnz; ++k) {
+        const Triplet &trp = triplets_[k];
+        outer[trp.col() + 1]++;
+        inner[k] = trp.row();
+        values[k] = trp.value();
+      }
+      std::partial_sum(outer, outer + cols_ + 1, outer);
+    } else {
+      result.setFromTriplets(triplets_.cbegin(), triplets_.cend());
+    }
     return result;
   }
   /**
@@ -217,8 +353,24 @@ class COOMatrix {
                                   const COOMatrix<SCALARTYPE> &mat);
 
  private:
+  /** compression without releasing capacity */
+  void SortAndSumDuplicates(unsigned int num_threads);
+  /** shrink num_compressed_ to the leading part of triplets_ which is still
+   * sorted and duplicate-free after triplets() handed out a reference */
+  void CheckCompressedPart() const;
+  /** stable radix sort of triplets by column, then row */
+  void RadixSort(Triplet *first, std::size_t n, unsigned int num_threads) const;
+
   size_type rows_, cols_; /**< dimensions of matrix */
   TripletVec triplets_;   /**< COO format data */
+  /** length of the sorted, duplicate-free leading part of triplets_ */
+  mutable std::size_t num_compressed_{0};
+  /** triplets() was called since num_compressed_ was last confirmed */
+  mutable bool triplets_exposed_{false};
+  /** setting for automatic compression, 0 = disabled */
+  std::size_t compression_threshold_{0};
+  /** size of triplets_ triggering the next automatic compression */
+  std::size_t next_compression_{0};
 };
 
 // Implementation of output operator
@@ -228,6 +380,130 @@ std::ostream &operator<<(std::ostream &o, const COOMatrix<SCALARTYPE> &mat) {
   return o;
 }
 
+template <typename SCALAR>
+void COOMatrix<SCALAR>::CheckCompressedPart() const {
+  if (!triplets_exposed_) {
+    return;
+  }
+  const std::size_t n = std::min(num_compressed_, triplets_.size());
+  std::size_t k = (n > 0) ? 1 : 0;
+  for (; k < n; ++k) {
+    const Triplet &prev = triplets_[k - 1];
+    const Triplet &trp = triplets_[k];
+    if ((prev.col() > trp.col()) ||
+        ((prev.col() == trp.col()) && (prev.row() >= trp.row()))) {
+      break;
+    }
+  }
+  num_compressed_ = k;
+  triplets_exposed_ = false;
+}
+
+template <typename SCALAR>
+void COOMatrix<SCALAR>::SortAndSumDuplicates(unsigned int num_threads) {
+  if (IsCompressed()) {
+    return;
+  }
+  LF_ASSEMBLY_TIMER(compress_timer, kCompress);
+  // Sort the new triplets and merge them with the compressed ones
+  const auto mid = triplets_.begin() + num_compressed_;
+  RadixSort(&*mid, triplets_.end() - mid, num_threads);
+  std::inplace_merge(triplets_.begin(), mid, triplets_.end(),
+                     [](const Triplet &a, const Triplet &b) {
+                       return (a.col() < b.col()) ||
+                              ((a.col() == b.col()) && (a.row() < b.row()));
+                     });
+  // Sum up consecutive triplets for the same entry
+  std::size_t last = 0;
+  for (std::size_t k = 1; k < triplets_.size(); ++k) {
+    const Triplet &trp = triplets_[k];
+    const Triplet &prev = triplets_[last];
+    if ((trp.row() == prev.row()) && (trp.col() == prev.col())) {
+      triplets_[last] =
+          Triplet(prev.row(), prev.col(), prev.value() + trp.value());
+    } else {
+      triplets_[++last] = trp;
+    }
+  }
+  triplets_.resize(last + 1);
+  num_compressed_ = triplets_.size();
+}
+
+template <typename SCALAR>
+void COOMatrix<SCALAR>::RadixSort(Triplet *first, std::size_t n,
+                                  unsigned int num_threads) const {
+  if (n < 2) {
+    return;
+  }
+  // Sort keys col*rows+row with 11 bits per pass. Every pass is split into a
+  // concurrent histogram and a concurrent scatter phase over the same chunks.
+  // Each chunk writes to positions reserved for it in every bucket, which
+  // keeps the sort stable.
+  constexpr unsigned int kRadixBits = 11;
+  constexpr std::size_t kNumBuckets = std::size_t(1) << kRadixBits;
+  constexpr std::size_t kMinParallelSize = 1 << 16;
+  const std::uint64_t num_rows = rows_;
+  auto key = [num_rows](const Triplet &trp) -> std::uint64_t {
+    return static_cast<std::uint64_t>(trp.col()) * num_rows +
+           static_cast<std::uint64_t>(trp.row());
+  };
+  const std::uint64_t max_key = static_cast<std::uint64_t>(cols_) * num_rows;
+  unsigned int num_bits = 0;
+  while ((num_bits < 64) && ((max_key >> num_bits) != 0)) {
+    ++num_bits;
+  }
+
+  LF_ASSERT_MSG(n <= std::numeric_limits<size_type>::max(),
+                "Too many triplets for radix sort: " << n);
+  const auto len = static_cast<size_type>(n);
+  unsigned int num_chunks =
+      (n < kMinParallelSize) ? 1 : lf::base::NumWorkerThreads(num_threads);
+  num_chunks = std::max(1U, std::min<unsigned int>(num_chunks, len));
+  std::vector<std::size_t> offsets(num_chunks * kNumBuckets);
+  TripletVec buffer(n);
+  Triplet *src = first;
+  Triplet *dst = buffer.data();
+  for (unsigned int shift = 0; shift < num_bits; shift += kRadixBits) {
+    const std::uint64_t mask = kNumBuckets - 1;
+    std::fill(offsets.begin(), offsets.end(), 0);
+    lf::base::ParallelForChunks(
+        len, num_chunks, [&](unsigned int c, size_type begin, size_type end) {
+          std::size_t *count = &offsets[c * kNumBuckets];
+          for (size_type k = begin; k < end; ++k) {
+            count[(key(src[k]) >> shift) & mask]++;
+          }
+        });
+    // Exclusive prefix sum in (bucket, chunk) order
+    std::size_t pos = 0;
+    bool single_bucket = false;
+    for (std::size_t b = 0; b < kNumBuckets; ++b) {
+      std::size_t bucket_size = 0;
+      for (unsigned int c = 0; c < num_chunks; ++c) {
+        const std::size_t cnt = offsets[c * kNumBuckets + b];
+        offsets[c * kNumBuckets + b] = pos;
+        pos += cnt;
+        bucket_size += cnt;
+      }
+      single_bucket = single_bucket || (bucket_size == n);
+    }
+    if (single_bucket) {
+      // all keys share this digit: the pass would not change the order
+      continue;
+    }
+    lf::base::ParallelForChunks(
+        len, num_chunks, [&](unsigned int c, size_type begin, size_type end) {
+          std::size_t *next = &offsets[c * kNumBuckets];
+          for (size_type k = begin; k < end; ++k) {
+            dst[next[(key(src[k]) >> shift) & mask]++] = src[k];
+          }
+        });
+    std::swap(src, dst);
+  }
+  if (src != first) {
+    std::copy(src, src + n, first);
+  }
+}
+
 template <typename SCALAR>
 template <typename VECTOR>
 Eigen::Matrix<SCALAR, Eigen::Dynamic, 1> COOMatrix<SCALAR>::MatVecMult(
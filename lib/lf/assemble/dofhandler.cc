@@ -14,6 +14,11 @@
 
 #include "dofhandler.h"
 
+#include <lf/mesh/utils/space_filling_curve.h>
+
+#include <algorithm>
+#include <numeric>
+
 namespace lf::assemble {
 
 // Default output flag
@@ -78,8 +83,28 @@ std::ostream &operator<<(std::ostream &o, const DofHandler &dof_handler) {
 // Implementation UniformFEDofHandler
 // ----------------------------------------------------------------------
 
+std::ostream &operator<<(std::ostream &o, DofRenumbering renumbering) {
+  switch (renumbering) {
+    case DofRenumbering::kNone:
+      return o << "none";
+    case DofRenumbering::kReverseCuthillMcKee:
+      return o << "reverse Cuthill-McKee";
+    case DofRenumbering::kHilbert:
+      return o << "Hilbert curve";
+    case DofRenumbering::kMorton:
+      return o << "Morton curve";
+  }
+  return o;
+}
+
 UniformFEDofHandler::UniformFEDofHandler(
     std::shared_ptr<const lf::mesh::Mesh> mesh, dof_map_t dofmap)
+    : UniformFEDofHandler(std::move(mesh), std::move(dofmap),
+                          DofRenumbering::kNone) {}
+
+UniformFEDofHandler::UniformFEDofHandler(
+    std::shared_ptr<const lf::mesh::Mesh> mesh, dof_map_t dofmap,
+    DofRenumbering renumbering, bool cell_interior_last)
     : mesh_(std::move(mesh)), num_dofs_() {
   LF_ASSERT_MSG((mesh_->DimMesh() == 2), "Can handle 2D meshes only");
 
@@ -118,6 +143,9 @@ UniformFEDofHandler::UniformFEDofHandler(
 
   // Initializatin of dof index arrays
   initIndexArrays();
+
+  // Optional change of the default numbering
+  Renumber(renumbering, cell_interior_last);
 }
 
 void UniformFEDofHandler::InitTotalNumDofs() {
@@ -272,6 +300,176 @@ void UniformFEDofHandler::initIndexArrays() {
   num_dof_ = dof_idx;
 }  // end constructor
 
+void UniformFEDofHandler::Renumber(DofRenumbering renumbering,
+                                   bool cell_interior_last) {
+  permutation_.resize(num_dof_);
+  std::iota(permutation_.begin(), permutation_.end(), 0);
+  if ((renumbering == DofRenumbering::kNone) && !cell_interior_last) {
+    return;
+  }
+  // order[k] = index in the default numbering of the d.o.f. getting index k
+  std::vector<gdof_idx_t> order(permutation_);
+  switch (renumbering) {
+    case DofRenumbering::kNone: {
+      break;
+    }
+    case DofRenumbering::kReverseCuthillMcKee: {
+      order = ReverseCuthillMcKeeOrder();
+      break;
+    }
+    case DofRenumbering::kHilbert:
+    case DofRenumbering::kMorton: {
+      // Every d.o.f. is located at the barycenter of its entity. Ties are
+      // resolved by the default numbering, which keeps the d.o.f. of an
+      // entity together.
+      std::array<Eigen::MatrixXd, 3> centers;
+      for (dim_t codim = 0; codim <= 2; ++codim) {
+        if (num_dofs_[codim] > 0) {
+          centers[codim] = lf::mesh::utils::EntityBarycenters(*mesh_, codim);
+        }
+      }
+      Eigen::MatrixXd points(mesh_->DimWorld(), num_dof_);
+      for (size_type dof = 0; dof < num_dof_; ++dof) {
+        const lf::mesh::Entity &e{*dof_entities_[dof]};
+        points.col(dof) = centers[e.Codim()].col(mesh_->Index(e));
+      }
+      const std::vector<size_type> sfc_order =
+          lf::mesh::utils::SpaceFillingCurveOrder(
+              points, (renumbering == DofRenumbering::kHilbert)
+                          ? lf::mesh::utils::SpaceFillingCurve::kHilbert
+                          : lf::mesh::utils::SpaceFillingCurve::kMorton);
+      order.assign(sfc_order.begin(), sfc_order.end());
+      break;
+    }
+  }
+  if (cell_interior_last) {
+    std::stable_partition(order.begin(), order.end(), [this](gdof_idx_t dof) {
+      return dof_entities_[dof]->Codim() != 0;
+    });
+  }
+
+  // Invert the order and relabel all index arrays
+  for (size_type k = 0; k < num_dof_; ++k) {
+    permutation_[order[k]] = k;
+  }
+  for (dim_t codim = 0; codim <= 2; ++codim) {
+    // Unused slots for triangles in hybrid meshes hold zero, a valid index
+    for (gdof_idx_t &dof : dofs_[codim]) {
+      dof = permutation_[dof];
+    }
+  }
+  std::vector<const lf::mesh::Entity *> old_entities(num_dof_);
+  std::swap(old_entities, dof_entities_);
+  for (size_type dof = 0; dof < num_dof_; ++dof) {
+    dof_entities_[permutation_[dof]] = old_entities[dof];
+  }
+}
+
+std::vector<gdof_idx_t> UniformFEDofHandler::ReverseCuthillMcKeeOrder() const {
+  const size_type n = num_dof_;
+  // Graph of the Galerkin matrix in compressed row format: two d.o.f. are
+  // adjacent, if they both belong to a cell. Rows are first filled with
+  // duplicates and then compressed.
+  std::vector<size_type> row_start(n + 1, 0);
+  for (const lf::mesh::Entity *cell : mesh_->Entities(0)) {
+    const nonstd::span<const gdof_idx_t> cell_dofs{GlobalDofIndices(*cell)};
+    for (const gdof_idx_t dof : cell_dofs) {
+      row_start[dof + 1] += cell_dofs.size() - 1;
+    }
+  }
+  std::partial_sum(row_start.begin(), row_start.end(), row_start.begin());
+  std::vector<gdof_idx_t> adjacent(row_start[n]);
+  std::vector<size_type> row_end(row_start.begin(), row_start.end() - 1);
+  for (const lf::mesh::Entity *cell : mesh_->Entities(0)) {
+    const nonstd::span<const gdof_idx_t> cell_dofs{GlobalDofIndices(*cell)};
+    for (const gdof_idx_t i : cell_dofs) {
+      for (const gdof_idx_t j : cell_dofs) {
+        if (i != j) {
+          adjacent[row_end[i]++] = j;
+        }
+      }
+    }
+  }
+  for (size_type i = 0; i < n; ++i) {
+    auto row_begin = adjacent.begin() + row_start[i];
+    std::sort(row_begin, adjacent.begin() + row_end[i]);
+    row_end[i] = row_start[i] + static_cast<size_type>(
+                                    std::unique(row_begin,
+                                                adjacent.begin() + row_end[i]) -
+                                    row_begin);
+  }
+  auto degree = [&](gdof_idx_t i) { return row_end[i] - row_start[i]; };
+
+  // Breadth-first search from root, appending the visited d.o.f. to `queue`
+  // with the neighbours of a d.o.f. sorted by increasing degree. Returns the
+  // position in `queue` where the last level starts.
+  std::vector<bool> visited(n, false);
+  std::vector<size_type> level(n, 0);
+  auto bfs = [&](gdof_idx_t root, std::vector<gdof_idx_t> &queue) {
+    const size_type first = queue.size();
+    queue.push_back(root);
+    visited[root] = true;
+    level[root] = 0;
+    size_type last_level_start = first;
+    for (size_type head = first; head < queue.size(); ++head) {
+      const gdof_idx_t v = queue[head];
+      if (level[v] != level[queue[last_level_start]]) {
+        last_level_start = head;
+      }
+      const size_type begin_new = queue.size();
+      for (size_type k = row_start[v]; k < row_end[v]; ++k) {
+        const gdof_idx_t w = adjacent[k];
+        if (!visited[w]) {
+          visited[w] = true;
+          level[w] = level[v] + 1;
+          queue.push_back(w);
+        }
+      }
+      std::stable_sort(queue.begin() + begin_new, queue.end(),
+                       [&](gdof_idx_t a, gdof_idx_t b) {
+                         return degree(a) < degree(b);
+                       });
+    }
+    return last_level_start;
+  };
+
+  std::vector<gdof_idx_t> order;
+  order.reserve(n);
+  std::vector<gdof_idx_t> trial;
+  for (size_type start = 0; start < n; ++start) {
+    if (visited[start]) {
+      continue;
+    }
+    // Pseudo-peripheral root of the connected component by the heuristics of
+    // George and Liu: move to a d.o.f. of minimal degree in the last level
+    // as long as the number of levels grows.
+    gdof_idx_t root = start;
+    size_type height = 0;
+    for (;;) {
+      trial.clear();
+      const size_type last = bfs(root, trial);
+      for (const gdof_idx_t v : trial) {
+        visited[v] = false;
+      }
+      const size_type new_height = level[trial.back()];
+      const gdof_idx_t candidate = *std::min_element(
+          trial.begin() + last, trial.end(),
+          [&](gdof_idx_t a, gdof_idx_t b) { return degree(a) < degree(b); });
+      if ((root != start) && (new_height <= height)) {
+        break;
+      }
+      height = new_height;
+      if (candidate == root) {
+        break;
+      }
+      root = candidate;
+    }
+    bfs(root, order);
+  }
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
 nonstd::span<const gdof_idx_t> UniformFEDofHandler::GlobalDofIndices(
     lf::base::RefEl ref_el_type, glb_idx_t entity_index) const {
   // Co-dimension of entity in a 2D mesh
@@ -330,62 +528,38 @@ size_type UniformFEDofHandler::NumInteriorDofs(
 
 nonstd::span<const gdof_idx_t> DynamicFEDofHandler::GlobalDofIndices(
     const lf::mesh::Entity &entity) const {
-  // Topological type
-  const lf::base::RefEl ref_el_type = entity.RefEl();
   // Co-dimension of entity in a 2D mesh
-  const dim_t codim = 2 - ref_el_type.Dimension();
-  // Index of current mesh entity
-  const glb_idx_t entity_index = mesh_p_->Index(entity);
-  // Offset of dof indices for current entity
-  const size_type idx_offset = offsets_[codim][entity_index];
-  // Number of shape functions covering current entity
-  const size_type no_covered_dofs =
-      offsets_[codim][entity_index + 1] - idx_offset;
-  // Pointers to range of dof indices
-  const gdof_idx_t *begin = dofs_[codim].data() + idx_offset;
-  const gdof_idx_t *end = begin + no_covered_dofs;
-  return {begin, end};
+  const dim_t codim = 2 - entity.RefEl().Dimension();
+  // Entity table and dof indices share one array
+  const gdof_idx_t *table = tables_[codim].data();
+  // Row of the entity table for the current entity
+  const gdof_idx_t *row = table + 2 * mesh_p_->Index(entity);
+  return {table + row[0], table + row[2]};
 }
 
 nonstd::span<const gdof_idx_t> DynamicFEDofHandler::InteriorGlobalDofIndices(
     const lf::mesh::Entity &entity) const {
-  // Topological type
-  const lf::base::RefEl ref_el_type = entity.RefEl();
   // Co-dimension of entity in a 2D mesh
-  const dim_t codim = 2 - ref_el_type.Dimension();
-  // Index of current mesh entity
-  const glb_idx_t entity_index = mesh_p_->Index(entity);
-  // Offset of indices for current entity
-  const size_type idx_offset = offsets_[codim][entity_index];
-  // Number of shape functions covering current entity
-  const size_type no_covered_dofs =
-      offsets_[codim][entity_index + 1] - idx_offset;
-  // Number of shape functions associated with the current entity
-  const size_type no_loc_dofs = num_int_dofs_[codim][entity_index];
-  // Pointers to range of dof indices
-  const gdof_idx_t *begin = dofs_[codim].data() + idx_offset;
-  const gdof_idx_t *end = begin + no_covered_dofs;
-  // Move pointer to location of indices for interior dofs
-  // This is the only difference to GlobalDofIndices()
-  begin += (no_covered_dofs - no_loc_dofs);
-  return {begin, end};
+  const dim_t codim = 2 - entity.RefEl().Dimension();
+  const gdof_idx_t *table = tables_[codim].data();
+  // Row of the entity table for the current entity
+  const gdof_idx_t *row = table + 2 * mesh_p_->Index(entity);
+  // Interior dofs come last, this is the only difference to
+  // GlobalDofIndices()
+  return {table + row[1], table + row[2]};
 }
 
 size_type DynamicFEDofHandler::NumLocalDofs(
     const lf::mesh::Entity &entity) const {
-  const lf::base::RefEl ref_el_type = entity.RefEl();
-  const dim_t codim = 2 - ref_el_type.Dimension();
-  const glb_idx_t entity_index = mesh_p_->Index(entity);
-  return (offsets_[codim][entity_index + 1] - offsets_[codim][entity_index]);
+  const dim_t codim = 2 - entity.RefEl().Dimension();
+  const gdof_idx_t *row = tables_[codim].data() + 2 * mesh_p_->Index(entity);
+  return static_cast<size_type>(row[2] - row[0]);
 }
 
 size_type DynamicFEDofHandler::NumInteriorDofs(
     const lf::mesh::Entity &entity) const {
-  const lf::base::RefEl ref_el_type = entity.RefEl();
-  const dim_t codim = 2 - ref_el_type.Dimension();
-  const glb_idx_t entity_index = mesh_p_->Index(entity);
-  const size_type no_loc_dofs = num_int_dofs_[codim][entity_index];
-  return no_loc_dofs;
+  const dim_t codim = 2 - entity.RefEl().Dimension();
+  return NumIntDofs(codim, mesh_p_->Index(entity));
 }
 
 }  // namespace lf::assemble
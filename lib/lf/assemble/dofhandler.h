@@ -99,6 +99,9 @@ namespace lf::assemble {
  * -# Within entities of the same co-dimension the _numbering follows their
  * indexing_ through the member function @ref lf::mesh::Mesh::Index().
  *
+ * These rules are given up when a UniformFEDofHandler is asked to renumber its
+ * d.o.f., see @ref DofRenumbering.
+ *
  * Also refer to [Lecture
  * Document](https://www.sam.math.ethz.ch/~grsam/NUMPDEFL/NUMPDE.pdf)
  * @lref{rem:lfdofnumb}.
@@ -237,6 +240,39 @@ std::ostream &operator<<(std::ostream &o, const DofHandler &dof_handler);
 
 /* ====================================================================== */
 
+/**
+ * @brief Strategies for renumbering the global shape functions managed by a
+ * UniformFEDofHandler
+ *
+ * The default numbering of d.o.f. follows the indexing of the entities
+ * (nodes, then edges, then cells), which for meshes imported from mesh
+ * generators often results in Galerkin matrices with a large bandwidth and poor
+ * memory locality. The following renumberings are available:
+ *
+ * - _Reverse Cuthill-McKee_ (RCM): breadth-first traversal of the graph of the
+ *   Galerkin matrix starting from a pseudo-peripheral d.o.f., visiting
+ *   neighbours in the order of increasing degree, reversed at the end. Reduces
+ *   the bandwidth and the profile of the matrix and, thus, the fill-in of
+ *   direct solvers and ILU.
+ * - _Space-filling curves_: d.o.f. are sorted along a Hilbert or Morton curve
+ *   through the barycenters of the entities they are associated with, see
+ *   lf::mesh::utils::SpaceFillingCurveOrder(). D.o.f. associated with the same
+ *   entity stay contiguous. This improves the cache locality of sparse
+ *   matrix-vector products.
+ *
+ * The renumbering is done once, when the dof handler is constructed, and
+ * UniformFEDofHandler::Permutation() tells how the indices were changed.
+ */
+enum class DofRenumbering {
+  kNone = 0,                 ///< numbering following the entity indices
+  kReverseCuthillMcKee = 1,  ///< bandwidth reduction
+  kHilbert = 2,              ///< Hilbert curve through entity barycenters
+  kMorton = 3                ///< Morton (Z-order) curve
+};
+
+/** @brief Output of the name of a renumbering strategy */
+std::ostream &operator<<(std::ostream &o, DofRenumbering renumbering);
+
 /**
  * @brief Dofhandler for uniform finite element spaces
  *
@@ -264,8 +300,45 @@ class UniformFEDofHandler : public DofHandler {
   using dof_map_t = std::map<lf::base::RefEl, base::size_type>;
   UniformFEDofHandler(std::shared_ptr<const lf::mesh::Mesh> mesh,
                       dof_map_t dofmap);
+
+  /**
+   * @brief Construction from a map object with renumbering of the d.o.f.
+   *
+   * @param mesh the underlying mesh
+   * @param dofmap map telling number of interior dofs for every type of entity
+   * @param renumbering strategy for renumbering the d.o.f. after they have
+   * been numbered in the default way
+   * @param cell_interior_last if `true`, the d.o.f. associated with cells are
+   * numbered after all other d.o.f., keeping their relative order. Then the
+   * Galerkin matrix has a 2x2 block structure with a block-diagonal lower
+   * right block, which suits static condensation and block preconditioners.
+   *
+   * The mapping from the default numbering to the final one is available
+   * through Permutation().
+   */
+  UniformFEDofHandler(std::shared_ptr<const lf::mesh::Mesh> mesh,
+                      dof_map_t dofmap, DofRenumbering renumbering,
+                      bool cell_interior_last = false);
   /**@}*/
 
+  /**
+   * @brief The renumbering applied to the d.o.f. at construction
+   *
+   * @return vector `p` of length NumDofs(): the d.o.f. with index `i` in the
+   * default numbering has index `p[i]` in the numbering of this dof handler.
+   * It is the identity when no renumbering was requested.
+   *
+   * Coefficient vectors can be converted between the numberings by
+   * ~~~
+   * for (gdof_idx_t i = 0; i < dofh.NumDofs(); ++i) {
+   *   u_new[p[i]] = u_default[i];
+   * }
+   * ~~~
+   */
+  [[nodiscard]] const std::vector<gdof_idx_t> &Permutation() const {
+    return permutation_;
+  }
+
   [[nodiscard]] size_type NumDofs() const override { return num_dof_; }
 
   /**
@@ -326,6 +399,14 @@ class UniformFEDofHandler : public DofHandler {
    * @sa LocalStaticDOFs2D::TotalNoLocDofs()
    */
   void InitTotalNumDofs();
+  /**
+   * @brief Computes and applies the new numbering of d.o.f. and stores it in
+   * permutation_
+   */
+  void Renumber(DofRenumbering renumbering, bool cell_interior_last);
+  /** @brief Default indices of the d.o.f. in the order found by the reverse
+   * Cuthill-McKee algorithm */
+  [[nodiscard]] std::vector<gdof_idx_t> ReverseCuthillMcKeeOrder() const;
 
   // Access method to numbers and values of indices of shape functions
   [[nodiscard]] nonstd::span<const gdof_idx_t> GlobalDofIndices(
@@ -411,6 +492,8 @@ class UniformFEDofHandler : public DofHandler {
   /** Vectors of global indices of dofs belonging to entities of different
       topological type */
   std::array<std::vector<gdof_idx_t>, 3> dofs_;
+  /** Map from default to actual numbering of d.o.f., see Permutation() */
+  std::vector<gdof_idx_t> permutation_;
   /** Number of dofs covering entities of a particular type */
   std::array<size_type, 3> num_dofs_;
   /** (Maximum) number of shape functions covering entities
@@ -466,145 +549,92 @@ class DynamicFEDofHandler : public DofHandler {
       : mesh_p_(std::move(mesh_p)) {
     LF_ASSERT_MSG((mesh_p_->DimMesh() == 2), "Can handle 2D meshes only");
 
-    // Index counter for global shape functions = global dof
-    gdof_idx_t dof_idx = 0;
-
-    // Step I: Set indices for shape functions on nodes
-    // Run through node indices (entities of co-dimension 2)
-    const size_type no_nodes = mesh_p_->NumEntities(2);
-    num_int_dofs_[2].resize(no_nodes, 0);
-    offsets_[2].resize(no_nodes + 1, 0);
-    // Traverse nodes (co-dimension-2 entities) based on indices
-    for (glb_idx_t node_idx = 0; node_idx < no_nodes; node_idx++) {
-      // Obtain pointer to node entity
-      const mesh::Entity *node_p{mesh_p_->EntityByIndex(2, node_idx)};
-      LF_ASSERT_MSG(mesh_p_->Index(*node_p) == node_idx, "Node index mismatch");
-      // Offset for indices of node in index vector
-      glb_idx_t node_dof_offset = dof_idx;
-      offsets_[2][node_idx] = node_dof_offset;
-      // Request number of local shape functions associated with the node
-      size_type no_int_dof_node = locdof(*node_p);
-      num_int_dofs_[2][node_idx] = no_int_dof_node;
-
-      // Store dof indices in array
-      for (unsigned j = 0; j < no_int_dof_node; j++) {
-        dofs_[2].push_back(dof_idx);
-        dof_entities_.push_back(node_p);  // Store entity for current dof
-        dof_idx++;                        // Move on to next index
-      }
-    }
-    // Set sentinel
-    offsets_[2][no_nodes] = dof_idx;
-
-    // Step II: Set indices for shape functions on edges (co-dimension = 1)
-    const size_type no_edges = mesh_p_->NumEntities(1);
-    // Set length of edge-related index vectors
-    num_int_dofs_[1].resize(no_edges, 0);
-    offsets_[1].resize(no_edges + 1, 0);
-    // points to the position of the current dof index
-    size_type edge_dof_offset = 0;
-    for (glb_idx_t edge_idx = 0; edge_idx < no_edges; edge_idx++) {
-      // Obtain pointer to edge entity
-      const mesh::Entity *edge{mesh_p_->EntityByIndex(1, edge_idx)};
-      LF_ASSERT_MSG(mesh_p_->Index(*edge) == edge_idx, "Edge index mismatch");
-      // Offset for indices of edge dof in index vector
-      offsets_[1][edge_idx] = edge_dof_offset;
-      size_type no_int_dof_edge = locdof(*edge);
-      num_int_dofs_[1][edge_idx] = no_int_dof_edge;
-
-      // Obtain indices for basis functions sitting at endpoints
-      // Endpoints are mesh entities with co-dimension = 2
-      for (const lf::mesh::Entity *endpoint : edge->SubEntities(1)) {
-        const glb_idx_t ep_idx(mesh_p_->Index(*endpoint));
-        glb_idx_t ep_dof_offset = offsets_[2][ep_idx];
-        size_type no_int_dofs_ep = num_int_dofs_[2][ep_idx];
-        // Copy indices of shape functions from nodes to edge
-        for (unsigned j = 0; j < no_int_dofs_ep; j++) {
-          dofs_[1].push_back(dofs_[2][ep_dof_offset + j]);
-          edge_dof_offset++;
+    // Step I: Set up the entity tables for nodes, edges and cells (in this
+    // order). The number of shape functions covering an entity is the sum of
+    // the numbers of interior shape functions of its sub-entities and of the
+    // entity itself, so that the dof indices can be appended to the entity
+    // table with their final size.
+    std::size_t total_num_dofs = 0;
+    for (int codim = 2; codim >= 0; codim--) {
+      const size_type no_entities = mesh_p_->NumEntities(codim);
+      std::vector<gdof_idx_t> &table{tables_[codim]};
+      table.resize(2 * static_cast<std::size_t>(no_entities) + 1);
+      // The dof indices start right behind the entity table
+      auto offset = static_cast<gdof_idx_t>(table.size());
+      // Traverse entities based on indices
+      for (glb_idx_t idx = 0; idx < no_entities; idx++) {
+        const mesh::Entity *entity_p{mesh_p_->EntityByIndex(codim, idx)};
+        LF_ASSERT_MSG(mesh_p_->Index(*entity_p) == idx,
+                      "Index mismatch for codim " << codim);
+        // Count shape functions of sub-entities
+        size_type no_covered_dofs = 0;
+        for (int rel_codim = 2 - codim; rel_codim > 0; rel_codim--) {
+          for (const lf::mesh::Entity *sub : entity_p->SubEntities(rel_codim)) {
+            no_covered_dofs +=
+                NumIntDofs(codim + rel_codim, mesh_p_->Index(*sub));
+          }
         }
+        // Request number of local shape functions associated with the entity
+        const size_type no_int_dofs = locdof(*entity_p);
+        table[2 * idx] = offset;
+        table[2 * idx + 1] = offset + no_covered_dofs;
+        offset += no_covered_dofs + no_int_dofs;
+        total_num_dofs += no_int_dofs;
       }
-      // Set indices for interior edge degrees of freedom
-      for (unsigned j = 0; j < no_int_dof_edge; j++) {
-        dofs_[1].push_back(dof_idx);
-        edge_dof_offset++;
-        dof_entities_.push_back(edge);
-        dof_idx++;
-      }
+      // Set sentinel and make room for the dof indices
+      table[2 * static_cast<std::size_t>(no_entities)] = offset;
+      table.resize(offset);
     }
-    // Set sentinel
-    offsets_[1][no_edges] = edge_dof_offset;
-
-    // Step III: Set indices for shape functions on cells (co-dimension = 0)
-    const size_type no_cells = mesh_p_->NumEntities(0);
-    // Set length of cell-related index vectors
-    num_int_dofs_[0].resize(no_cells, 0);
-    offsets_[0].resize(no_cells + 1, 0);
-    // points to the position of the current dof index
-    size_type cell_dof_offset = 0;
-    for (glb_idx_t cell_idx = 0; cell_idx < no_cells; cell_idx++) {
-      // Obtain pointer to current ell
-      const mesh::Entity *cell{mesh_p_->EntityByIndex(0, cell_idx)};
-      // Offset for indices of cell dof in index vector
-      offsets_[0][cell_idx] = cell_dof_offset;
-      size_type no_int_dof_cell = locdof(*cell);
-      num_int_dofs_[0][cell_idx] = no_int_dof_cell;
-
-      // Obtain indices for basis functions in vertices
-      for (const lf::mesh::Entity *vertex : cell->SubEntities(2)) {
-        const glb_idx_t vt_idx(mesh_p_->Index(*vertex));
-        glb_idx_t vt_dof_offset = offsets_[2][vt_idx];
-        size_type no_int_dofs_vt = num_int_dofs_[2][vt_idx];
-        // Copy indices of shape functions from nodes to cell
-        for (unsigned j = 0; j < no_int_dofs_vt; j++) {
-          dofs_[0].push_back(dofs_[2][vt_dof_offset + j]);
-          cell_dof_offset++;
-        }
-      }
+    dof_entities_.reserve(total_num_dofs);
 
-      // Collect indices of interior shape functions of edges
-      // Internal ordering will depend on the orientation of the edge
-      auto edge_orientations = cell->RelativeOrientations();
-      auto edges = cell->SubEntities(1);
-      // Loop over edges
-      for (int ed_sub_idx = 0; ed_sub_idx < cell->RefEl().NumSubEntities(1);
-           ed_sub_idx++) {
-        const glb_idx_t edge_idx = mesh_p_->Index(*edges[ed_sub_idx]);
-        const size_type no_int_dof_edge = num_int_dofs_[1][edge_idx];
-        const glb_idx_t edge_int_dof_offset =
-            offsets_[1][edge_idx + 1] - no_int_dof_edge;
-
-        // Copy indices of shape functions from edges to cell
-        // The order, in which they are copied depends on the relative
-        // orientation of the edge w.r.t. the cell
-        switch (edge_orientations[ed_sub_idx]) {
-          case lf::mesh::Orientation::positive: {
-            for (int j = 0; j < no_int_dof_edge; j++) {
-              dofs_[0].push_back(dofs_[1][edge_int_dof_offset + j]);
-              cell_dof_offset++;
-            }
-            break;
-          }
-          case lf::mesh::Orientation::negative: {
-            for (int j = static_cast<int>(no_int_dof_edge - 1); j >= 0; j--) {
-              dofs_[0].push_back(dofs_[1][edge_int_dof_offset + j]);
-              cell_dof_offset++;
+    // Step II: Fill in the dof indices. New indices are assigned to the
+    // interior shape functions of nodes first, then edges, then cells.
+    // Index counter for global shape functions = global dof
+    gdof_idx_t dof_idx = 0;
+    for (int codim = 2; codim >= 0; codim--) {
+      const size_type no_entities = mesh_p_->NumEntities(codim);
+      gdof_idx_t *table = tables_[codim].data();
+      for (glb_idx_t idx = 0; idx < no_entities; idx++) {
+        const mesh::Entity *entity_p{mesh_p_->EntityByIndex(codim, idx)};
+        gdof_idx_t dof_offset = table[2 * idx];
+
+        // Copy indices of interior shape functions of vertices, then of edges
+        for (int rel_codim = 2 - codim; rel_codim > 0; rel_codim--) {
+          const int sub_codim = codim + rel_codim;
+          auto subs = entity_p->SubEntities(rel_codim);
+          const auto num_subs = static_cast<size_type>(subs.size());
+          // Internal ordering for edges depends on their relative orientation
+          auto orientations = (sub_codim == 1)
+                                  ? entity_p->RelativeOrientations()
+                                  : nonstd::span<const lf::mesh::Orientation>();
+          const gdof_idx_t *sub_table = tables_[sub_codim].data();
+          for (size_type k = 0; k < num_subs; k++) {
+            const glb_idx_t sub_idx = mesh_p_->Index(*subs[k]);
+            const size_type no_int_dofs = NumIntDofs(sub_codim, sub_idx);
+            const gdof_idx_t *sub_int_dofs =
+                sub_table + sub_table[2 * sub_idx + 1];
+            if (orientations.empty() ||
+                orientations[k] == lf::mesh::Orientation::positive) {
+              for (size_type j = 0; j < no_int_dofs; j++) {
+                table[dof_offset++] = sub_int_dofs[j];
+              }
+            } else {
+              for (size_type j = no_int_dofs; j > 0; j--) {
+                table[dof_offset++] = sub_int_dofs[j - 1];
+              }
             }
-            break;
           }
-        }  // end switch
-      }    // end loop over edges
-
-      // Set indices for interior shape functions of the cell
-      for (unsigned j = 0; j < no_int_dof_cell; j++) {
-        dofs_[0].push_back(dof_idx);
-        cell_dof_offset++;
-        dof_entities_.push_back(cell);
-        dof_idx++;
-      }  // end loop over interior dof of cell
-    }    // end loop over cells
-    // Set sentinel
-    offsets_[0][no_cells] = cell_dof_offset;
+        }
+
+        // Set indices for interior shape functions of the entity
+        const gdof_idx_t dof_end = table[2 * idx + 2];
+        while (dof_offset < dof_end) {
+          table[dof_offset++] = dof_idx;
+          dof_entities_.push_back(entity_p);
+          dof_idx++;
+        }
+      }  // end loop over entities
+    }    // end loop over co-dimensions
 
     // Finally set number of global shape functions
     num_dof_ = dof_idx;
@@ -659,31 +689,38 @@ class DynamicFEDofHandler : public DofHandler {
   }
 
  private:
+  /** Number of interior shape functions of an entity given by co-dimension
+   * and index */
+  [[nodiscard]] size_type NumIntDofs(dim_t codim, glb_idx_t idx) const {
+    return static_cast<size_type>(tables_[codim][2 * idx + 2] -
+                                  tables_[codim][2 * idx + 1]);
+  }
+
   /** The mesh on which the degrees of freedom are defined */
   std::shared_ptr<const lf::mesh::Mesh> mesh_p_;
   /** The total number of degrees of freedom */
   size_type num_dof_{0};
   /** Vector of entities to which global basis functions are associated */
   std::vector<const lf::mesh::Entity *> dof_entities_;
-  /** Internal indexing helper arrays
+  /** Internal indexing helper arrays in compressed row format
    *
-   * The indices of global shape functions are stored in a long array
-   * `dofs_[codim]` for each co-dimension `codim`. The entries in the
-   * `offsets_[codim]` array point to the beginning of the dof indices for a
-   * particular entity identified via its index in the mesh.
+   * For each co-dimension `codim` a single array `tables_[codim]` holds an
+   * entity table followed by the indices of global shape functions, the
+   * indices for an entity following those of the entity with the preceding
+   * index. The interior shape functions of an entity come last.
    *
-   * @note the length `offsets_[codim]` vectors must exceed the number of
-   * corresponding entities by 1.
+   * For the entity with index `i` the entity table holds
+   * - at position `2*i` the position of its first dof index,
+   * - at position `2*i+1` the position of its first _interior_ dof index,
+   * - and at position `2*i+2` the end of its dof indices,
+   *
+   * all positions counted from the beginning of `tables_[codim]`. Thus, a
+   * lookup reads three adjacent words of the entity table and then the dof
+   * indices through the same base pointer. Each array is allocated once with
+   * its exact size. The entity table uses the type `gdof_idx_t` of the dof
+   * indices, because GlobalDofIndices() hands out views of the latter.
    */
-  /**@{*/
-  /** Vector of number of interior dofs for entities */
-  std::array<std::vector<size_type>, 3> num_int_dofs_;
-  /** Offsets of dof index arrays in `dofs_` vectors */
-  std::array<std::vector<size_type>, 3> offsets_;
-  /** Vectors of global indices of dofs belonging to entities of different
-      co-dimension */
-  std::array<std::vector<gdof_idx_t>, 3> dofs_;
-  /**@}*/
+  std::array<std::vector<gdof_idx_t>, 3> tables_;
 };
 
 }  // namespace lf::assemble
@@ -0,0 +1,233 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Caching wrapper for entity matrix providers, reusing element matrices
+ * of congruent affine cells
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#ifndef _LF_ASSEMBLE_ELEMENT_MATRIX_CACHE_H
+#define _LF_ASSEMBLE_ELEMENT_MATRIX_CACHE_H
+
+#include <lf/mesh/mesh.h>
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "assembly_types.h"
+
+namespace lf::assemble {
+
+/**
+ * @brief Coefficient key for CachedEntityMatrixProvider, if the element
+ * matrices do not depend on coefficients varying over the mesh
+ */
+struct NoCoefficientKey {
+  std::vector<double> operator()(const lf::mesh::Entity & /*unused*/) const {
+    return {};
+  }
+};
+
+namespace internal {
+/** @brief Hash function for the keys of CachedEntityMatrixProvider */
+struct ElementMatrixKeyHash {
+  std::size_t operator()(const std::vector<std::int64_t> &key) const {
+    std::size_t seed = key.size();
+    for (const std::int64_t k : key) {
+      seed ^= std::hash<std::int64_t>{}(k) + 0x9e3779b97f4a7c15ULL +
+              (seed << 6) + (seed >> 2);
+    }
+    return seed;
+  }
+};
+}  // namespace internal
+
+/**
+ * @brief Wrapper of an \ref entity_matrix_provider which reuses the element
+ * matrices of cells that are translates of each other
+ *
+ * @tparam ENTITY_MATRIX_PROVIDER a type modelling the concept \ref
+ * entity_matrix_provider
+ * @tparam COEFF_KEY functor type compliant with `std::function<RANGE(const
+ * lf::mesh::Entity &)>`, where `RANGE` is an iterable range of `double`, e.g.
+ * `std::vector<double>`
+ *
+ * For an entity with affine geometry, see lf::geometry::Geometry::isAffine(),
+ * the element matrix computed by a typical entity matrix provider only
+ * depends on
+ * - the type of the reference element,
+ * - the (constant) Jacobian of the geometry mapping,
+ * - the relative orientations of its sub-entities, which determine the
+ *   ordering of local shape functions for higher order Lagrangian elements,
+ * - the values of coefficients, if they are constant on the entity.
+ *
+ * These data, rounded to a relative precision, are used as a key into a hash
+ * table of element matrices. Only if the key is not found, the element matrix
+ * is computed by the wrapped provider. Element matrices of entities with
+ * non-affine geometries are always computed by the wrapped provider.
+ *
+ * On meshes composed of few distinct cell shapes, e.g., those created by
+ * lf::mesh::hybrid2d::TPTriagMeshBuilder, almost all element matrices are
+ * retrieved from the cache, so that assembly essentially reduces to the
+ * scattering of element matrices.
+ *
+ * @warning The cached element matrices are only correct, if the element
+ * matrix of the wrapped provider is a function of the data listed above. If
+ * it depends on coefficients varying over the mesh, `coeff_key` must return
+ * their values on the entity, e.g., at its barycenter, and the coefficients
+ * must be constant on every entity.
+ *
+ * #### Example usage
+ * ~~~
+ * lf::uscalfe::ReactionDiffusionElementMatrixProvider emp(fe_space, alpha,
+ *                                                         gamma);
+ * lf::assemble::CachedEntityMatrixProvider cached_emp(emp);
+ * lf::assemble::AssembleMatrixLocally(0, dofh, dofh, cached_emp, A);
+ * std::cout << cached_emp.Hits() << " hits, " << cached_emp.Misses()
+ *           << " misses" << std::endl;
+ * ~~~
+ */
+template <class ENTITY_MATRIX_PROVIDER, class COEFF_KEY = NoCoefficientKey>
+class CachedEntityMatrixProvider {
+ public:
+  /** @brief type of element matrices returned by the wrapped provider */
+  using elem_mat_t =
+      std::decay_t<decltype(std::declval<ENTITY_MATRIX_PROVIDER &>().Eval(
+          std::declval<const lf::mesh::Entity &>()))>;
+  /** @brief return type of Eval() */
+  using ElemMat = const elem_mat_t &;
+
+  /**
+   * @brief Set up an empty cache
+   *
+   * @param emp entity matrix provider to be wrapped, stored as a copy
+   * @param coeff_key functor returning the values of the coefficients on an
+   * entity, which become part of the key
+   * @param rel_tol relative precision for comparing Jacobians and coefficient
+   * values
+   */
+  explicit CachedEntityMatrixProvider(ENTITY_MATRIX_PROVIDER emp,
+                                      COEFF_KEY coeff_key = {},
+                                      double rel_tol = 1.0E-10)
+      : emp_(std::move(emp)),
+        coeff_key_(std::move(coeff_key)),
+        rel_tol_(rel_tol) {
+    LF_ASSERT_MSG(rel_tol > 0.0, "Tolerance must be positive");
+  }
+
+  CachedEntityMatrixProvider(const CachedEntityMatrixProvider &) = default;
+  CachedEntityMatrixProvider(CachedEntityMatrixProvider &&) noexcept = default;
+  CachedEntityMatrixProvider &operator=(const CachedEntityMatrixProvider &) =
+      default;
+  CachedEntityMatrixProvider &operator=(
+      CachedEntityMatrixProvider &&) noexcept = default;
+  ~CachedEntityMatrixProvider() = default;
+
+  /** @brief forwards to the wrapped provider */
+  bool isActive(const lf::mesh::Entity &entity) {
+    return emp_.isActive(entity);
+  }
+
+  /**
+   * @brief Element matrix for an entity, taken from the cache if possible
+   *
+   * @return reference to the element matrix, valid until the next call of
+   * Eval() or ClearCache()
+   */
+  ElemMat Eval(const lf::mesh::Entity &entity) {
+    if (!MakeKey(entity)) {
+      num_bypassed_++;
+      uncached_ = emp_.Eval(entity);
+      return uncached_;
+    }
+    auto it = cache_.find(key_);
+    if (it != cache_.end()) {
+      num_hits_++;
+      return it->second;
+    }
+    num_misses_++;
+    return cache_.emplace(key_, emp_.Eval(entity)).first->second;
+  }
+
+  /** @brief number of element matrices retrieved from the cache */
+  [[nodiscard]] size_type Hits() const { return num_hits_; }
+  /** @brief number of element matrices computed and stored in the cache */
+  [[nodiscard]] size_type Misses() const { return num_misses_; }
+  /** @brief number of element matrices of non-affine entities */
+  [[nodiscard]] size_type Bypassed() const { return num_bypassed_; }
+  /** @brief number of distinct element matrices stored */
+  [[nodiscard]] size_type CacheSize() const { return cache_.size(); }
+
+  /** @brief remove all element matrices and reset the statistics */
+  void ClearCache() {
+    cache_.clear();
+    num_hits_ = num_misses_ = num_bypassed_ = 0;
+  }
+
+  /** @brief access to the wrapped provider */
+  [[nodiscard]] ENTITY_MATRIX_PROVIDER &Provider() { return emp_; }
+
+ private:
+  /** append a value rounded to a precision of rel_tol_ * 2^exponent */
+  void AppendRounded(double value, int exponent) {
+    key_.push_back(std::llround(value / std::ldexp(rel_tol_, exponent)));
+  }
+
+  /** build key_ for an entity, returns false for non-affine entities */
+  bool MakeKey(const lf::mesh::Entity &entity) {
+    const lf::geometry::Geometry *geo = entity.Geometry();
+    if ((geo == nullptr) || !geo->isAffine()) {
+      return false;
+    }
+    key_.clear();
+    key_.push_back(entity.RefEl().Id());
+    // All entries of the Jacobian are rounded relative to its largest entry,
+    // whose binary exponent is part of the key
+    const Eigen::MatrixXd jac =
+        geo->Jacobian(Eigen::MatrixXd::Zero(geo->DimLocal(), 1));
+    int exponent = 0;
+    if (jac.size() > 0) {
+      std::frexp(jac.cwiseAbs().maxCoeff(), &exponent);
+    }
+    key_.push_back(exponent);
+    for (Eigen::Index k = 0; k < jac.size(); ++k) {
+      AppendRounded(jac(k), exponent);
+    }
+    for (const lf::mesh::Orientation ori : entity.RelativeOrientations()) {
+      key_.push_back(static_cast<int>(ori));
+    }
+    for (const double coeff : coeff_key_(entity)) {
+      std::frexp(coeff, &exponent);
+      key_.push_back(exponent);
+      AppendRounded(coeff, exponent);
+    }
+    return true;
+  }
+
+  ENTITY_MATRIX_PROVIDER emp_; /**< wrapped provider */
+  COEFF_KEY coeff_key_;        /**< coefficient values of an entity */
+  double rel_tol_;             /**< relative precision of keys */
+  /** element matrices of congruent entities */
+  std::unordered_map<std::vector<std::int64_t>, elem_mat_t,
+                     internal::ElementMatrixKeyHash>
+      cache_;
+  std::vector<std::int64_t> key_; /**< buffer for the current key */
+  elem_mat_t uncached_;           /**< result for non-affine entities */
+  size_type num_hits_{0};         /**< cache hits */
+  size_type num_misses_{0};       /**< cache misses */
+  size_type num_bypassed_{0};     /**< non-affine entities */
+};
+
+}  // namespace lf::assemble
+
+#endif
@@ -15,10 +15,107 @@
  */
 
 #include <Eigen/Sparse>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "coomatrix.h"
 
 namespace lf::assemble {
 
+/**
+ * @brief Information about fixed solution components
+ */
+template <typename SCALAR>
+using fixed_components_t =
+    std::vector<std::pair<lf::assemble::gdof_idx_t, SCALAR>>;
+
+/**
+ * @brief Precomputed flags and prescribed values of fixed solution components
+ *
+ * @tparam SCALAR underlying scalar type, e.g. double
+ *
+ * The flags are stored as a bitmap, the prescribed values as a dense vector,
+ * which is zero for components that are not fixed. Setting up an object
+ * invokes a selector exactly once per d.o.f., afterwards IsFixed() and
+ * Value() are plain lookups, that can also be used concurrently.
+ */
+template <typename SCALAR>
+class FixedDofs {
+ public:
+  /**
+   * @brief Evaluate a selector for all d.o.f.s
+   *
+   * @param num_dofs total number of d.o.f.s
+   * @param selectvals selector as described for FixFlaggedSolutionComponents()
+   */
+  template <typename SELECTOR,
+            typename = std::enable_if_t<!std::is_same_v<
+                std::decay_t<SELECTOR>, fixed_components_t<SCALAR>>>>
+  FixedDofs(size_type num_dofs, SELECTOR &&selectvals)
+      : FixedDofs(num_dofs) {
+    for (gdof_idx_t k = 0; k < num_dofs; ++k) {
+      const auto selval{selectvals(k)};
+      if (selval.first) {
+        Fix(k, selval.second);
+      }
+    }
+  }
+
+  /**
+   * @brief Set up from a list of index-value pairs
+   *
+   * @param num_dofs total number of d.o.f.s
+   * @param fixed_components list of fixed components, values for repeated
+   * indices are summed up as in FixSolutionComponentsLse()
+   */
+  FixedDofs(size_type num_dofs,
+            const fixed_components_t<SCALAR> &fixed_components)
+      : FixedDofs(num_dofs) {
+    for (const auto &[idx, val] : fixed_components) {
+      LF_ASSERT_MSG(idx < num_dofs, "Index " << idx << " >= N = " << num_dofs);
+      Fix(idx, values_[idx] + val);
+    }
+  }
+
+  /** @brief total number of d.o.f.s */
+  [[nodiscard]] size_type NumDofs() const { return num_dofs_; }
+  /** @brief number of fixed d.o.f.s */
+  [[nodiscard]] size_type NumFixed() const { return num_fixed_; }
+  /** @brief tells whether the d.o.f. with index `k` is fixed */
+  [[nodiscard]] bool IsFixed(gdof_idx_t k) const {
+    LF_ASSERT_MSG(k < num_dofs_, "Index " << k << " >= N = " << num_dofs_);
+    return ((bits_[k >> 6] >> (k & 63)) & 1U) != 0;
+  }
+  /** @brief prescribed value of the d.o.f. with index `k`, zero if not fixed */
+  [[nodiscard]] SCALAR Value(gdof_idx_t k) const { return values_[k]; }
+  /** @brief vector of prescribed values, zero for d.o.f.s not fixed */
+  [[nodiscard]] const Eigen::Matrix<SCALAR, Eigen::Dynamic, 1> &Values()
+      const {
+    return values_;
+  }
+
+ private:
+  explicit FixedDofs(size_type num_dofs)
+      : num_dofs_(num_dofs),
+        num_fixed_(0),
+        bits_((num_dofs + 63) / 64, 0),
+        values_(Eigen::Matrix<SCALAR, Eigen::Dynamic, 1>::Zero(num_dofs)) {}
+
+  void Fix(gdof_idx_t k, SCALAR value) {
+    if (!IsFixed(k)) {
+      bits_[k >> 6] |= std::uint64_t(1) << (k & 63);
+      num_fixed_++;
+    }
+    values_[k] = value;
+  }
+
+  size_type num_dofs_;             /**< total number of d.o.f.s */
+  size_type num_fixed_;            /**< number of fixed d.o.f.s */
+  std::vector<std::uint64_t> bits_; /**< bitmap of fixed d.o.f.s */
+  Eigen::Matrix<SCALAR, Eigen::Dynamic, 1> values_; /**< prescribed values */
+};
+
 /**
  * @brief enforce prescribed solution components
  * @sa FixSolutionComponentsLse()
@@ -91,32 +188,21 @@ void FixFlaggedSolutionComponents(SELECTOR &&selectvals, COOMatrix<SCALAR> &A,
   LF_ASSERT_MSG(A.rows() == N, "Matrix must be square!");
   LF_ASSERT_MSG(N == b.size(),
                 "Mismatch N = " << N << " <-> b.size() = " << b.size());
-  {
-    // Multiply sparse matrix with the vector of fixed components and subtract
-    // result from right hand side
-    // To skip irrelevant components of fixed_vec rely on a temporary vector
-    Eigen::Matrix<SCALAR, Eigen::Dynamic, 1> tmp_vec(N);
-    for (lf::assemble::gdof_idx_t k = 0; k < N; ++k) {
-      const auto selval{selectvals(k)};
-      if (selval.first) {
-        tmp_vec[k] = selval.second;
-      } else {
-        tmp_vec[k] = SCALAR();
-      }
-    }
-    A.MatVecMult(-1.0, tmp_vec, b);
-  }
+  // Query the selector only once for every d.o.f.
+  const FixedDofs<SCALAR> fixed_dofs(N, std::forward<SELECTOR>(selectvals));
+  // Multiply sparse matrix with the vector of fixed components and subtract
+  // result from right hand side
+  A.MatVecMult(-1.0, fixed_dofs.Values(), b);
   // Set vector components of right-hand-side vector for prescribed values
   for (lf::assemble::gdof_idx_t k = 0; k < N; ++k) {
-    const auto selval{selectvals(k)};
-    if (selval.first) {
-      b[k] = selval.second;
+    if (fixed_dofs.IsFixed(k)) {
+      b[k] = fixed_dofs.Value(k);
     }
   }
   // Set rows and columns of the sparse matrix corresponding to the fixed
   // solution components to zero
-  A.setZero([&selectvals](gdof_idx_t i, gdof_idx_t j) {
-    return (selectvals(i).first || selectvals(j).first);
+  A.setZero([&fixed_dofs](gdof_idx_t i, gdof_idx_t j) {
+    return (fixed_dofs.IsFixed(i) || fixed_dofs.IsFixed(j));
   });
   // Old implementation, demonstrating what is going on
   // lf::assemble::COOMatrix<double>::TripletVec::iterator new_last =
@@ -131,8 +217,7 @@ void FixFlaggedSolutionComponents(SELECTOR &&selectvals, COOMatrix<SCALAR> &A,
   // A.triplets().erase(new_last, A.triplets().end());
   // Add Unit diagonal entries corrresponding to fixed components
   for (lf::assemble::gdof_idx_t dofnum = 0; dofnum < N; ++dofnum) {
-    const auto selval{selectvals(dofnum)};
-    if (selval.first) {
+    if (fixed_dofs.IsFixed(dofnum)) {
       A.AddToEntry(dofnum, dofnum, 1.0);
     }
   }
@@ -189,17 +274,18 @@ void FixFlaggedSolutionCompAlt(SELECTOR &&selectvals, COOMatrix<SCALAR> &A,
   LF_ASSERT_MSG(N == b.size(),
                 "Mismatch N = " << N << " <-> b.size() = " << b.size());
 
+  // Query the selector only once for every d.o.f.
+  const FixedDofs<SCALAR> fixed_dofs(N, std::forward<SELECTOR>(selectvals));
   // Set vector components of right-hand-side vector for prescribed values
   for (lf::assemble::gdof_idx_t k = 0; k < N; ++k) {
-    const auto selval{selectvals(k)};
-    if (selval.first) {
-      b[k] = selval.second;
+    if (fixed_dofs.IsFixed(k)) {
+      b[k] = fixed_dofs.Value(k);
     }
   }
   // Set rows and columns of the sparse matrix corresponding to the fixed
   // solution components to zero
-  A.setZero([&selectvals](gdof_idx_t i, gdof_idx_t /*unused*/) {
-    return (selectvals(i).first);
+  A.setZero([&fixed_dofs](gdof_idx_t i, gdof_idx_t /*unused*/) {
+    return (fixed_dofs.IsFixed(i));
   });
   // Old implementation showing the algorithm:
   // lf::assemble::COOMatrix<double>::TripletVec::iterator new_last =
@@ -213,19 +299,12 @@ void FixFlaggedSolutionCompAlt(SELECTOR &&selectvals, COOMatrix<SCALAR> &A,
   // A.triplets().erase(new_last, A.triplets().end());
   // Add Unit diagonal entries corrresponding to fixed components
   for (lf::assemble::gdof_idx_t dofnum = 0; dofnum < N; ++dofnum) {
-    if (selectvals(dofnum).first) {
+    if (fixed_dofs.IsFixed(dofnum)) {
       A.AddToEntry(dofnum, dofnum, 1.0);
     }
   }
 }
 
-/**
- * @brief Information about fixed solution components
- */
-template <typename SCALAR>
-using fixed_components_t =
-    std::vector<std::pair<lf::assemble::gdof_idx_t, SCALAR>>;
-
 /**
  * @brief manipulate a square linear system of equations with a coefficient
  * matrix in COO format so that some solution components attain prescribed
@@ -277,6 +356,82 @@ void FixSolutionComponentsLse(
       A, b);
 }
 
+/**
+ * @brief enforce prescribed solution components directly in a compressed
+ * row-major sparse matrix, for several right-hand sides at once
+ *
+ * @tparam SCALAR underlying scalar type, e.g. double
+ * @tparam RHSMATRIX dense Eigen matrix or vector type
+ *
+ * @param fixed_dofs flags and values of the fixed solution components
+ * @param A _square_ compressed sparse matrix in row-major (CSR) format
+ * @param B right-hand-side vectors, one per column
+ * @param num_threads number of worker threads for the row sweep, `0` means "as
+ * many as there are hardware threads"
+ *
+ * Performs the same manipulation as FixFlaggedSolutionComponents(SELECTOR &&,
+ * COOMatrix<SCALAR> &, RHSVECTOR &): the contributions of the fixed
+ * components are moved to every right-hand side, rows and columns of fixed
+ * components are set to zero and a unit diagonal is put in their place. The
+ * same prescribed values are used for all columns of `B`.
+ *
+ * All of this is done in a single sweep over the rows of `A`. Since every row
+ * only updates its own entries and the corresponding row of `B`, rows can be
+ * processed concurrently. The sparsity pattern of `A` is left unchanged, so
+ * that eliminated entries remain as explicit zeros and the matrix still
+ * matches a SparsityPattern it was created from.
+ *
+ * @note The diagonal entries of fixed components must be present in the
+ * sparsity pattern of `A`, which is always the case for matrices arising
+ * from finite element assembly.
+ */
+template <typename SCALAR, typename RHSMATRIX>
+void FixFlaggedSolutionComponents(
+    const FixedDofs<SCALAR> &fixed_dofs,
+    Eigen::SparseMatrix<SCALAR, Eigen::RowMajor> &A, RHSMATRIX &B,
+    unsigned int num_threads = 0) {
+  const lf::assemble::size_type N(A.cols());
+  LF_ASSERT_MSG(A.rows() == N, "Matrix must be square!");
+  LF_ASSERT_MSG(A.isCompressed(), "Matrix must be compressed");
+  LF_ASSERT_MSG(N == fixed_dofs.NumDofs(),
+                "Mismatch N = " << N << " <-> " << fixed_dofs.NumDofs());
+  LF_ASSERT_MSG(N == B.rows(),
+                "Mismatch N = " << N << " <-> B.rows() = " << B.rows());
+  const auto *outer = A.outerIndexPtr();
+  const auto *inner = A.innerIndexPtr();
+  SCALAR *values = A.valuePtr();
+  const Eigen::Index num_rhs = B.cols();
+  lf::base::ParallelForChunks(
+      N, num_threads,
+      [&](unsigned int /*chunk*/, size_type begin, size_type end) -> void {
+        for (size_type i = begin; i < end; ++i) {
+          if (fixed_dofs.IsFixed(i)) {
+            bool has_diagonal = false;
+            for (auto k = outer[i]; k < outer[i + 1]; ++k) {
+              const bool is_diagonal = (static_cast<size_type>(inner[k]) == i);
+              has_diagonal = has_diagonal || is_diagonal;
+              values[k] = is_diagonal ? SCALAR(1) : SCALAR(0);
+            }
+            LF_VERIFY_MSG(has_diagonal,
+                          "No diagonal entry in row " << i << " of A");
+            for (Eigen::Index c = 0; c < num_rhs; ++c) {
+              B(i, c) = fixed_dofs.Value(i);
+            }
+          } else {
+            for (auto k = outer[i]; k < outer[i + 1]; ++k) {
+              if (fixed_dofs.IsFixed(inner[k])) {
+                const SCALAR a_ij_g_j = values[k] * fixed_dofs.Value(inner[k]);
+                for (Eigen::Index c = 0; c < num_rhs; ++c) {
+                  B(i, c) -= a_ij_g_j;
+                }
+                values[k] = SCALAR(0);
+              }
+            }
+          }
+        }
+      });
+}
+
 }  // namespace lf::assemble
 
 #endif
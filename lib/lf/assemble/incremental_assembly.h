@@ -0,0 +1,182 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Re-assembly of Galerkin matrices after local changes of the
+ * element matrices
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#ifndef _LF_ASSEMBLE_INCREMENTAL_ASSEMBLY_H
+#define _LF_ASSEMBLE_INCREMENTAL_ASSEMBLY_H
+
+#include <lf/mesh/utils/mesh_data_set.h>
+
+#include <Eigen/Sparse>
+#include <vector>
+
+#include "sparsity_pattern.h"
+
+namespace lf::assemble {
+
+/**
+ * @brief Galerkin matrix that keeps the contributions of all entities, so that
+ * it can be updated when only a few element matrices change
+ *
+ * @tparam SCALAR scalar type of the matrix
+ *
+ * In optimization loops or for coefficients with local support, often only
+ * the element matrices of a small set of cells change from one assembly to the
+ * next. Assemble() computes all element matrices, scatters them into a matrix
+ * with the given SparsityPattern and keeps them, aligned with the
+ * SparsityPattern::ScatterMap() of each entity. Update() recomputes the
+ * element matrices of a set of "dirty" entities only, subtracts the kept old
+ * contributions from the matrix and adds the new ones in place. Hence its cost
+ * is proportional to the number of dirty entities.
+ *
+ * Inactive entities contribute zero. An entity may switch between active and
+ * inactive, provided that it is marked dirty.
+ *
+ * @note Each update can change the matrix entries by round-off. After many
+ * updates it may be worthwhile to call Assemble() again.
+ *
+ * #### Memory
+ * The kept element matrices require as many scalars as the scatter maps of
+ * the pattern have entries.
+ */
+template <typename SCALAR>
+class IncrementalAssembler {
+ public:
+  using Scalar = SCALAR;
+  using Matrix = Eigen::SparseMatrix<SCALAR, Eigen::RowMajor>;
+
+  /**
+   * @brief Allocate the matrix and storage for the element matrices
+   *
+   * @param pattern sparsity pattern, must be alive as long as this object is
+   * used
+   */
+  explicit IncrementalAssembler(const SparsityPattern &pattern)
+      : pattern_(&pattern),
+        matrix_(pattern.MakeMatrix<SCALAR>()),
+        contributions_(pattern.NumScatterEntries(), SCALAR(0)) {}
+
+  /** @brief the Galerkin matrix, with the pattern of SparsityPattern */
+  [[nodiscard]] const Matrix &Galerkin() const { return matrix_; }
+  /** @brief the underlying sparsity pattern */
+  [[nodiscard]] const SparsityPattern &Pattern() const { return *pattern_; }
+
+  /**
+   * @brief Assemble the matrix from scratch
+   *
+   * @tparam ENTITY_MATRIX_PROVIDER models \ref entity_matrix_provider
+   * @param entity_matrix_provider provides the element matrices for the
+   * entities of co-dimension `Pattern().Codim()`
+   */
+  template <class ENTITY_MATRIX_PROVIDER>
+  void Assemble(ENTITY_MATRIX_PROVIDER &entity_matrix_provider) {
+    matrix_.coeffs().setZero();
+    std::fill(contributions_.begin(), contributions_.end(), SCALAR(0));
+    auto mesh = pattern_->TrialDofHandler().Mesh();
+    for (const lf::mesh::Entity *entity : mesh->Entities(pattern_->Codim())) {
+      UpdateEntity(*entity, mesh->Index(*entity), entity_matrix_provider);
+    }
+  }
+
+  /**
+   * @brief Replace the contributions of a list of entities
+   *
+   * @param entity_matrix_provider provides the new element matrices
+   * @param dirty indices of the entities whose element matrices have changed
+   *
+   * The cost is proportional to the length of `dirty`.
+   */
+  template <class ENTITY_MATRIX_PROVIDER>
+  void Update(ENTITY_MATRIX_PROVIDER &entity_matrix_provider,
+              nonstd::span<const glb_idx_t> dirty) {
+    auto mesh = pattern_->TrialDofHandler().Mesh();
+    for (const glb_idx_t idx : dirty) {
+      UpdateEntity(*mesh->EntityByIndex(pattern_->Codim(), idx), idx,
+                   entity_matrix_provider);
+    }
+  }
+
+  /**
+   * @brief Replace the contributions of all entities flagged in a mesh data
+   * set, e.g., a lf::mesh::utils::CodimMeshDataSet<bool>
+   *
+   * @param entity_matrix_provider provides the new element matrices
+   * @param dirty `true` for entities whose element matrices have changed
+   *
+   * All entities are visited for checking the flag, but element matrices are
+   * only computed for flagged entities.
+   */
+  template <class ENTITY_MATRIX_PROVIDER>
+  void Update(ENTITY_MATRIX_PROVIDER &entity_matrix_provider,
+              const lf::mesh::utils::MeshDataSet<bool> &dirty) {
+    auto mesh = pattern_->TrialDofHandler().Mesh();
+    for (const lf::mesh::Entity *entity : mesh->Entities(pattern_->Codim())) {
+      if (dirty.DefinedOn(*entity) && dirty(*entity)) {
+        UpdateEntity(*entity, mesh->Index(*entity), entity_matrix_provider);
+      }
+    }
+  }
+
+ private:
+  /** Replace the kept element matrix of one entity and update the matrix */
+  template <class ENTITY_MATRIX_PROVIDER>
+  void UpdateEntity(const lf::mesh::Entity &entity, glb_idx_t idx,
+                    ENTITY_MATRIX_PROVIDER &entity_matrix_provider);
+
+  const SparsityPattern *pattern_;
+  Matrix matrix_;
+  /** element matrices, entry (i,j) of the element matrix of an entity at
+   * position SparsityPattern::ScatterOffset() + i * ncols_loc + j */
+  std::vector<SCALAR> contributions_;
+};
+
+template <typename SCALAR>
+template <class ENTITY_MATRIX_PROVIDER>
+void IncrementalAssembler<SCALAR>::UpdateEntity(
+    const lf::mesh::Entity &entity, glb_idx_t idx,
+    ENTITY_MATRIX_PROVIDER &entity_matrix_provider) {
+  const nonstd::span<const size_type> scatter{pattern_->ScatterMap(idx)};
+  SCALAR *values = matrix_.valuePtr();
+  SCALAR *old = contributions_.data() + pattern_->ScatterOffset(idx);
+  const auto num_entries = static_cast<size_type>(scatter.size());
+  // Remove old contribution
+  for (size_type k = 0; k < num_entries; ++k) {
+    values[scatter[k]] -= old[k];
+  }
+  if (entity_matrix_provider.isActive(entity)) {
+    const size_type nrows_loc =
+        pattern_->TestDofHandler().NumLocalDofs(entity);
+    const size_type ncols_loc =
+        pattern_->TrialDofHandler().NumLocalDofs(entity);
+    const auto elem_mat{entity_matrix_provider.Eval(entity)};
+    LF_ASSERT_MSG(
+        elem_mat.rows() >= nrows_loc,
+        "nrows mismatch " << elem_mat.rows() << " <-> " << nrows_loc);
+    LF_ASSERT_MSG(
+        elem_mat.cols() >= ncols_loc,
+        "ncols mismatch " << elem_mat.cols() << " <-> " << ncols_loc);
+    size_type k = 0;
+    for (size_type i = 0; i < nrows_loc; ++i) {
+      for (size_type j = 0; j < ncols_loc; ++j, ++k) {
+        old[k] = elem_mat(i, j);
+        values[scatter[k]] += old[k];
+      }
+    }
+  } else {
+    std::fill(old, old + num_entries, SCALAR(0));
+  }
+}
+
+}  // namespace lf::assemble
+
+#endif
@@ -0,0 +1,160 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Multithreaded cell-oriented assembly of finite element matrices
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#ifndef _LF_PARALLEL_ASSEMBLER_H
+#define _LF_PARALLEL_ASSEMBLER_H
+
+#include <type_traits>
+#include <vector>
+
+#include "assembler.h"
+#include "coomatrix.h"
+
+namespace lf::assemble {
+
+/**
+ * @ingroup assemble_matrix_locally
+ * @brief Multithreaded variant of AssembleMatrixLocally()
+ *
+ * @tparam TMPMATRIX a type fitting the concept of COOMatrix
+ * @tparam ENTITY_MATRIX_PROVIDER a _copy-constructible_ type modelling the
+ * concept \ref entity_matrix_provider
+ * @param codim co-dimension of mesh entities which should be traversed
+ * @param dof_handler_trial a dof handler object for _column space_
+ * @param dof_handler_test a dof handler object for _row space_
+ * @param entity_matrix_provider prototype @ref entity_matrix_provider object
+ * @param matrix matrix object to which the assembled matrix will be added.
+ * @param num_threads number of worker threads, `0` means "as many as there
+ * are hardware threads", see lf::base::NumWorkerThreads().
+ *
+ * The range `mesh->Entities(codim)` is split into contiguous chunks, one per
+ * worker thread. Every worker
+ * - creates its _own copy_ of `entity_matrix_provider`, so that providers
+ *   whose `isActive()` and `Eval()` methods are not `const` (e.g.
+ *   lf::uscalfe::ReactionDiffusionElementMatrixProvider) can be used, and
+ * - collects the contributions of its entities in a private COOMatrix buffer.
+ *
+ * When all workers have finished, the buffers are appended to `matrix` in the
+ * order of the chunks. Hence `matrix` receives exactly the same sequence of
+ * `AddToEntry()` calls as in a serial run of AssembleMatrixLocally(), and
+ * the result is deterministic and independent of the number of threads.
+ *
+ * ### Thread-safety contract
+ *
+ * - ENTITY_MATRIX_PROVIDER must be copy-constructible. The copies are used
+ *   concurrently, which means that all state shared between copies (typically
+ *   held through `std::shared_ptr`s, e.g. finite element spaces or mesh
+ *   functions) must only be read in `isActive()` and `Eval()`.
+ * - Debugging output through `ass_mat_dbg_ctrl` is not supported and ignored.
+ *
+ * @note As AssembleMatrixLocally(), this function does not set `matrix` to
+ * zero in the beginning.
+ * @note Peak memory consumption is roughly twice that of the serial
+ * assembly, because all triplets are temporarily stored in the per-thread
+ * buffers.
+ */
+template <typename TMPMATRIX, class ENTITY_MATRIX_PROVIDER>
+void ParallelAssembleMatrixLocally(
+    dim_t codim, const DofHandler &dof_handler_trial,
+    const DofHandler &dof_handler_test,
+    const ENTITY_MATRIX_PROVIDER &entity_matrix_provider, TMPMATRIX &matrix,
+    unsigned int num_threads = 0) {
+  static_assert(std::is_copy_constructible_v<ENTITY_MATRIX_PROVIDER>,
+                "ParallelAssembleMatrixLocally() needs one copy of the entity "
+                "matrix provider per thread");
+  // Scalar type of element matrices
+  using scalar_t = typename std::decay_t<decltype(
+      std::declval<ENTITY_MATRIX_PROVIDER &>().Eval(
+          std::declval<const lf::mesh::Entity &>()))>::Scalar;
+  // Fetch pointer to underlying mesh
+  auto mesh = dof_handler_trial.Mesh();
+  LF_ASSERT_MSG(mesh == dof_handler_test.Mesh(),
+                "Trial and test space must be defined on the same mesh");
+  const nonstd::span<const lf::mesh::Entity *const> entities{
+      mesh->Entities(codim)};
+  const size_type num_entities = entities.size();
+  const unsigned int num_chunks = std::max(
+      1U, std::min<unsigned int>(lf::base::NumWorkerThreads(num_threads),
+                                 num_entities));
+  // One triplet buffer per chunk
+  std::vector<COOMatrix<scalar_t>> buffers(
+      num_chunks,
+      COOMatrix<scalar_t>(dof_handler_test.NumDofs(),
+                          dof_handler_trial.NumDofs()));
+  lf::base::ParallelForChunks(
+      num_entities, num_chunks,
+      [&](unsigned int chunk, size_type begin, size_type end) {
+        // Private copy of the provider for this thread
+        ENTITY_MATRIX_PROVIDER provider(entity_matrix_provider);
+        COOMatrix<scalar_t> &buffer{buffers[chunk]};
+        for (size_type k = begin; k < end; ++k) {
+          const lf::mesh::Entity &entity{*entities[k]};
+          if (provider.isActive(entity)) {
+            const size_type nrows_loc = dof_handler_test.NumLocalDofs(entity);
+            const size_type ncols_loc = dof_handler_trial.NumLocalDofs(entity);
+            nonstd::span<const gdof_idx_t> row_idx(
+                dof_handler_test.GlobalDofIndices(entity));
+            nonstd::span<const gdof_idx_t> col_idx(
+                dof_handler_trial.GlobalDofIndices(entity));
+            const auto elem_mat{provider.Eval(entity)};
+            LF_ASSERT_MSG(elem_mat.rows() >= nrows_loc,
+                          "nrows mismatch " << elem_mat.rows() << " <-> "
+                                            << nrows_loc);
+            LF_ASSERT_MSG(elem_mat.cols() >= ncols_loc,
+                          "ncols mismatch " << elem_mat.cols() << " <-> "
+                                            << ncols_loc);
+            for (size_type i = 0; i < nrows_loc; i++) {
+              for (size_type j = 0; j < ncols_loc; j++) {
+                buffer.AddToEntry(row_idx[i], col_idx[j], elem_mat(i, j));
+              }
+            }
+          }
+        }
+      });
+  // Deterministic merge: append buffers in the order of the chunks
+  for (COOMatrix<scalar_t> &buffer : buffers) {
+    for (const auto &trp : buffer.triplets()) {
+      matrix.AddToEntry(trp.row(), trp.col(), trp.value());
+    }
+    // Release memory as early as possible
+    buffer.triplets().clear();
+    buffer.triplets().shrink_to_fit();
+  }
+}
+
+/**
+ * @ingroup assemble_matrix_locally
+ * @brief Multithreaded entity-wise local assembly of a matrix
+ * @sa ParallelAssembleMatrixLocally(dim_t codim, const DofHandler &, const
+ * DofHandler &, const ENTITY_MATRIX_PROVIDER &, TMPMATRIX &, unsigned int)
+ *
+ * @return assembled matrix in a format determined by the template argument
+ *         TPMATRIX
+ */
+template <typename TMPMATRIX, class ENTITY_MATRIX_PROVIDER>
+TMPMATRIX ParallelAssembleMatrixLocally(
+    dim_t codim, const DofHandler &dof_handler_trial,
+    const DofHandler &dof_handler_test,
+    const ENTITY_MATRIX_PROVIDER &entity_matrix_provider,
+    unsigned int num_threads = 0) {
+  TMPMATRIX matrix{dof_handler_test.NumDofs(), dof_handler_trial.NumDofs()};
+  matrix.setZero();
+  ParallelAssembleMatrixLocally<TMPMATRIX, ENTITY_MATRIX_PROVIDER>(
+      codim, dof_handler_trial, dof_handler_test, entity_matrix_provider,
+      matrix, num_threads);
+  return matrix;
+}
+
+}  // namespace lf::assemble
+
+#endif
@@ -0,0 +1,238 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Implementation of subdomain d.o.f. handling
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#include "partitioned_dofhandler.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace lf::assemble {
+
+std::vector<size_type> PartitionCells(
+    const lf::mesh::Mesh &mesh, size_type num_parts,
+    lf::mesh::utils::SpaceFillingCurve curve) {
+  LF_VERIFY_MSG(num_parts > 0, "At least one subdomain required");
+  const std::vector<size_type> order = lf::mesh::utils::SpaceFillingCurveOrder(
+      lf::mesh::utils::EntityBarycenters(mesh, 0), curve);
+  const std::size_t num_cells = order.size();
+  std::vector<size_type> partition(num_cells);
+  for (std::size_t k = 0; k < num_cells; ++k) {
+    partition[order[k]] = static_cast<size_type>(k * num_parts / num_cells);
+  }
+  return partition;
+}
+
+SubdomainDofHandler::SubdomainDofHandler(
+    const DofHandler &dof_handler, std::vector<glb_idx_t> cells,
+    std::vector<gdof_idx_t> local_to_global, size_type num_owned)
+    : dofh_(&dof_handler),
+      mesh_p_(dof_handler.Mesh()),
+      cells_(std::move(cells)),
+      local_to_global_(std::move(local_to_global)),
+      num_owned_(num_owned) {
+  LF_VERIFY_MSG(num_owned_ <= local_to_global_.size(),
+                "More owned than local d.o.f.s");
+  const lf::mesh::Mesh *mesh = mesh_p_.get();
+  const dim_t dim_mesh = mesh->DimMesh();
+
+  // Inverse of the local-to-global map: local indices sorted by their global
+  // index
+  std::vector<gdof_idx_t> by_global(local_to_global_.size());
+  std::iota(by_global.begin(), by_global.end(), 0);
+  std::sort(by_global.begin(), by_global.end(),
+            [this](gdof_idx_t a, gdof_idx_t b) {
+              return local_to_global_[a] < local_to_global_[b];
+            });
+  // Indices of the cells of the subdomain and their sub-entities
+  entities_.resize(dim_mesh + 1);
+  entities_[0] = cells_;
+  for (const glb_idx_t cell_idx : cells_) {
+    const lf::mesh::Entity *cell = mesh->EntityByIndex(0, cell_idx);
+    for (dim_t rel_codim = 1; rel_codim <= dim_mesh; ++rel_codim) {
+      for (const lf::mesh::Entity *sub : cell->SubEntities(rel_codim)) {
+        entities_[rel_codim].push_back(mesh->Index(*sub));
+      }
+    }
+  }
+  for (std::vector<glb_idx_t> &indices : entities_) {
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+  }
+
+  // Translate the global indices of these entities
+  auto translate = [this, &by_global](nonstd::span<const gdof_idx_t> dofs,
+                                      std::vector<gdof_idx_t> &local_dofs) {
+    for (const gdof_idx_t dof : dofs) {
+      const auto it = std::lower_bound(
+          by_global.begin(), by_global.end(), dof,
+          [this](gdof_idx_t loc, gdof_idx_t glb) {
+            return local_to_global_[loc] < glb;
+          });
+      LF_ASSERT_MSG(
+          (it != by_global.end()) && (local_to_global_[*it] == dof),
+          "Global dof " << dof << " missing in subdomain");
+      local_dofs.push_back(*it);
+    }
+  };
+  offsets_.resize(dim_mesh + 1);
+  dofs_.resize(dim_mesh + 1);
+  int_offsets_.resize(dim_mesh + 1);
+  int_dofs_.resize(dim_mesh + 1);
+  for (dim_t codim = 0; codim <= dim_mesh; ++codim) {
+    const std::vector<glb_idx_t> &indices{entities_[codim]};
+    offsets_[codim].assign(indices.size() + 1, 0);
+    int_offsets_[codim].assign(indices.size() + 1, 0);
+    for (std::size_t k = 0; k < indices.size(); ++k) {
+      const lf::mesh::Entity *entity = mesh->EntityByIndex(codim, indices[k]);
+      translate(dof_handler.GlobalDofIndices(*entity), dofs_[codim]);
+      translate(dof_handler.InteriorGlobalDofIndices(*entity),
+                int_dofs_[codim]);
+      offsets_[codim][k + 1] = dofs_[codim].size();
+      int_offsets_[codim][k + 1] = int_dofs_[codim].size();
+    }
+  }
+}
+
+std::size_t SubdomainDofHandler::Position(dim_t codim, glb_idx_t idx) const {
+  const std::vector<glb_idx_t> &indices{entities_[codim]};
+  const auto it = std::lower_bound(indices.begin(), indices.end(), idx);
+  if ((it == indices.end()) || (*it != idx)) {
+    return kNotCovered;
+  }
+  return it - indices.begin();
+}
+
+nonstd::span<const gdof_idx_t> SubdomainDofHandler::GlobalDofIndices(
+    const lf::mesh::Entity &entity) const {
+  const dim_t codim = mesh_p_->DimMesh() - entity.RefEl().Dimension();
+  const std::size_t k = Position(codim, mesh_p_->Index(entity));
+  if (k == kNotCovered) {
+    return {};
+  }
+  const gdof_idx_t *data = dofs_[codim].data();
+  return {data + offsets_[codim][k], data + offsets_[codim][k + 1]};
+}
+
+nonstd::span<const gdof_idx_t> SubdomainDofHandler::InteriorGlobalDofIndices(
+    const lf::mesh::Entity &entity) const {
+  const dim_t codim = mesh_p_->DimMesh() - entity.RefEl().Dimension();
+  const std::size_t k = Position(codim, mesh_p_->Index(entity));
+  if (k == kNotCovered) {
+    return {};
+  }
+  const gdof_idx_t *data = int_dofs_[codim].data();
+  return {data + int_offsets_[codim][k], data + int_offsets_[codim][k + 1]};
+}
+
+PartitionedDofHandler::PartitionedDofHandler(
+    const DofHandler &dof_handler, const std::vector<size_type> &cell_partition)
+    : dofh_(&dof_handler) {
+  const lf::mesh::Mesh &mesh{*dof_handler.Mesh()};
+  const size_type num_cells = mesh.NumEntities(0);
+  LF_VERIFY_MSG(cell_partition.size() == num_cells,
+                "Partition has " << cell_partition.size() << " entries for "
+                                 << num_cells << " cells");
+  const size_type num_parts =
+      (num_cells == 0)
+          ? 1
+          : *std::max_element(cell_partition.begin(), cell_partition.end()) +
+                1;
+  const size_type num_dofs = dof_handler.NumDofs();
+
+  // Step I: cells of the subdomains and owners of the d.o.f.s
+  std::vector<std::vector<glb_idx_t>> cells(num_parts);
+  owner_.assign(num_dofs, num_parts);
+  for (glb_idx_t cell_idx = 0; cell_idx < num_cells; ++cell_idx) {
+    const size_type p = cell_partition[cell_idx];
+    cells[p].push_back(cell_idx);
+    for (const gdof_idx_t dof :
+         dof_handler.GlobalDofIndices(*mesh.EntityByIndex(0, cell_idx))) {
+      owner_[dof] = std::min(owner_[dof], p);
+    }
+  }
+  // D.o.f.s not covering any cell are assigned to the first subdomain
+  std::replace(owner_.begin(), owner_.end(), num_parts, size_type{0});
+
+  // Step II: partitioned numbering of owned d.o.f.s
+  owned_offsets_.assign(num_parts + 1, 0);
+  for (const size_type p : owner_) {
+    owned_offsets_[p + 1]++;
+  }
+  for (size_type p = 0; p < num_parts; ++p) {
+    owned_offsets_[p + 1] += owned_offsets_[p];
+  }
+  partitioned_index_.resize(num_dofs);
+  std::vector<gdof_idx_t> partitioned_to_global(num_dofs);
+  {
+    std::vector<gdof_idx_t> next(owned_offsets_.begin(),
+                                 owned_offsets_.end() - 1);
+    for (gdof_idx_t dof = 0; dof < num_dofs; ++dof) {
+      const gdof_idx_t pidx = next[owner_[dof]]++;
+      partitioned_index_[dof] = pidx;
+      partitioned_to_global[pidx] = dof;
+    }
+  }
+
+  // Step III: ghosts and local numberings. Ghosts are grouped by their owner,
+  // so that the messages between two subdomains are contiguous.
+  subdomains_.reserve(num_parts);
+  ghost_offsets_.assign(1, 0);
+  for (size_type p = 0; p < num_parts; ++p) {
+    std::vector<gdof_idx_t> ghosts;
+    for (const glb_idx_t cell_idx : cells[p]) {
+      for (const gdof_idx_t dof :
+           dof_handler.GlobalDofIndices(*mesh.EntityByIndex(0, cell_idx))) {
+        if (owner_[dof] != p) {
+          ghosts.push_back(dof);
+        }
+      }
+    }
+    // Sorting by partitioned index groups by owner and removes duplicates
+    std::sort(ghosts.begin(), ghosts.end(), [this](gdof_idx_t a, gdof_idx_t b) {
+      return partitioned_index_[a] < partitioned_index_[b];
+    });
+    ghosts.erase(std::unique(ghosts.begin(), ghosts.end()), ghosts.end());
+
+    std::vector<gdof_idx_t> local_to_global(
+        partitioned_to_global.begin() + owned_offsets_[p],
+        partitioned_to_global.begin() + owned_offsets_[p + 1]);
+    const auto num_owned = static_cast<size_type>(local_to_global.size());
+    for (const gdof_idx_t dof : ghosts) {
+      local_to_global.push_back(dof);
+      ghost_subdomain_.push_back(p);
+      ghost_owner_.push_back(owner_[dof]);
+      ghost_owner_local_.push_back(static_cast<size_type>(
+          partitioned_index_[dof] - owned_offsets_[owner_[dof]]));
+    }
+    ghost_offsets_.push_back(static_cast<size_type>(ghost_owner_.size()));
+    subdomains_.push_back(std::make_unique<SubdomainDofHandler>(
+        dof_handler, std::move(cells[p]), std::move(local_to_global),
+        num_owned));
+  }
+
+  // Step IV: for every owner the positions of the copies of its d.o.f.s
+  send_offsets_.assign(num_parts + 1, 0);
+  for (const size_type p : ghost_owner_) {
+    send_offsets_[p + 1]++;
+  }
+  for (size_type p = 0; p < num_parts; ++p) {
+    send_offsets_[p + 1] += send_offsets_[p];
+  }
+  send_ghosts_.resize(ghost_owner_.size());
+  std::vector<size_type> next(send_offsets_.begin(), send_offsets_.end() - 1);
+  for (size_type g = 0; g < ghost_owner_.size(); ++g) {
+    send_ghosts_[next[ghost_owner_[g]]++] = g;
+  }
+}
+
+}  // namespace lf::assemble
@@ -0,0 +1,467 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief D.o.f. handling for a partition of the cells of a mesh into
+ * subdomains with owned and ghost d.o.f.s
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#ifndef _LF_ASSEMBLE_PARTITIONED_DOFHANDLER_H
+#define _LF_ASSEMBLE_PARTITIONED_DOFHANDLER_H
+
+#include <lf/base/parallel.h>
+#include <lf/mesh/utils/space_filling_curve.h>
+
+#include <Eigen/Dense>
+#include <memory>
+#include <vector>
+
+#include "dofhandler.h"
+
+namespace lf::assemble {
+
+/**
+ * @brief Split the cells of a mesh into subdomains of (almost) equal size
+ *
+ * @param mesh the mesh
+ * @param num_parts number of subdomains, at least 1
+ * @param curve space-filling curve through the cell barycenters, which is cut
+ * into `num_parts` contiguous pieces
+ * @return vector holding the subdomain number of every cell, indexed by the
+ * cell index
+ *
+ * Pieces of space-filling curves are compact, so that the interfaces between
+ * subdomains are short.
+ */
+std::vector<size_type> PartitionCells(
+    const lf::mesh::Mesh &mesh, size_type num_parts,
+    lf::mesh::utils::SpaceFillingCurve curve =
+        lf::mesh::utils::SpaceFillingCurve::kHilbert);
+
+/**
+ * @brief Local-to-global index map restricted to the cells of one subdomain
+ *
+ * The global shape functions covering a cell of the subdomain are numbered
+ * locally: first the d.o.f.s _owned_ by the subdomain, then the _ghost_
+ * d.o.f.s, which are owned by a neighbouring subdomain. Within both groups
+ * the order of the global numbering is kept. `GlobalDofIndices()` returns
+ * these local indices for the cells of the subdomain and their sub-entities,
+ * and an empty range for all other entities.
+ *
+ * Only the entities covered by the subdomain are stored, so that the memory
+ * required by all subdomains together is about that of the global
+ * DofHandler. They are found by binary search in sorted index arrays.
+ *
+ * Thus a SubdomainDofHandler can be passed to the assembly functions in
+ * place of a global DofHandler. AssembleSubdomainMatrixLocally() and
+ * AssembleSubdomainVectorLocally() visit only the cells of the subdomain.
+ *
+ * Objects of this type are created by PartitionedDofHandler.
+ */
+class SubdomainDofHandler : public DofHandler {
+ public:
+  /**
+   * @brief Set up the local numbering
+   *
+   * @param dof_handler global d.o.f. handler
+   * @param cells indices of the cells of the subdomain
+   * @param local_to_global global indices of the local d.o.f.s, owned
+   * d.o.f.s first
+   * @param num_owned number of owned d.o.f.s
+   */
+  SubdomainDofHandler(const DofHandler &dof_handler,
+                      std::vector<glb_idx_t> cells,
+                      std::vector<gdof_idx_t> local_to_global,
+                      size_type num_owned);
+
+  /** @brief indices of the cells belonging to the subdomain */
+  [[nodiscard]] nonstd::span<const glb_idx_t> Cells() const {
+    return {cells_.data(), cells_.data() + cells_.size()};
+  }
+  /** @brief number of d.o.f.s owned by the subdomain */
+  [[nodiscard]] size_type NumOwnedDofs() const { return num_owned_; }
+  /** @brief number of ghost d.o.f.s of the subdomain */
+  [[nodiscard]] size_type NumGhostDofs() const {
+    return static_cast<size_type>(local_to_global_.size()) - num_owned_;
+  }
+  /**
+   * @brief global indices of all local d.o.f.s, the owned ones occupying the
+   * first NumOwnedDofs() positions
+   */
+  [[nodiscard]] nonstd::span<const gdof_idx_t> LocalToGlobal() const {
+    return {local_to_global_.data(),
+            local_to_global_.data() + local_to_global_.size()};
+  }
+
+  /** @copydoc DofHandler::NumDofs() */
+  [[nodiscard]] size_type NumDofs() const override {
+    return static_cast<size_type>(local_to_global_.size());
+  }
+  /** @copydoc DofHandler::NumLocalDofs() */
+  [[nodiscard]] size_type NumLocalDofs(
+      const lf::mesh::Entity &entity) const override {
+    return static_cast<size_type>(GlobalDofIndices(entity).size());
+  }
+  /** @copydoc DofHandler::NumInteriorDofs() */
+  [[nodiscard]] size_type NumInteriorDofs(
+      const lf::mesh::Entity &entity) const override {
+    return static_cast<size_type>(InteriorGlobalDofIndices(entity).size());
+  }
+  /** @copydoc DofHandler::GlobalDofIndices() */
+  [[nodiscard]] nonstd::span<const gdof_idx_t> GlobalDofIndices(
+      const lf::mesh::Entity &entity) const override;
+  /** @copydoc DofHandler::InteriorGlobalDofIndices() */
+  [[nodiscard]] nonstd::span<const gdof_idx_t> InteriorGlobalDofIndices(
+      const lf::mesh::Entity &entity) const override;
+  /** @copydoc DofHandler::Entity() */
+  [[nodiscard]] const lf::mesh::Entity &Entity(
+      gdof_idx_t dofnum) const override {
+    LF_ASSERT_MSG(dofnum < NumDofs(), "Illegal dof index " << dofnum);
+    return dofh_->Entity(local_to_global_[dofnum]);
+  }
+  /** @copydoc DofHandler::Mesh() */
+  [[nodiscard]] std::shared_ptr<const lf::mesh::Mesh> Mesh() const override {
+    return mesh_p_;
+  }
+
+ private:
+  /** returned by Position() for entities not covered by the subdomain */
+  static constexpr std::size_t kNotCovered = static_cast<std::size_t>(-1);
+  /** position of an entity in entities_[codim] or kNotCovered */
+  [[nodiscard]] std::size_t Position(dim_t codim, glb_idx_t idx) const;
+
+  const DofHandler *dofh_;                       /**< global numbering */
+  std::shared_ptr<const lf::mesh::Mesh> mesh_p_; /**< underlying mesh */
+  std::vector<glb_idx_t> cells_;                 /**< cells of subdomain */
+  std::vector<gdof_idx_t> local_to_global_;      /**< owned, then ghosts */
+  size_type num_owned_;                          /**< number of owned dofs */
+  /** for every co-dimension the sorted indices of the entities covered by
+   * the cells of the subdomain */
+  std::vector<std::vector<glb_idx_t>> entities_;
+  /** for every co-dimension start of the indices of the k-th entity in
+   * entities_ in dofs_ */
+  std::vector<std::vector<size_type>> offsets_;
+  /** local indices of local shape functions, for every co-dimension */
+  std::vector<std::vector<gdof_idx_t>> dofs_;
+  /** same as offsets_ for interior shape functions */
+  std::vector<std::vector<size_type>> int_offsets_;
+  /** same as dofs_ for interior shape functions */
+  std::vector<std::vector<gdof_idx_t>> int_dofs_;
+};
+
+/**
+ * @brief D.o.f. handling for subdomain-parallel computations within one
+ * process
+ *
+ * Given a partition of the cells into subdomains, every global d.o.f. is
+ * _owned_ by exactly one subdomain, namely the one with the smallest number
+ * among the subdomains whose cells it covers. A subdomain sees
+ * - its owned d.o.f.s and
+ * - the _ghost_ d.o.f.s covering its cells, which are owned by others,
+ *
+ * numbered locally by a SubdomainDofHandler. Additionally, the owned d.o.f.s
+ * of all subdomains are numbered contiguously one subdomain after the other
+ * in the _partitioned numbering_, see OwnedOffset() and PartitionedIndex().
+ *
+ * Computations on subdomains are fully independent and can be run by one
+ * thread each. Data on the interface is exchanged through an in-process
+ * stand-in for message passing, acting on one vector of local values per
+ * subdomain:
+ * - UpdateGhosts() copies the values of owned d.o.f.s to the ghost copies in
+ *   the neighbouring subdomains ("halo exchange"),
+ * - AccumulateGhosts() adds the values of ghost copies to the owning
+ *   subdomain and clears them ("reverse exchange" used after assembly).
+ *
+ * The exchange lists between pairs of subdomains are computed once in the
+ * constructor. Gather() and Scatter() convert between a global vector and
+ * the local vectors.
+ *
+ * ### Example: subassembled Galerkin matrix and matrix-vector product
+ * ~~~
+ * PartitionedDofHandler pdofh(dofh, PartitionCells(*mesh_p, num_threads));
+ * std::vector<Eigen::SparseMatrix<double>> A(pdofh.NumPartitions());
+ * lf::base::ParallelForChunks(pdofh.NumPartitions(), num_threads,
+ *     [&](unsigned, size_type begin, size_type end) {
+ *   for (size_type p = begin; p < end; ++p) {
+ *     const SubdomainDofHandler &sub{pdofh.Subdomain(p)};
+ *     COOMatrix<double> A_p(sub.NumDofs(), sub.NumDofs());
+ *     AssembleSubdomainMatrixLocally(sub, provider, A_p);
+ *     A[p] = A_p.makeSparse();
+ *   }
+ * });
+ * // y = A*x: local products, then accumulation on the interface
+ * std::vector<Eigen::VectorXd> x_loc = pdofh.Gather(x);
+ * std::vector<Eigen::VectorXd> y_loc(pdofh.NumPartitions());
+ * for (size_type p = 0; p < pdofh.NumPartitions(); ++p) {
+ *   y_loc[p] = A[p] * x_loc[p];
+ * }
+ * pdofh.AccumulateGhosts(y_loc);
+ * Eigen::VectorXd y = pdofh.Scatter(y_loc);
+ * ~~~
+ *
+ * @note The global DofHandler must be alive as long as this object is used.
+ */
+class PartitionedDofHandler {
+ public:
+  /**
+   * @brief Set up subdomains, ownership and exchange lists
+   *
+   * @param dof_handler global d.o.f. handler
+   * @param cell_partition number of the subdomain of every cell, indexed by
+   * the cell index. Subdomains are numbered from 0; the largest number
+   * occurring determines the number of subdomains.
+   */
+  PartitionedDofHandler(const DofHandler &dof_handler,
+                        const std::vector<size_type> &cell_partition);
+
+  PartitionedDofHandler(const PartitionedDofHandler &) = delete;
+  PartitionedDofHandler(PartitionedDofHandler &&) noexcept = default;
+  PartitionedDofHandler &operator=(const PartitionedDofHandler &) = delete;
+  PartitionedDofHandler &operator=(PartitionedDofHandler &&) noexcept =
+      default;
+  ~PartitionedDofHandler() = default;
+
+  /** @brief the global d.o.f. handler */
+  [[nodiscard]] const DofHandler &GlobalDofHandler() const { return *dofh_; }
+  /** @brief number of subdomains */
+  [[nodiscard]] size_type NumPartitions() const {
+    return static_cast<size_type>(subdomains_.size());
+  }
+  /** @brief local numbering of subdomain `p` */
+  [[nodiscard]] const SubdomainDofHandler &Subdomain(size_type p) const {
+    LF_ASSERT_MSG(p < NumPartitions(), "Illegal subdomain " << p);
+    return *subdomains_[p];
+  }
+  /** @brief subdomain owning a global d.o.f. */
+  [[nodiscard]] size_type Owner(gdof_idx_t dof) const { return owner_[dof]; }
+  /**
+   * @brief first index of the owned d.o.f.s of subdomain `p` in the
+   * partitioned numbering; `OwnedOffset(NumPartitions())` is the total
+   * number of d.o.f.s
+   */
+  [[nodiscard]] gdof_idx_t OwnedOffset(size_type p) const {
+    return owned_offsets_[p];
+  }
+  /** @brief index of a global d.o.f. in the partitioned numbering */
+  [[nodiscard]] gdof_idx_t PartitionedIndex(gdof_idx_t dof) const {
+    return partitioned_index_[dof];
+  }
+
+  /**
+   * @brief Local vectors of all subdomains holding the values of a global
+   * vector, including ghost values
+   */
+  template <typename SCALAR>
+  [[nodiscard]] std::vector<Eigen::Matrix<SCALAR, Eigen::Dynamic, 1>> Gather(
+      const Eigen::Matrix<SCALAR, Eigen::Dynamic, 1> &global) const {
+    LF_ASSERT_MSG(global.size() == dofh_->NumDofs(), "Size mismatch");
+    std::vector<Eigen::Matrix<SCALAR, Eigen::Dynamic, 1>> local(
+        NumPartitions());
+    for (size_type p = 0; p < NumPartitions(); ++p) {
+      const nonstd::span<const gdof_idx_t> l2g{subdomains_[p]->LocalToGlobal()};
+      const auto num_local = static_cast<size_type>(l2g.size());
+      local[p].resize(num_local);
+      for (size_type k = 0; k < num_local; ++k) {
+        local[p][k] = global[l2g[k]];
+      }
+    }
+    return local;
+  }
+
+  /**
+   * @brief Global vector composed of the values of owned d.o.f.s in the local
+   * vectors; ghost values are ignored
+   */
+  template <typename SCALAR>
+  [[nodiscard]] Eigen::Matrix<SCALAR, Eigen::Dynamic, 1> Scatter(
+      const std::vector<Eigen::Matrix<SCALAR, Eigen::Dynamic, 1>> &local)
+      const {
+    LF_ASSERT_MSG(local.size() == NumPartitions(), "Size mismatch");
+    Eigen::Matrix<SCALAR, Eigen::Dynamic, 1> global(dofh_->NumDofs());
+    for (size_type p = 0; p < NumPartitions(); ++p) {
+      const nonstd::span<const gdof_idx_t> l2g{subdomains_[p]->LocalToGlobal()};
+      for (size_type k = 0; k < subdomains_[p]->NumOwnedDofs(); ++k) {
+        global[l2g[k]] = local[p][k];
+      }
+    }
+    return global;
+  }
+
+  /**
+   * @brief Copy the values of owned d.o.f.s to their ghost copies in the
+   * other subdomains
+   *
+   * @param local one vector per subdomain, of length
+   * `Subdomain(p).NumDofs()`
+   * @param num_threads number of worker threads, see
+   * lf::base::NumWorkerThreads()
+   *
+   * Every subdomain receives the messages of its neighbours; subdomains are
+   * processed concurrently.
+   */
+  template <typename SCALAR>
+  void UpdateGhosts(
+      std::vector<Eigen::Matrix<SCALAR, Eigen::Dynamic, 1>> &local,
+      unsigned int num_threads = 1) const {
+    LF_ASSERT_MSG(local.size() == NumPartitions(), "Size mismatch");
+    lf::base::ParallelForChunks(
+        NumPartitions(), num_threads,
+        [&](unsigned int /*chunk*/, size_type begin, size_type end) {
+          for (size_type q = begin; q < end; ++q) {
+            const size_type num_owned = subdomains_[q]->NumOwnedDofs();
+            for (size_type g = ghost_offsets_[q]; g < ghost_offsets_[q + 1];
+                 ++g) {
+              local[q][num_owned + (g - ghost_offsets_[q])] =
+                  local[ghost_owner_[g]][ghost_owner_local_[g]];
+            }
+          }
+        });
+  }
+
+  /**
+   * @brief Add the values of ghost copies to the values of the owned
+   * d.o.f.s and set the ghost values to zero
+   *
+   * @param local one vector per subdomain, of length
+   * `Subdomain(p).NumDofs()`
+   * @param num_threads number of worker threads, see
+   * lf::base::NumWorkerThreads()
+   *
+   * After this call the owned values are those of the vector assembled
+   * globally. Every owner collects the contributions of its neighbours;
+   * subdomains are processed concurrently.
+   */
+  template <typename SCALAR>
+  void AccumulateGhosts(
+      std::vector<Eigen::Matrix<SCALAR, Eigen::Dynamic, 1>> &local,
+      unsigned int num_threads = 1) const {
+    LF_ASSERT_MSG(local.size() == NumPartitions(), "Size mismatch");
+    // Owned values are only written, ghost values only read
+    lf::base::ParallelForChunks(
+        NumPartitions(), num_threads,
+        [&](unsigned int /*chunk*/, size_type begin, size_type end) {
+          for (size_type p = begin; p < end; ++p) {
+            for (size_type m = send_offsets_[p]; m < send_offsets_[p + 1];
+                 ++m) {
+              const size_type g = send_ghosts_[m];
+              const size_type q = ghost_subdomain_[g];
+              local[p][ghost_owner_local_[g]] +=
+                  local[q][subdomains_[q]->NumOwnedDofs() +
+                           (g - ghost_offsets_[q])];
+            }
+          }
+        });
+    for (size_type q = 0; q < NumPartitions(); ++q) {
+      local[q].tail(subdomains_[q]->NumGhostDofs()).setZero();
+    }
+  }
+
+ private:
+  const DofHandler *dofh_; /**< global numbering */
+  /** local numberings of the subdomains */
+  std::vector<std::unique_ptr<SubdomainDofHandler>> subdomains_;
+  std::vector<size_type> owner_;               /**< owner of a global dof */
+  std::vector<gdof_idx_t> owned_offsets_;      /**< partitioned numbering */
+  std::vector<gdof_idx_t> partitioned_index_;  /**< global -> partitioned */
+  /** The ghosts of all subdomains, those of subdomain `q` at positions
+   * `ghost_offsets_[q]` to `ghost_offsets_[q+1]-1` in the order of their
+   * local indices */
+  /**@{*/
+  std::vector<size_type> ghost_offsets_;
+  std::vector<size_type> ghost_subdomain_;  /**< subdomain holding the ghost */
+  std::vector<size_type> ghost_owner_;      /**< owner of the ghost dof */
+  std::vector<size_type> ghost_owner_local_;  /**< local index at the owner */
+  /**@}*/
+  /** Positions in the ghost arrays of the copies of the owned d.o.f.s of
+   * subdomain `p`: `send_ghosts_[send_offsets_[p]]` ... (CSR format) */
+  /**@{*/
+  std::vector<size_type> send_offsets_;
+  std::vector<size_type> send_ghosts_;
+  /**@}*/
+};
+
+/**
+ * @ingroup assemble_matrix_locally
+ * @brief Assembly of the part of a Galerkin matrix belonging to the cells of
+ * one subdomain
+ *
+ * @tparam TMPMATRIX matrix type offering `AddToEntry()`
+ * @tparam ENTITY_MATRIX_PROVIDER models \ref entity_matrix_provider
+ * @param dof_handler local numbering of the subdomain, used for trial and
+ * test space
+ * @param entity_matrix_provider provider of element matrices
+ * @param matrix matrix of size `dof_handler.NumDofs()`, to which the
+ * contributions of the cells of the subdomain are added
+ *
+ * The sum of the subdomain matrices, each mapped to global indices, is the
+ * global Galerkin matrix. Calls for different subdomains do not share any
+ * data except for the provider and can run concurrently, if the provider is
+ * thread-safe (or copied).
+ */
+template <typename TMPMATRIX, class ENTITY_MATRIX_PROVIDER>
+void AssembleSubdomainMatrixLocally(
+    const SubdomainDofHandler &dof_handler,
+    ENTITY_MATRIX_PROVIDER &entity_matrix_provider, TMPMATRIX &matrix) {
+  const lf::mesh::Mesh &mesh{*dof_handler.Mesh()};
+  for (const glb_idx_t cell_idx : dof_handler.Cells()) {
+    const lf::mesh::Entity &cell{*mesh.EntityByIndex(0, cell_idx)};
+    if (entity_matrix_provider.isActive(cell)) {
+      const nonstd::span<const gdof_idx_t> dofs{
+          dof_handler.GlobalDofIndices(cell)};
+      const auto num_dofs = static_cast<size_type>(dofs.size());
+      const auto elem_mat{entity_matrix_provider.Eval(cell)};
+      LF_ASSERT_MSG(
+          (elem_mat.rows() >= num_dofs) && (elem_mat.cols() >= num_dofs),
+          "Element matrix too small");
+      for (size_type i = 0; i < num_dofs; ++i) {
+        for (size_type j = 0; j < num_dofs; ++j) {
+          matrix.AddToEntry(dofs[i], dofs[j], elem_mat(i, j));
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Assembly of the part of a right-hand side vector belonging to the
+ * cells of one subdomain
+ *
+ * @tparam VECTOR vector type offering `operator[]`
+ * @tparam ENTITY_VECTOR_PROVIDER models \ref entity_vector_provider
+ * @param dof_handler local numbering of the subdomain
+ * @param entity_vector_provider provider of element vectors
+ * @param resultvector vector of length `dof_handler.NumDofs()`, to which the
+ * contributions of the cells of the subdomain are added
+ *
+ * Apply PartitionedDofHandler::AccumulateGhosts() to the vectors of all
+ * subdomains in order to obtain the global vector in the owned entries.
+ */
+template <typename VECTOR, class ENTITY_VECTOR_PROVIDER>
+void AssembleSubdomainVectorLocally(
+    const SubdomainDofHandler &dof_handler,
+    ENTITY_VECTOR_PROVIDER &entity_vector_provider, VECTOR &resultvector) {
+  const lf::mesh::Mesh &mesh{*dof_handler.Mesh()};
+  for (const glb_idx_t cell_idx : dof_handler.Cells()) {
+    const lf::mesh::Entity &cell{*mesh.EntityByIndex(0, cell_idx)};
+    if (entity_vector_provider.isActive(cell)) {
+      const nonstd::span<const gdof_idx_t> dofs{
+          dof_handler.GlobalDofIndices(cell)};
+      const auto num_dofs = static_cast<size_type>(dofs.size());
+      const auto elem_vec{entity_vector_provider.Eval(cell)};
+      LF_ASSERT_MSG(elem_vec.size() >= num_dofs, "Element vector too small");
+      for (size_type i = 0; i < num_dofs; ++i) {
+        resultvector[dofs[i]] += elem_vec[i];
+      }
+    }
+  }
+}
+
+}  // namespace lf::assemble
+
+#endif
@@ -0,0 +1,73 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Symbolic phase of assembly: computation of sparsity patterns
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#include "sparsity_pattern.h"
+
+#include "coloring.h"
+
+namespace lf::assemble {
+
+SparsityPattern::SparsityPattern(dim_t codim,
+                                 const DofHandler &dof_handler_trial,
+                                 const DofHandler &dof_handler_test)
+    : codim_(codim),
+      dofh_trial_(&dof_handler_trial),
+      dofh_test_(&dof_handler_test),
+      num_rows_(dof_handler_test.NumDofs()),
+      num_cols_(dof_handler_trial.NumDofs()) {
+  auto mesh = dof_handler_trial.Mesh();
+  LF_ASSERT_MSG(mesh == dof_handler_test.Mesh(),
+                "Trial and test space must be defined on the same mesh");
+  const size_type num_entities = mesh->NumEntities(codim);
+
+  // Step I: CSR index arrays of the pattern
+  Eigen::SparseMatrix<double, Eigen::RowMajor, StorageIndex> pattern;
+  InitSparsityPattern(codim, dof_handler_trial, dof_handler_test, pattern);
+  outer_.assign(pattern.outerIndexPtr(),
+                pattern.outerIndexPtr() + num_rows_ + 1);
+  inner_.assign(pattern.innerIndexPtr(),
+                pattern.innerIndexPtr() + pattern.nonZeros());
+  pattern = Eigen::SparseMatrix<double, Eigen::RowMajor, StorageIndex>();
+
+  // Step II: position in the value array of every element matrix entry
+  entity_ptr_.assign(num_entities + 1, 0);
+  for (const lf::mesh::Entity *entity : mesh->Entities(codim)) {
+    entity_ptr_[mesh->Index(*entity) + 1] =
+        dof_handler_test.NumLocalDofs(*entity) *
+        dof_handler_trial.NumLocalDofs(*entity);
+  }
+  for (size_type k = 0; k < num_entities; ++k) {
+    entity_ptr_[k + 1] += entity_ptr_[k];
+  }
+  scatter_.resize(entity_ptr_[num_entities]);
+  for (const lf::mesh::Entity *entity : mesh->Entities(codim)) {
+    nonstd::span<const gdof_idx_t> row_idx(
+        dof_handler_test.GlobalDofIndices(*entity));
+    nonstd::span<const gdof_idx_t> col_idx(
+        dof_handler_trial.GlobalDofIndices(*entity));
+    size_type *pos = scatter_.data() + entity_ptr_[mesh->Index(*entity)];
+    for (const gdof_idx_t i : row_idx) {
+      const StorageIndex *row_begin = inner_.data() + outer_[i];
+      const StorageIndex *row_end = inner_.data() + outer_[i + 1];
+      for (const gdof_idx_t j : col_idx) {
+        const StorageIndex *found = std::lower_bound(
+            row_begin, row_end, static_cast<StorageIndex>(j));
+        LF_ASSERT_MSG((found != row_end) && (*found == j),
+                      "Entry (" << i << ',' << j << ") not in pattern");
+        *pos++ = static_cast<size_type>(found - inner_.data());
+      }
+    }
+  }
+}
+
+}  // namespace lf::assemble
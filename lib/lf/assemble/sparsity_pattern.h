@@ -0,0 +1,241 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Reusable sparsity pattern of Galerkin matrices, enabling a split of
+ * assembly into a symbolic and a numeric phase
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#ifndef _LF_ASSEMBLE_SPARSITY_PATTERN_H
+#define _LF_ASSEMBLE_SPARSITY_PATTERN_H
+
+#include <Eigen/Sparse>
+#include <algorithm>
+#include <vector>
+
+#include "dofhandler.h"
+
+namespace lf::assemble {
+
+/**
+ * @brief Sparsity pattern of a Galerkin matrix in CSR format together with
+ * per-entity maps from local element matrix entries to positions in the value
+ * array
+ *
+ * Symbolic phase: the constructor determines, which entries of a Galerkin
+ * matrix can receive contributions from entities of a given co-dimension:
+ * entry `(i,j)` belongs to the pattern, if and only if there is an entity to
+ * which both test d.o.f. `i` and trial d.o.f. `j` belong. For every entity
+ * it also stores the position in the CSR value array of every entry of its
+ * element matrix.
+ *
+ * Numeric phase: AssembleMatrixLocally(const SparsityPattern &,
+ * ENTITY_MATRIX_PROVIDER &, Eigen::SparseMatrix<SCALAR, Eigen::RowMajor> &)
+ * then scatters element matrices directly into the value array of a matrix
+ * created by MakeMatrix(). This involves neither sorting nor index searches
+ * nor memory allocation, so that the cost of repeated assembly, e.g., in time
+ * stepping or Newton iterations, is proportional to the number of non-zero
+ * entries.
+ *
+ * The pattern depends only on the two DofHandler objects. It does not know
+ * which entities are active for a particular entity matrix provider and
+ * therefore may contain entries that remain zero.
+ *
+ * #### Example usage
+ * @snippet assembler.cc sparsity_usage
+ */
+class SparsityPattern {
+ public:
+  /** @brief Storage index type, the same as Eigen's default */
+  using StorageIndex = int;
+
+  /**
+   * @brief Symbolic phase: compute pattern and per-entity scatter maps
+   *
+   * @param codim co-dimension of entities contributing to the matrix
+   * @param dof_handler_trial dof handler for the _column space_
+   * @param dof_handler_test dof handler for the _row space_
+   *
+   * Both DofHandler objects must be alive as long as the pattern is used.
+   */
+  SparsityPattern(dim_t codim, const DofHandler &dof_handler_trial,
+                  const DofHandler &dof_handler_test);
+
+  SparsityPattern(const SparsityPattern &) = default;
+  SparsityPattern(SparsityPattern &&) noexcept = default;
+  SparsityPattern &operator=(const SparsityPattern &) = default;
+  SparsityPattern &operator=(SparsityPattern &&) noexcept = default;
+  ~SparsityPattern() = default;
+
+  /** @brief number of rows = number of test space d.o.f.s */
+  [[nodiscard]] size_type rows() const { return num_rows_; }
+  /** @brief number of columns = number of trial space d.o.f.s */
+  [[nodiscard]] size_type cols() const { return num_cols_; }
+  /** @brief number of entries in the pattern */
+  [[nodiscard]] size_type NonZeros() const {
+    return static_cast<size_type>(inner_.size());
+  }
+  /** @brief co-dimension of the entities the pattern was built for */
+  [[nodiscard]] dim_t Codim() const { return codim_; }
+
+  /** @brief CSR row pointers, length rows()+1 */
+  [[nodiscard]] nonstd::span<const StorageIndex> OuterIndices() const {
+    return {outer_.data(), outer_.data() + outer_.size()};
+  }
+  /** @brief CSR column indices, sorted within each row */
+  [[nodiscard]] nonstd::span<const StorageIndex> InnerIndices() const {
+    return {inner_.data(), inner_.data() + inner_.size()};
+  }
+
+  /**
+   * @brief Positions in the CSR value array of the entries of the element
+   * matrix of an entity
+   *
+   * @param entity_index index of an entity of co-dimension Codim()
+   * @return span of length `NumLocalDofs_test * NumLocalDofs_trial`, entry
+   * `(i,j)` of the element matrix is added to the value with position
+   * `result[i * NumLocalDofs_trial + j]`.
+   */
+  [[nodiscard]] nonstd::span<const size_type> ScatterMap(
+      glb_idx_t entity_index) const {
+    LF_ASSERT_MSG(entity_index + 1 < entity_ptr_.size(),
+                  "Index " << entity_index << " out of range");
+    return {scatter_.data() + entity_ptr_[entity_index],
+            scatter_.data() + entity_ptr_[entity_index + 1]};
+  }
+
+  /**
+   * @brief Position of ScatterMap() of an entity in the concatenation of the
+   * scatter maps of all entities, ordered by index
+   *
+   * @param entity_index index of an entity of co-dimension Codim(), or the
+   * number of such entities, which yields NumScatterEntries()
+   */
+  [[nodiscard]] size_type ScatterOffset(glb_idx_t entity_index) const {
+    LF_ASSERT_MSG(entity_index < entity_ptr_.size(),
+                  "Index " << entity_index << " out of range");
+    return entity_ptr_[entity_index];
+  }
+  /** @brief total length of the scatter maps of all entities */
+  [[nodiscard]] size_type NumScatterEntries() const {
+    return static_cast<size_type>(scatter_.size());
+  }
+
+  /** @brief Check whether the pattern was built from the given DofHandlers */
+  [[nodiscard]] bool BuiltFrom(const DofHandler &dof_handler_trial,
+                               const DofHandler &dof_handler_test) const {
+    return (&dof_handler_trial == dofh_trial_) &&
+           (&dof_handler_test == dofh_test_);
+  }
+
+  /** @brief DofHandler for the column space */
+  [[nodiscard]] const DofHandler &TrialDofHandler() const {
+    return *dofh_trial_;
+  }
+  /** @brief DofHandler for the row space */
+  [[nodiscard]] const DofHandler &TestDofHandler() const { return *dofh_test_; }
+
+  /**
+   * @brief Create a compressed row-major sparse matrix with this pattern and
+   * all values zero
+   */
+  template <typename SCALAR>
+  [[nodiscard]] Eigen::SparseMatrix<SCALAR, Eigen::RowMajor> MakeMatrix()
+      const {
+    Eigen::SparseMatrix<SCALAR, Eigen::RowMajor> mat(num_rows_, num_cols_);
+    mat.resizeNonZeros(static_cast<Eigen::Index>(inner_.size()));
+    std::copy(outer_.begin(), outer_.end(), mat.outerIndexPtr());
+    std::copy(inner_.begin(), inner_.end(), mat.innerIndexPtr());
+    std::fill(mat.valuePtr(), mat.valuePtr() + inner_.size(), SCALAR(0));
+    return mat;
+  }
+
+  /**
+   * @brief Check whether a matrix has been created by MakeMatrix(), i.e.,
+   * whether it is compressed and has exactly this pattern
+   */
+  template <typename SCALAR>
+  [[nodiscard]] bool Matches(
+      const Eigen::SparseMatrix<SCALAR, Eigen::RowMajor> &mat) const {
+    return mat.isCompressed() &&
+           (mat.rows() == static_cast<Eigen::Index>(num_rows_)) &&
+           (mat.cols() == static_cast<Eigen::Index>(num_cols_)) &&
+           (mat.nonZeros() == static_cast<Eigen::Index>(inner_.size())) &&
+           std::equal(outer_.begin(), outer_.end(), mat.outerIndexPtr()) &&
+           std::equal(inner_.begin(), inner_.end(), mat.innerIndexPtr());
+  }
+
+ private:
+  dim_t codim_;                   /**< co-dimension of entities */
+  const DofHandler *dofh_trial_;  /**< column space */
+  const DofHandler *dofh_test_;   /**< row space */
+  size_type num_rows_;            /**< number of rows */
+  size_type num_cols_;            /**< number of columns */
+  std::vector<StorageIndex> outer_; /**< CSR row pointers */
+  std::vector<StorageIndex> inner_; /**< CSR column indices */
+  /** start of scatter map of every entity in scatter_ */
+  std::vector<size_type> entity_ptr_;
+  /** concatenated scatter maps of all entities */
+  std::vector<size_type> scatter_;
+};
+
+/**
+ * @ingroup assemble_matrix_locally
+ * @brief Numeric phase of assembly: scatter element matrices into the values
+ * of a matrix with a precomputed sparsity pattern
+ *
+ * @tparam ENTITY_MATRIX_PROVIDER a type modelling the concept \ref
+ * entity_matrix_provider
+ * @param pattern sparsity pattern built from the trial and test space
+ * DofHandler objects
+ * @param entity_matrix_provider @ref entity_matrix_provider object
+ * @param matrix matrix created by `pattern.MakeMatrix()`. Contributions are
+ * added to the current values, use `matrix.coeffs().setZero()` to reset the
+ * matrix before re-assembly.
+ *
+ * This function visits the same entities in the same order as
+ * AssembleMatrixLocally(dim_t, const DofHandler &, const DofHandler &,
+ * ENTITY_MATRIX_PROVIDER &, TMPMATRIX &), but adds every entry of an element
+ * matrix to the value array position found in SparsityPattern::ScatterMap().
+ */
+template <class ENTITY_MATRIX_PROVIDER, typename SCALAR>
+void AssembleMatrixLocally(
+    const SparsityPattern &pattern,
+    ENTITY_MATRIX_PROVIDER &entity_matrix_provider,
+    Eigen::SparseMatrix<SCALAR, Eigen::RowMajor> &matrix) {
+  LF_ASSERT_MSG(pattern.Matches(matrix),
+                "Matrix was not created from the sparsity pattern");
+  const DofHandler &dof_handler_trial{pattern.TrialDofHandler()};
+  const DofHandler &dof_handler_test{pattern.TestDofHandler()};
+  auto mesh = dof_handler_trial.Mesh();
+  SCALAR *values = matrix.valuePtr();
+  for (const lf::mesh::Entity *entity : mesh->Entities(pattern.Codim())) {
+    if (entity_matrix_provider.isActive(*entity)) {
+      const size_type nrows_loc = dof_handler_test.NumLocalDofs(*entity);
+      const size_type ncols_loc = dof_handler_trial.NumLocalDofs(*entity);
+      const auto elem_mat{entity_matrix_provider.Eval(*entity)};
+      LF_ASSERT_MSG(elem_mat.rows() >= nrows_loc,
+                    "nrows mismatch " << elem_mat.rows() << " <-> "
+                                      << nrows_loc);
+      LF_ASSERT_MSG(elem_mat.cols() >= ncols_loc,
+                    "ncols mismatch " << elem_mat.cols() << " <-> "
+                                      << ncols_loc);
+      const size_type *pos = pattern.ScatterMap(mesh->Index(*entity)).data();
+      for (size_type i = 0; i < nrows_loc; i++) {
+        for (size_type j = 0; j < ncols_loc; j++) {
+          values[*pos++] += elem_mat(i, j);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace lf::assemble
+
+#endif
@@ -0,0 +1,309 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Static condensation of cell-interior degrees of freedom
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#ifndef _LF_ASSEMBLE_STATIC_CONDENSATION_H
+#define _LF_ASSEMBLE_STATIC_CONDENSATION_H
+
+#include <Eigen/Dense>
+#include <vector>
+
+#include "dofhandler.h"
+
+namespace lf::assemble {
+
+/**
+ * @brief Assembly of a linear system from which the degrees of freedom
+ * interior to cells have been eliminated
+ *
+ * @tparam SCALAR scalar type of the linear system
+ *
+ * Global shape functions associated with cells, see
+ * DofHandler::InteriorGlobalDofIndices(), couple only with the shape
+ * functions of the same cell. Splitting the local d.o.f.s of a cell into
+ * interior (I) and skeleton (B) ones, the element matrix and element vector
+ * read
+ * \f[
+ *   \mathbf{A}_K = \left[\begin{array}{cc} \mathbf{A}_{BB} & \mathbf{A}_{BI} \\
+ *   \mathbf{A}_{IB} & \mathbf{A}_{II} \end{array}\right]\quad,\quad
+ *   \boldsymbol{\varphi}_K = \left[\begin{array}{c} \boldsymbol{\varphi}_B \\
+ *   \boldsymbol{\varphi}_I \end{array}\right]\;.
+ * \f]
+ * AssembleSkeleton() assembles the Schur complements
+ * \f$\mathbf{A}_{BB}-\mathbf{A}_{BI}\mathbf{A}_{II}^{-1}\mathbf{A}_{IB}\f$ and
+ * the condensed vectors \f$\boldsymbol{\varphi}_B -
+ * \mathbf{A}_{BI}\mathbf{A}_{II}^{-1}\boldsymbol{\varphi}_I\f$ into a linear
+ * system for the skeleton d.o.f.s only. After solving it, Reconstruct()
+ * recovers the interior d.o.f.s cell by cell from
+ * \f$\mathbf{x}_I = \mathbf{A}_{II}^{-1}(\boldsymbol{\varphi}_I -
+ * \mathbf{A}_{IB}\mathbf{x}_B)\f$, for which the matrices
+ * \f$\mathbf{A}_{II}^{-1}\mathbf{A}_{IB}\f$ and vectors
+ * \f$\mathbf{A}_{II}^{-1}\boldsymbol{\varphi}_I\f$ are kept.
+ *
+ * Skeleton d.o.f.s are numbered consecutively in the order of their global
+ * indices, see SkeletonIndex(). Contributions to the skeleton system from
+ * entities of other co-dimensions, e.g., boundary terms, and the treatment of
+ * essential boundary conditions must use this numbering.
+ *
+ * The benefit of condensation grows with the polynomial degree: for cubic
+ * Lagrangian finite elements on triangles every cell carries one interior
+ * d.o.f., for quadrilaterals four.
+ */
+template <typename SCALAR>
+class StaticCondensation {
+ public:
+  using Scalar = SCALAR;
+  using Vector = Eigen::Matrix<SCALAR, Eigen::Dynamic, 1>;
+
+  /**
+   * @brief Determine the skeleton d.o.f.s
+   *
+   * @param dof_handler d.o.f. handler for the full finite element space, must
+   * be alive as long as this object is used
+   */
+  explicit StaticCondensation(const DofHandler &dof_handler)
+      : dofh_(&dof_handler),
+        skeleton_idx_(dof_handler.NumDofs(), 0),
+        num_skeleton_dofs_(0) {
+    auto mesh = dof_handler.Mesh();
+    for (const lf::mesh::Entity *cell : mesh->Entities(0)) {
+      for (const gdof_idx_t dof : dof_handler.InteriorGlobalDofIndices(*cell)) {
+        skeleton_idx_[dof] = kInterior;
+      }
+    }
+    for (gdof_idx_t &idx : skeleton_idx_) {
+      if (idx != kInterior) {
+        idx = num_skeleton_dofs_++;
+      }
+    }
+  }
+
+  /** @brief number of d.o.f.s of the full system */
+  [[nodiscard]] size_type NumDofs() const { return dofh_->NumDofs(); }
+  /** @brief number of d.o.f.s of the condensed system */
+  [[nodiscard]] size_type NumSkeletonDofs() const {
+    return num_skeleton_dofs_;
+  }
+  /**
+   * @brief index of a global d.o.f. in the condensed system, `-1` for
+   * d.o.f.s interior to cells
+   */
+  [[nodiscard]] gdof_idx_t SkeletonIndex(gdof_idx_t dof) const {
+    return skeleton_idx_[dof];
+  }
+
+  /**
+   * @brief Assemble the condensed linear system
+   *
+   * @tparam ENTITY_MATRIX_PROVIDER models \ref entity_matrix_provider
+   * @tparam ENTITY_VECTOR_PROVIDER models \ref entity_vector_provider
+   * @tparam TMPMATRIX matrix type offering `AddToEntry()`, e.g. COOMatrix
+   * @tparam VECTOR vector type with access through `[]`
+   * @param entity_matrix_provider provider of element matrices for cells
+   * @param entity_vector_provider provider of element vectors for cells
+   * @param matrix matrix of size NumSkeletonDofs() x NumSkeletonDofs(),
+   * Schur complements are added to it
+   * @param vec vector of length NumSkeletonDofs(), condensed element vectors
+   * are added to it
+   *
+   * The element matrix provider must be active on all cells carrying interior
+   * d.o.f.s, and the interior blocks of the element matrices must be
+   * invertible. Each call overwrites the data kept for Reconstruct().
+   */
+  template <class ENTITY_MATRIX_PROVIDER, class ENTITY_VECTOR_PROVIDER,
+            typename TMPMATRIX, typename VECTOR>
+  void AssembleSkeleton(ENTITY_MATRIX_PROVIDER &entity_matrix_provider,
+                        ENTITY_VECTOR_PROVIDER &entity_vector_provider,
+                        TMPMATRIX &matrix, VECTOR &vec);
+
+  /**
+   * @brief Recover the solution of the full system
+   *
+   * @param skeleton_sol solution of the condensed system
+   * @param num_threads number of worker threads, `0` means "as many as there
+   * are hardware threads"
+   * @return vector of length NumDofs()
+   *
+   * Cells are processed concurrently, since each of them writes only its own
+   * interior d.o.f.s.
+   */
+  [[nodiscard]] Vector Reconstruct(const Vector &skeleton_sol,
+                                   unsigned int num_threads = 0) const;
+
+ private:
+  static constexpr gdof_idx_t kInterior = -1;
+
+  const DofHandler *dofh_;                /**< full finite element space */
+  std::vector<gdof_idx_t> skeleton_idx_;  /**< see SkeletonIndex() */
+  size_type num_skeleton_dofs_;           /**< size of condensed system */
+  /** start of the data of every cell in factors_ */
+  std::vector<std::size_t> cell_offsets_;
+  /**
+   * for every cell the column-major matrix \f$A_{II}^{-1}A_{IB}\f$ followed
+   * by the vector \f$A_{II}^{-1}\varphi_I\f$
+   */
+  std::vector<SCALAR> factors_;
+};
+
+template <typename SCALAR>
+template <class ENTITY_MATRIX_PROVIDER, class ENTITY_VECTOR_PROVIDER,
+          typename TMPMATRIX, typename VECTOR>
+void StaticCondensation<SCALAR>::AssembleSkeleton(
+    ENTITY_MATRIX_PROVIDER &entity_matrix_provider,
+    ENTITY_VECTOR_PROVIDER &entity_vector_provider, TMPMATRIX &matrix,
+    VECTOR &vec) {
+  using mat_t = Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>;
+  auto mesh = dofh_->Mesh();
+  cell_offsets_.assign(mesh->NumEntities(0) + 1, 0);
+  factors_.clear();
+  // local positions of skeleton and interior d.o.f.s of a cell
+  std::vector<Eigen::Index> b_loc;
+  std::vector<Eigen::Index> i_loc;
+  for (glb_idx_t cell_idx = 0; cell_idx < mesh->NumEntities(0); ++cell_idx) {
+    const lf::mesh::Entity &cell{*mesh->EntityByIndex(0, cell_idx)};
+    const nonstd::span<const gdof_idx_t> dofs{dofh_->GlobalDofIndices(cell)};
+    const auto n_loc = static_cast<Eigen::Index>(dofs.size());
+    b_loc.clear();
+    i_loc.clear();
+    for (Eigen::Index k = 0; k < n_loc; ++k) {
+      (skeleton_idx_[dofs[k]] == kInterior ? i_loc : b_loc).push_back(k);
+    }
+    const auto n_b = static_cast<Eigen::Index>(b_loc.size());
+    const auto n_i = static_cast<Eigen::Index>(i_loc.size());
+
+    Vector elem_vec = Vector::Zero(n_loc);
+    if (entity_vector_provider.isActive(cell)) {
+      const auto vec_loc{entity_vector_provider.Eval(cell)};
+      LF_ASSERT_MSG(vec_loc.size() >= n_loc,
+                    "size mismatch of element vector on cell " << cell_idx);
+      elem_vec = vec_loc.head(n_loc);
+    }
+    if (!entity_matrix_provider.isActive(cell)) {
+      LF_VERIFY_MSG(n_i == 0, "Provider inactive on cell "
+                                  << cell_idx << " with interior d.o.f.s");
+      cell_offsets_[cell_idx + 1] = factors_.size();
+      // Without interior d.o.f.s the element vector goes to the skeleton
+      // right-hand side unchanged
+      for (Eigen::Index r = 0; r < n_b; ++r) {
+        vec[skeleton_idx_[dofs[b_loc[r]]]] += elem_vec[b_loc[r]];
+      }
+      continue;
+    }
+    const auto elem_mat{entity_matrix_provider.Eval(cell)};
+    LF_ASSERT_MSG((elem_mat.rows() >= n_loc) && (elem_mat.cols() >= n_loc),
+                  "size mismatch of element matrix on cell " << cell_idx);
+
+    // Partition element matrix and vector
+    mat_t a_bb(n_b, n_b);
+    mat_t a_bi(n_b, n_i);
+    mat_t a_ib(n_i, n_b);
+    mat_t a_ii(n_i, n_i);
+    Vector f_b(n_b);
+    Vector f_i(n_i);
+    for (Eigen::Index r = 0; r < n_b; ++r) {
+      f_b[r] = elem_vec[b_loc[r]];
+      for (Eigen::Index c = 0; c < n_b; ++c) {
+        a_bb(r, c) = elem_mat(b_loc[r], b_loc[c]);
+      }
+      for (Eigen::Index c = 0; c < n_i; ++c) {
+        a_bi(r, c) = elem_mat(b_loc[r], i_loc[c]);
+      }
+    }
+    for (Eigen::Index r = 0; r < n_i; ++r) {
+      f_i[r] = elem_vec[i_loc[r]];
+      for (Eigen::Index c = 0; c < n_b; ++c) {
+        a_ib(r, c) = elem_mat(i_loc[r], b_loc[c]);
+      }
+      for (Eigen::Index c = 0; c < n_i; ++c) {
+        a_ii(r, c) = elem_mat(i_loc[r], i_loc[c]);
+      }
+    }
+
+    // Eliminate interior d.o.f.s and keep data for reconstruction
+    if (n_i > 0) {
+      const Eigen::PartialPivLU<mat_t> lu(a_ii);
+      const mat_t inv_a_ib = lu.solve(a_ib);
+      const Vector inv_f_i = lu.solve(f_i);
+      a_bb -= a_bi * inv_a_ib;
+      f_b -= a_bi * inv_f_i;
+      factors_.insert(factors_.end(), inv_a_ib.data(),
+                      inv_a_ib.data() + inv_a_ib.size());
+      factors_.insert(factors_.end(), inv_f_i.data(),
+                      inv_f_i.data() + inv_f_i.size());
+    }
+    cell_offsets_[cell_idx + 1] = factors_.size();
+
+    // Assemble into the skeleton system
+    for (Eigen::Index r = 0; r < n_b; ++r) {
+      const gdof_idx_t row = skeleton_idx_[dofs[b_loc[r]]];
+      vec[row] += f_b[r];
+      for (Eigen::Index c = 0; c < n_b; ++c) {
+        matrix.AddToEntry(row, skeleton_idx_[dofs[b_loc[c]]], a_bb(r, c));
+      }
+    }
+  }
+}
+
+template <typename SCALAR>
+typename StaticCondensation<SCALAR>::Vector
+StaticCondensation<SCALAR>::Reconstruct(const Vector &skeleton_sol,
+                                        unsigned int num_threads) const {
+  LF_ASSERT_MSG(skeleton_sol.size() == num_skeleton_dofs_,
+                "Size mismatch " << skeleton_sol.size()
+                                 << " <-> " << num_skeleton_dofs_);
+  auto mesh = dofh_->Mesh();
+  LF_VERIFY_MSG(cell_offsets_.size() == mesh->NumEntities(0) + 1,
+                "AssembleSkeleton() must be called before Reconstruct()");
+  Vector sol(dofh_->NumDofs());
+  for (size_type dof = 0; dof < dofh_->NumDofs(); ++dof) {
+    if (skeleton_idx_[dof] != kInterior) {
+      sol[dof] = skeleton_sol[skeleton_idx_[dof]];
+    }
+  }
+  lf::base::ParallelForChunks(
+      mesh->NumEntities(0), num_threads,
+      [&](unsigned int /*chunk*/, size_type begin, size_type end) -> void {
+        std::vector<gdof_idx_t> b_dofs;
+        std::vector<gdof_idx_t> i_dofs;
+        for (glb_idx_t cell_idx = begin; cell_idx < end; ++cell_idx) {
+          const lf::mesh::Entity &cell{*mesh->EntityByIndex(0, cell_idx)};
+          b_dofs.clear();
+          i_dofs.clear();
+          for (const gdof_idx_t dof : dofh_->GlobalDofIndices(cell)) {
+            (skeleton_idx_[dof] == kInterior ? i_dofs : b_dofs).push_back(dof);
+          }
+          if (i_dofs.empty()) {
+            continue;
+          }
+          const auto n_b = static_cast<Eigen::Index>(b_dofs.size());
+          const auto n_i = static_cast<Eigen::Index>(i_dofs.size());
+          const SCALAR *data = factors_.data() + cell_offsets_[cell_idx];
+          const Eigen::Map<const Eigen::Matrix<SCALAR, Eigen::Dynamic,
+                                               Eigen::Dynamic>>
+              inv_a_ib(data, n_i, n_b);
+          const Eigen::Map<const Vector> inv_f_i(data + n_i * n_b, n_i);
+          Vector x_b(n_b);
+          for (Eigen::Index k = 0; k < n_b; ++k) {
+            x_b[k] = sol[b_dofs[k]];
+          }
+          const Vector x_i = inv_f_i - inv_a_ib * x_b;
+          for (Eigen::Index k = 0; k < n_i; ++k) {
+            sol[i_dofs[k]] = x_i[k];
+          }
+        }
+      });
+  return sol;
+}
+
+}  // namespace lf::assemble
+
+#endif
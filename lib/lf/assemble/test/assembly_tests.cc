@@ -13,8 +13,11 @@
  */
 
 #include <gtest/gtest.h>
+#include <chrono>
 #include <iostream>
+#include <thread>
 
+#include <lf/mesh/hybrid2d/hybrid2d.h>
 #include <lf/mesh/utils/utils.h>
 #include "lf/mesh/test_utils/test_meshes.h"
 
@@ -688,4 +691,279 @@ TEST(lf_assembly, mat_vec_mult_test) {
   std::cout << " s= " << test_vec_lr_mult(*mesh_p, dof_handler) << std::endl;
 }
 
+TEST(lf_assembly, symmetric_assembly) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  lf::assemble::UniformFEDofHandler dof_handler(
+      mesh_p, {{lf::base::RefEl::kPoint(), 1}});
+  const size_type N_dofs = dof_handler.NumDofs();
+  TestAssembler assembler(*mesh_p);
+
+  auto full = AssembleMatrixLocally<COOMatrix<double>>(0, dof_handler,
+                                                       dof_handler, assembler);
+  auto upper = AssembleSymmetricMatrixLocally<COOMatrix<double>>(
+      0, dof_handler, assembler);
+  EXPECT_LT(upper.triplets().size(), full.triplets().size());
+  for (const auto &t : upper.triplets()) {
+    EXPECT_LE(t.row(), t.col());
+  }
+
+  const Eigen::SparseMatrix<double> A_full = full.makeSparse();
+  const Eigen::SparseMatrix<double> A_upper = upper.makeSparse();
+  const Eigen::MatrixXd A_upper_dense = A_upper;
+  const Eigen::MatrixXd A_full_dense = A_full;
+  const Eigen::MatrixXd A_full_upper =
+      A_full_dense.triangularView<Eigen::Upper>();
+  EXPECT_NEAR((A_upper_dense - A_full_upper).norm(), 0.0, 1.0E-10);
+
+  const Eigen::VectorXd x = Eigen::VectorXd::LinSpaced(N_dofs, 0.0, 1.0);
+  const Eigen::VectorXd y = A_upper.selfadjointView<Eigen::Upper>() * x;
+  EXPECT_NEAR((y - A_full * x).norm(), 0.0, 1.0E-10);
+}
+
+TEST(lf_assembly, reserve_triplets) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  lf::assemble::UniformFEDofHandler dof_handler(
+      mesh_p, {{lf::base::RefEl::kPoint(), 1}});
+  const size_type N_dofs = dof_handler.NumDofs();
+  TestAssembler assembler(*mesh_p);
+
+  COOMatrix<double> mat(N_dofs, N_dofs);
+  const std::size_t num_triplets =
+      ReserveTriplets(mat, 0, dof_handler, dof_handler);
+  const std::size_t capacity = mat.capacity();
+  EXPECT_GE(capacity, num_triplets);
+  AssembleMatrixLocally(0, dof_handler, dof_handler, assembler, mat);
+  EXPECT_EQ(mat.triplets().size(), num_triplets);
+  EXPECT_EQ(mat.capacity(), capacity);
+
+  // Only triangles
+  auto is_tria = [](const lf::mesh::Entity &e) {
+    return e.RefEl() == lf::base::RefEl::kTria();
+  };
+  std::size_t num_tria = 0;
+  for (const lf::mesh::Entity *cell : mesh_p->Entities(0)) {
+    num_tria += is_tria(*cell) ? 1 : 0;
+  }
+  EXPECT_EQ(CountAssemblyTriplets(0, dof_handler, dof_handler, is_tria),
+            9 * num_tria);
+
+  const AssemblyMemoryEstimate estimate =
+      EstimateAssemblyMemory<double>(0, dof_handler, dof_handler);
+  EXPECT_EQ(estimate.num_triplets, num_triplets);
+  EXPECT_EQ(estimate.triplet_bytes,
+            num_triplets * sizeof(Eigen::Triplet<double>));
+  EXPECT_GT(estimate.PeakBytes(), estimate.triplet_bytes);
+}
+
+TEST(lf_assembly, assembly_profiler) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  lf::assemble::UniformFEDofHandler dof_handler(
+      mesh_p, {{lf::base::RefEl::kPoint(), 1}});
+  const size_type N_dofs = dof_handler.NumDofs();
+  TestAssembler assembler(*mesh_p);
+  TestVectorAssembler vec_assembler(*mesh_p);
+  const std::size_t num_triplets =
+      CountAssemblyTriplets(0, dof_handler, dof_handler);
+  const size_type num_cells = mesh_p->NumEntities(0);
+
+  AssemblyProfiler &profiler{AssemblyProfiler::Get()};
+  profiler.Reset();
+  profiler.Enable();
+  COOMatrix<double> mat(N_dofs, N_dofs);
+  AssembleMatrixLocally(0, dof_handler, dof_handler, assembler, mat);
+  Eigen::VectorXd vec = Eigen::VectorXd::Zero(N_dofs);
+  AssembleVectorLocally(0, dof_handler, vec_assembler, vec);
+  const Eigen::SparseMatrix<double> A{mat.makeSparse()};
+  profiler.Enable(false);
+  const std::string json{profiler.ToJson()};
+
+#ifdef LF_ASSEMBLY_PROFILING
+  using P = AssemblyProfiler;
+  EXPECT_EQ(profiler.Value(P::kEntitiesVisited), 2 * num_cells);
+  EXPECT_EQ(profiler.Value(P::kEntitiesActive), 2 * num_cells);
+  EXPECT_EQ(profiler.Value(P::kTripletsAdded), num_triplets);
+  EXPECT_GE(profiler.Value(P::kTripletReallocations), 1);
+  EXPECT_EQ(profiler.Calls(P::kEval), 2 * num_cells);
+  EXPECT_EQ(profiler.Calls(P::kDofLookup), 3 * num_cells);
+  EXPECT_EQ(profiler.Calls(P::kMakeSparse), 1);
+  EXPECT_GT(profiler.Seconds(P::kEval), 0.0);
+  EXPECT_NE(json.find("\"triplets_added\": " + std::to_string(num_triplets)),
+            std::string::npos)
+      << json;
+#endif
+  EXPECT_EQ(json.front(), '{');
+  EXPECT_EQ(json.back(), '}');
+  EXPECT_NE(json.find("\"phases\": {\"eval\": {\"calls\": "),
+            std::string::npos)
+      << json;
+
+  // Nothing is recorded while the profiler is disabled
+  profiler.Reset();
+  AssembleMatrixLocally(0, dof_handler, dof_handler, assembler, mat);
+  EXPECT_EQ(profiler.Value(AssemblyProfiler::kEntitiesVisited), 0);
+  EXPECT_EQ(profiler.Calls(AssemblyProfiler::kEval), 0);
+
+#ifdef LF_ASSEMBLY_PROFILING
+  // Symmetric assembly only adds the upper triangle
+  profiler.Enable();
+  COOMatrix<double> upper(N_dofs, N_dofs);
+  AssembleSymmetricMatrixLocally(0, dof_handler, assembler, upper);
+  EXPECT_EQ(profiler.Calls(P::kEval), num_cells);
+  EXPECT_EQ(profiler.Value(P::kTripletsAdded), upper.triplets().size());
+
+  // A nested timer pauses the enclosing one
+  profiler.Reset();
+  {
+    LF_ASSEMBLY_TIMER(outer_timer, kAddToEntry);
+    LF_ASSEMBLY_TIMER(inner_timer, kCompress);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+  profiler.Enable(false);
+  EXPECT_GE(profiler.Seconds(P::kCompress), 0.02);
+  EXPECT_LT(profiler.Seconds(P::kAddToEntry), 0.01);
+  EXPECT_EQ(profiler.Calls(P::kAddToEntry), 1);
+#endif
+}
+
+// Largest distance of a global index from the diagonal
+gdof_idx_t Bandwidth(const DofHandler &dofh) {
+  gdof_idx_t bw = 0;
+  for (const lf::mesh::Entity *cell : dofh.Mesh()->Entities(0)) {
+    const nonstd::span<const gdof_idx_t> dofs{dofh.GlobalDofIndices(*cell)};
+    const auto [lo, hi] = std::minmax_element(dofs.begin(), dofs.end());
+    bw = std::max(bw, *hi - *lo);
+  }
+  return bw;
+}
+
+TEST(lf_assembly, dof_renumbering) {
+  lf::mesh::hybrid2d::TPTriagMeshBuilder builder(
+      std::make_unique<lf::mesh::hybrid2d::MeshFactory>(2));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0, 0})
+      .setTopRightCorner(Eigen::Vector2d{1, 1})
+      .setNumXCells(12)
+      .setNumYCells(12);
+  const std::shared_ptr<const lf::mesh::Mesh> tp_mesh_p{builder.Build()};
+  const UniformFEDofHandler::dof_map_t dofmap{{lf::base::RefEl::kPoint(), 1},
+                                              {lf::base::RefEl::kSegment(), 2},
+                                              {lf::base::RefEl::kTria(), 1},
+                                              {lf::base::RefEl::kQuad(), 1}};
+  const std::vector<std::shared_ptr<const lf::mesh::Mesh>> meshes{
+      lf::mesh::test_utils::GenerateHybrid2DTestMesh(), tp_mesh_p};
+  for (const std::shared_ptr<const lf::mesh::Mesh> &mesh_p : meshes) {
+    const UniformFEDofHandler dofh_def(mesh_p, dofmap);
+    const size_type N_dofs = dofh_def.NumDofs();
+    for (const DofRenumbering renumbering :
+         {DofRenumbering::kNone, DofRenumbering::kReverseCuthillMcKee,
+          DofRenumbering::kHilbert, DofRenumbering::kMorton}) {
+      for (const bool cell_interior_last : {false, true}) {
+        const UniformFEDofHandler dofh(mesh_p, dofmap, renumbering,
+                                       cell_interior_last);
+        ASSERT_EQ(dofh.NumDofs(), N_dofs);
+        const std::vector<gdof_idx_t> &perm{dofh.Permutation()};
+        ASSERT_EQ(perm.size(), N_dofs);
+        std::vector<bool> hit(N_dofs, false);
+        for (size_type i = 0; i < N_dofs; ++i) {
+          ASSERT_LT(perm[i], N_dofs);
+          EXPECT_FALSE(hit[perm[i]]) << renumbering;
+          hit[perm[i]] = true;
+          EXPECT_EQ(&dofh.Entity(perm[i]), &dofh_def.Entity(i));
+        }
+        // Local-to-global maps are the default ones relabeled
+        for (dim_t codim = 0; codim <= 2; ++codim) {
+          for (const lf::mesh::Entity *e : mesh_p->Entities(codim)) {
+            const auto dofs{dofh.GlobalDofIndices(*e)};
+            const auto dofs_def{dofh_def.GlobalDofIndices(*e)};
+            ASSERT_EQ(dofs.size(), dofs_def.size());
+            const auto num_dofs = static_cast<size_type>(dofs.size());
+            for (size_type k = 0; k < num_dofs; ++k) {
+              EXPECT_EQ(dofs[k], perm[dofs_def[k]]) << renumbering;
+            }
+          }
+        }
+        if (cell_interior_last) {
+          const size_type num_cell_dofs = mesh_p->NumEntities(0);
+          for (gdof_idx_t dof = 0; dof < N_dofs; ++dof) {
+            EXPECT_EQ(dofh.Entity(dof).Codim() == 0,
+                      dof >= N_dofs - num_cell_dofs);
+          }
+        }
+      }
+    }
+  }
+  // Node and edge d.o.f. are far apart in the default numbering
+  const UniformFEDofHandler dofh_def(tp_mesh_p, dofmap);
+  const UniformFEDofHandler dofh_rcm(tp_mesh_p, dofmap,
+                                     DofRenumbering::kReverseCuthillMcKee);
+  const UniformFEDofHandler dofh_hilbert(tp_mesh_p, dofmap,
+                                         DofRenumbering::kHilbert);
+  EXPECT_LT(4 * Bandwidth(dofh_rcm), Bandwidth(dofh_def));
+  EXPECT_LT(Bandwidth(dofh_hilbert), Bandwidth(dofh_def));
+}
+
+TEST(lf_assembly, dynamic_dof_storage) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  // Uniform layout: both dof handlers must agree
+  const UniformFEDofHandler dofh_uniform(mesh_p,
+                                         {{lf::base::RefEl::kPoint(), 1},
+                                          {lf::base::RefEl::kSegment(), 2},
+                                          {lf::base::RefEl::kTria(), 1},
+                                          {lf::base::RefEl::kQuad(), 4}});
+  const DynamicFEDofHandler dofh_dynamic(
+      mesh_p, [](const lf::mesh::Entity &e) -> size_type {
+        return (e.RefEl() == lf::base::RefEl::kPoint())     ? 1
+               : (e.RefEl() == lf::base::RefEl::kSegment()) ? 2
+               : (e.RefEl() == lf::base::RefEl::kTria())    ? 1
+                                                            : 4;
+      });
+  ASSERT_EQ(dofh_dynamic.NumDofs(), dofh_uniform.NumDofs());
+  for (dim_t codim = 0; codim <= 2; ++codim) {
+    for (const lf::mesh::Entity *e : mesh_p->Entities(codim)) {
+      const auto dofs{dofh_dynamic.GlobalDofIndices(*e)};
+      const auto dofs_uniform{dofh_uniform.GlobalDofIndices(*e)};
+      EXPECT_TRUE(std::equal(dofs.begin(), dofs.end(), dofs_uniform.begin(),
+                             dofs_uniform.end()));
+      const auto int_dofs{dofh_dynamic.InteriorGlobalDofIndices(*e)};
+      const auto int_dofs_uniform{dofh_uniform.InteriorGlobalDofIndices(*e)};
+      EXPECT_TRUE(std::equal(int_dofs.begin(), int_dofs.end(),
+                             int_dofs_uniform.begin(), int_dofs_uniform.end()));
+      EXPECT_EQ(dofh_dynamic.NumLocalDofs(*e), dofh_uniform.NumLocalDofs(*e));
+      EXPECT_EQ(dofh_dynamic.NumInteriorDofs(*e),
+                dofh_uniform.NumInteriorDofs(*e));
+    }
+  }
+
+  // Variable layout: entity-dependent polynomial degrees
+  const DynamicFEDofHandler dofh_p(
+      mesh_p, [&mesh_p](const lf::mesh::Entity &e) -> size_type {
+        return e.Codim() == 2 ? 1 : mesh_p->Index(e) % 3;
+      });
+  size_type num_int_dofs = 0;
+  for (dim_t codim = 0; codim <= 2; ++codim) {
+    for (const lf::mesh::Entity *e : mesh_p->Entities(codim)) {
+      const size_type n_int = dofh_p.NumInteriorDofs(*e);
+      EXPECT_EQ(n_int, e->Codim() == 2 ? 1 : mesh_p->Index(*e) % 3);
+      num_int_dofs += n_int;
+      const auto dofs{dofh_p.GlobalDofIndices(*e)};
+      const auto int_dofs{dofh_p.InteriorGlobalDofIndices(*e)};
+      ASSERT_EQ(dofs.size(), dofh_p.NumLocalDofs(*e));
+      ASSERT_EQ(int_dofs.size(), n_int);
+      // Interior dofs are the trailing part of all dofs
+      EXPECT_EQ(int_dofs.end(), dofs.end());
+      for (const gdof_idx_t dof : int_dofs) {
+        EXPECT_EQ(&dofh_p.Entity(dof), e);
+      }
+      // Covered dofs = interior dofs of the closure of the entity
+      size_type n_covered = n_int;
+      for (dim_t rel_codim = 1; rel_codim <= 2 - e->Codim(); ++rel_codim) {
+        for (const lf::mesh::Entity *sub : e->SubEntities(rel_codim)) {
+          n_covered += dofh_p.NumInteriorDofs(*sub);
+        }
+      }
+      EXPECT_EQ(dofs.size(), n_covered);
+    }
+  }
+  EXPECT_EQ(dofh_p.NumDofs(), num_int_dofs);
+}
+
 }  // namespace lf::assemble::test
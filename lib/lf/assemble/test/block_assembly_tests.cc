@@ -0,0 +1,128 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Unit tests for the assembly of vector-valued problems
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+
+#include <lf/assemble/assemble.h>
+#include <lf/mesh/test_utils/test_meshes.h>
+
+namespace lf::assemble::test {
+
+/** Element matrix depending on the cell index, scaled by a factor */
+class ScaledCellMatrix {
+ public:
+  ScaledCellMatrix(const lf::mesh::Mesh &mesh, double factor)
+      : mesh_(mesh), factor_(factor) {}
+  bool isActive(const lf::mesh::Entity & /*unused*/) { return true; }
+  Eigen::MatrixXd Eval(const lf::mesh::Entity &cell) {
+    const auto n = static_cast<Eigen::Index>(cell.RefEl().NumNodes());
+    const double idx = mesh_.Index(cell);
+    Eigen::MatrixXd mat = Eigen::MatrixXd::Constant(n, n, -factor_);
+    mat.diagonal().setConstant(factor_ * (idx + n));
+    mat(0, n - 1) += idx;
+    return mat;
+  }
+
+ private:
+  const lf::mesh::Mesh &mesh_;
+  double factor_;
+};
+
+TEST(lf_assembly, block_dofhandler) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  UniformFEDofHandler scalar_dofh(mesh_p, {{lf::base::RefEl::kPoint(), 1},
+                                           {lf::base::RefEl::kSegment(), 1}});
+  const size_type N_scalar = scalar_dofh.NumDofs();
+  for (const BlockDofLayout layout :
+       {BlockDofLayout::kInterleaved, BlockDofLayout::kBlocked}) {
+    BlockDofHandler dofh(scalar_dofh, 3, layout);
+    EXPECT_EQ(dofh.NumDofs(), 3 * N_scalar);
+    for (dim_t codim = 0; codim <= 2; ++codim) {
+      for (const lf::mesh::Entity *e : mesh_p->Entities(codim)) {
+        const auto scalar_dofs = scalar_dofh.GlobalDofIndices(*e);
+        const auto dofs = dofh.GlobalDofIndices(*e);
+        ASSERT_EQ(dofs.size(), 3 * scalar_dofs.size());
+        EXPECT_EQ(dofh.InteriorGlobalDofIndices(*e).size(),
+                  3 * scalar_dofh.NumInteriorDofs(*e));
+        const auto num_scalar = static_cast<size_type>(scalar_dofs.size());
+        for (size_type l = 0; l < num_scalar; ++l) {
+          for (size_type c = 0; c < 3; ++c) {
+            const gdof_idx_t dof = dofs[3 * l + c];
+            EXPECT_EQ(dofh.ScalarIndex(dof), scalar_dofs[l]);
+            EXPECT_EQ(dofh.Component(dof), c);
+            EXPECT_EQ(dofh.GlobalIndex(scalar_dofs[l], c), dof);
+            EXPECT_EQ(&dofh.Entity(dof), &scalar_dofh.Entity(scalar_dofs[l]));
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(lf_assembly, block_assembly_bsr) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  UniformFEDofHandler scalar_dofh(mesh_p, {{lf::base::RefEl::kPoint(), 1}});
+  const size_type N_scalar = scalar_dofh.NumDofs();
+  ScaledCellMatrix diag_emp(*mesh_p, 2.0);
+  ScaledCellMatrix coupling_emp(*mesh_p, 0.5);
+
+  // Reference: scalar matrices stitched together with index offsets
+  const Eigen::MatrixXd diag_block =
+      AssembleMatrixLocally<COOMatrix<double>>(0, scalar_dofh, scalar_dofh,
+                                               diag_emp)
+          .makeDense();
+  const Eigen::MatrixXd coupling_block =
+      AssembleMatrixLocally<COOMatrix<double>>(0, scalar_dofh, scalar_dofh,
+                                               coupling_emp)
+          .makeDense();
+  Eigen::MatrixXd A_ref(2 * N_scalar, 2 * N_scalar);
+  A_ref << diag_block, coupling_block, coupling_block, diag_block;
+
+  for (const BlockDofLayout layout :
+       {BlockDofLayout::kInterleaved, BlockDofLayout::kBlocked}) {
+    BlockDofHandler dofh(scalar_dofh, 2, layout);
+    COOMatrix<double> A(dofh.NumDofs(), dofh.NumDofs());
+    for (size_type r = 0; r < 2; ++r) {
+      for (size_type c = 0; c < 2; ++c) {
+        if (r == c) {
+          AssembleComponentBlockLocally(0, dofh, r, c, diag_emp, A);
+        } else {
+          AssembleComponentBlockLocally(0, dofh, r, c, coupling_emp, A);
+        }
+      }
+    }
+    // Permutation from blocked to the layout of dofh
+    Eigen::MatrixXd A_perm(2 * N_scalar, 2 * N_scalar);
+    for (gdof_idx_t i = 0; i < 2 * N_scalar; ++i) {
+      for (gdof_idx_t j = 0; j < 2 * N_scalar; ++j) {
+        A_perm(dofh.GlobalIndex(i % N_scalar, i / N_scalar),
+               dofh.GlobalIndex(j % N_scalar, j / N_scalar)) = A_ref(i, j);
+      }
+    }
+    EXPECT_NEAR((A.makeDense() - A_perm).norm(), 0.0, 1.0E-12);
+
+    if (layout == BlockDofLayout::kInterleaved) {
+      const BSRMatrix<double, 2> A_bsr(A);
+      EXPECT_EQ(A_bsr.rows(), 2 * N_scalar);
+      EXPECT_EQ(4 * A_bsr.NonZeroBlocks(), A.makeSparse().nonZeros());
+      EXPECT_NEAR((Eigen::MatrixXd(A_bsr.makeSparse()) - A_perm).norm(), 0.0,
+                  1.0E-12);
+      const Eigen::VectorXd x =
+          Eigen::VectorXd::LinSpaced(2 * N_scalar, -1.0, 2.0);
+      EXPECT_NEAR((A_bsr.MatVecMult(1.5, x) - 1.5 * A_perm * x).norm(), 0.0,
+                  1.0E-12);
+    }
+  }
+}
+
+}  // namespace lf::assemble::test
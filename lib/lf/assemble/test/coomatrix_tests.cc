@@ -14,6 +14,7 @@
 
 #include <gtest/gtest.h>
 #include <iostream>
+#include <utility>
 
 #include <lf/assemble/fix_dof.h>
 
@@ -236,4 +237,123 @@ TEST(lf_assembly, fix_dof_flags) {
   EXPECT_NEAR((x - exact).norm(), 0.0, 1.0E-12) << "Wrong result!";
 }
 
+/** Compression of a COO matrix with many duplicate triplets */
+TEST(lf_assembly, coomatrix_compress) {
+  // Large enough to exercise the multi-threaded radix sort
+  const size_type n = 700;
+  COOMatrix<double> M(n, n);
+  COOMatrix<double> M_auto(n, n);
+  M_auto.SetCompressionThreshold(10000);
+  for (int rep = 0; rep < 3; ++rep) {
+    for (size_type i = 0; i < n; ++i) {
+      for (size_type j = (i * 7) % 11; j < n; j += 11) {
+        const double val = 1.0 + i - 0.5 * j + rep;
+        M.AddToEntry(i, j, val);
+        M_auto.AddToEntry(i, j, val);
+      }
+    }
+  }
+  const Eigen::MatrixXd ref = M.makeDense();
+  const Eigen::SparseMatrix<double> ref_sparse = M.makeSparse();
+  EXPECT_FALSE(M.IsCompressed());
+  EXPECT_LT(M_auto.triplets().size(), M.triplets().size());
+
+  M.Compress();
+  EXPECT_TRUE(M.IsCompressed());
+  EXPECT_EQ(M.triplets().size(), ref_sparse.nonZeros());
+  for (std::size_t k = 1; k < M.triplets().size(); ++k) {
+    const auto &prev = M.triplets()[k - 1];
+    const auto &trp = M.triplets()[k];
+    EXPECT_TRUE((prev.col() < trp.col()) ||
+                ((prev.col() == trp.col()) && (prev.row() < trp.row())));
+  }
+  // Merely reading the triplets keeps the matrix compressed
+  EXPECT_TRUE(M.IsCompressed());
+  M.Compress();
+  EXPECT_NEAR((M.makeDense() - ref).norm(), 0.0, 1.0E-10);
+  const Eigen::SparseMatrix<double> A = M.makeSparse();
+  EXPECT_EQ(A.nonZeros(), ref_sparse.nonZeros());
+  EXPECT_NEAR((Eigen::MatrixXd(A) - ref).norm(), 0.0, 1.0E-10);
+
+  // Adding after compression and a single-threaded re-compression
+  M.AddToEntry(0, 0, 1.0);
+  M.AddToEntry(n - 1, 3, 2.0);
+  EXPECT_FALSE(M.IsCompressed());
+  Eigen::MatrixXd ref2 = ref;
+  ref2(0, 0) += 1.0;
+  ref2(n - 1, 3) += 2.0;
+  M.Compress(1);
+  EXPECT_TRUE(M.IsCompressed());
+  EXPECT_NEAR((Eigen::MatrixXd(M.makeSparse()) - ref2).norm(), 0.0, 1.0E-10);
+
+  // Selective zeroing keeps the matrix compressed
+  M.setZero([](gdof_idx_t i, gdof_idx_t j) { return i == j; });
+  EXPECT_TRUE(M.IsCompressed());
+  ref2.diagonal().setZero();
+  EXPECT_NEAR((Eigen::MatrixXd(M.makeSparse()) - ref2).norm(), 0.0, 1.0E-10);
+
+  // Reordering the triplets through the mutable accessor is detected
+  std::swap(M.triplets()[0], M.triplets()[1]);
+  EXPECT_FALSE(M.IsCompressed());
+  M.Compress();
+  EXPECT_TRUE(M.IsCompressed());
+  EXPECT_NEAR((Eigen::MatrixXd(M.makeSparse()) - ref2).norm(), 0.0, 1.0E-10);
+
+  M_auto.Compress();
+  EXPECT_EQ(M_auto.triplets().size(), ref_sparse.nonZeros());
+  EXPECT_NEAR((Eigen::MatrixXd(M_auto.makeSparse()) - ref).norm(), 0.0,
+              1.0E-10);
+}
+
+/** Fixing solution components in a CSR matrix for several right-hand sides
+ */
+TEST(lf_assembly, fix_dof_csr) {
+  const int N = 10;
+  COOMatrix<double> A(N, N);
+  Eigen::MatrixXd B(N, 2);
+  for (int k = 0; k < N; k++) {
+    if (k > 0) {
+      A.AddToEntry(k, k - 1, -1.0);
+    }
+    if (k < N - 1) {
+      A.AddToEntry(k, k + 1, -1.0);
+    }
+    A.AddToEntry(k, k, 2);
+    B(k, 0) = k + 1;
+    B(k, 1) = 2.0 * (k + 1);
+  }
+  Eigen::SparseMatrix<double, Eigen::RowMajor> A_csr(A.makeSparse());
+  const Eigen::Index nnz = A_csr.nonZeros();
+
+  const fixed_components_t<double> fixed_solution_components{
+      {2, -1.0}, {4, -2.0}, {8, -3.0}};
+  const FixedDofs<double> fixed_dofs(N, fixed_solution_components);
+  EXPECT_EQ(fixed_dofs.NumFixed(), 3);
+  EXPECT_TRUE(fixed_dofs.IsFixed(4));
+  EXPECT_FALSE(fixed_dofs.IsFixed(5));
+
+  // Reference: COO version applied to the first right-hand side
+  Eigen::VectorXd b_ref = B.col(0);
+  FixFlaggedSolutionComponents<double>(
+      [&fixed_dofs](gdof_idx_t i) -> std::pair<bool, double> {
+        return {fixed_dofs.IsFixed(i), fixed_dofs.Value(i)};
+      },
+      A, b_ref);
+
+  FixFlaggedSolutionComponents(fixed_dofs, A_csr, B, 2);
+  EXPECT_EQ(A_csr.nonZeros(), nnz);
+  EXPECT_NEAR((Eigen::MatrixXd(A_csr) - A.makeDense()).norm(), 0.0, 1.0E-12);
+  EXPECT_NEAR((B.col(0) - b_ref).norm(), 0.0, 1.0E-12);
+
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
+  solver.compute(Eigen::SparseMatrix<double>(A_csr));
+  const Eigen::MatrixXd X = solver.solve(B);
+  Eigen::VectorXd exact(N);
+  exact << 1, 1, -1, 0.5, -2, 7.75, 11.5, 8.25, -3, 3.5;
+  EXPECT_NEAR((X.col(0) - exact).norm(), 0.0, 1.0E-12) << "Wrong result!";
+  for (const auto &[idx, val] : fixed_solution_components) {
+    EXPECT_NEAR(X(idx, 1), val, 1.0E-12);
+  }
+}
+
 }  // namespace lf::assemble::test
@@ -0,0 +1,178 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Unit tests for multithreaded assembly facilities
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <lf/assemble/assemble.h>
+#include <lf/mesh/test_utils/test_meshes.h>
+#include <lf/mesh/utils/utils.h>
+
+namespace lf::assemble::test {
+
+/** Element matrix provider with a non-const Eval() method, whose result
+ * depends on the cell and its shape.
+ */
+class StatefulTestProvider {
+ public:
+  using ElemMat = const Eigen::Matrix<double, 4, 4> &;
+
+  explicit StatefulTestProvider(const lf::mesh::Mesh &mesh) : mesh_(mesh) {}
+  bool isActive(const lf::mesh::Entity &cell) {
+    // Skip every third cell
+    return (mesh_.Index(cell) % 3 != 1);
+  }
+  ElemMat Eval(const lf::mesh::Entity &cell) {
+    const auto idx = static_cast<double>(mesh_.Index(cell));
+    const Eigen::MatrixXd corners{
+        cell.Geometry()->Global(cell.RefEl().NodeCoords())};
+    for (int i = 0; i < 4; ++i) {
+      for (int j = 0; j < 4; ++j) {
+        mat_(i, j) = idx + (i + 1) * corners(0, j % corners.cols()) -
+                     (j + 1) * corners(1, i % corners.cols());
+      }
+    }
+    return mat_;
+  }
+
+ private:
+  Eigen::Matrix<double, 4, 4> mat_;
+  const lf::mesh::Mesh &mesh_;
+};
+
+TEST(lf_assembly, parallel_assembly_matches_serial) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  // One dof per node
+  UniformFEDofHandler dofh(mesh_p, {{lf::base::RefEl::kPoint(), 1}});
+  StatefulTestProvider provider(*mesh_p);
+
+  const auto serial = AssembleMatrixLocally<COOMatrix<double>>(
+      0, dofh, dofh, provider);
+  for (unsigned int num_threads : {1U, 2U, 3U, 4U, 16U}) {
+    const auto parallel = ParallelAssembleMatrixLocally<COOMatrix<double>>(
+        0, dofh, dofh, provider, num_threads);
+    // Triplet sequences must agree exactly
+    ASSERT_EQ(serial.triplets().size(), parallel.triplets().size());
+    for (std::size_t k = 0; k < serial.triplets().size(); ++k) {
+      EXPECT_EQ(serial.triplets()[k].row(), parallel.triplets()[k].row());
+      EXPECT_EQ(serial.triplets()[k].col(), parallel.triplets()[k].col());
+      EXPECT_EQ(serial.triplets()[k].value(), parallel.triplets()[k].value());
+    }
+  }
+}
+
+TEST(lf_assembly, parallel_assembly_accumulates) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  UniformFEDofHandler dofh(mesh_p, {{lf::base::RefEl::kPoint(), 1}});
+  StatefulTestProvider provider(*mesh_p);
+  const size_type N = dofh.NumDofs();
+
+  // Assemble twice into the same matrix: result must be doubled
+  COOMatrix<double> mat(N, N);
+  ParallelAssembleMatrixLocally(0, dofh, dofh, provider, mat, 3);
+  ParallelAssembleMatrixLocally(0, dofh, dofh, provider, mat, 2);
+  const Eigen::MatrixXd ref{
+      AssembleMatrixLocally<COOMatrix<double>>(0, dofh, dofh, provider)
+          .makeDense()};
+  EXPECT_NEAR((mat.makeDense() - 2.0 * ref).norm(), 0.0, 1.0E-10);
+}
+
+TEST(lf_assembly, parallel_for_chunks) {
+  // Every index must be visited exactly once
+  std::vector<int> visits(1000, 0);
+  const unsigned int num_chunks = lf::base::ParallelForChunks(
+      visits.size(), 7,
+      [&visits](unsigned int /*chunk*/, size_type begin, size_type end) {
+        for (size_type k = begin; k < end; ++k) {
+          visits[k]++;
+        }
+      });
+  EXPECT_EQ(num_chunks, 7);
+  for (int v : visits) {
+    EXPECT_EQ(v, 1);
+  }
+  // Exceptions are propagated to the calling thread
+  EXPECT_THROW(lf::base::ParallelForChunks(
+                   10, 4,
+                   [](unsigned int chunk, size_type, size_type) {
+                     if (chunk == 2) {
+                       throw std::runtime_error("chunk failed");
+                     }
+                   }),
+               std::runtime_error);
+}
+
+TEST(lf_assembly, cell_coloring_conflict_free) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  // Dofs on nodes and edges
+  UniformFEDofHandler dofh(mesh_p, {{lf::base::RefEl::kPoint(), 1},
+                                    {lf::base::RefEl::kSegment(), 1}});
+  for (dim_t codim : {0U, 1U}) {
+    const CellColoring coloring(dofh, codim);
+    EXPECT_TRUE(coloring.BuiltFrom(dofh));
+    size_type num_colored = 0;
+    for (size_type c = 0; c < coloring.NumColors(); ++c) {
+      std::vector<int> dof_used(dofh.NumDofs(), 0);
+      for (glb_idx_t idx : coloring.EntitiesOfColor(c)) {
+        EXPECT_EQ(coloring.Color(idx), c);
+        for (gdof_idx_t dof :
+             dofh.GlobalDofIndices(*mesh_p->EntityByIndex(codim, idx))) {
+          EXPECT_EQ(dof_used[dof]++, 0)
+              << "dof " << dof << " shared within color " << c;
+        }
+        num_colored++;
+      }
+    }
+    EXPECT_EQ(num_colored, mesh_p->NumEntities(codim));
+  }
+}
+
+TEST(lf_assembly, colored_assembly_matches_serial) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  UniformFEDofHandler dofh(mesh_p, {{lf::base::RefEl::kPoint(), 1}});
+  StatefulTestProvider provider(*mesh_p);
+  const Eigen::MatrixXd ref{
+      AssembleMatrixLocally<COOMatrix<double>>(0, dofh, dofh, provider)
+          .makeDense()};
+
+  const CellColoring coloring(dofh);
+  Eigen::SparseMatrix<double> mat;
+  InitSparsityPattern(0, dofh, dofh, mat);
+  EXPECT_EQ(mat.norm(), 0.0);
+  // The same coloring and pattern are reused for repeated assembly
+  for (unsigned int num_threads : {1U, 3U}) {
+    for (double *v = mat.valuePtr(); v != mat.valuePtr() + mat.nonZeros();
+         ++v) {
+      *v = 0.0;
+    }
+    ColoredAssembleMatrixLocally(coloring, dofh, dofh, provider, mat,
+                                 num_threads);
+    EXPECT_NEAR((Eigen::MatrixXd(mat) - ref).norm(), 0.0, 1.0E-10);
+  }
+  // Row-major storage
+  Eigen::SparseMatrix<double, Eigen::RowMajor> mat_rm;
+  InitSparsityPattern(0, dofh, dofh, mat_rm);
+  ColoredAssembleMatrixLocally(coloring, dofh, dofh, provider, mat_rm, 2);
+  EXPECT_NEAR((Eigen::MatrixXd(mat_rm) - ref).norm(), 0.0, 1.0E-10);
+  // Lookup never inserts entries
+  const auto nnz = mat_rm.nonZeros();
+  for (gdof_idx_t j = 0; j < dofh.NumDofs(); ++j) {
+    const double *entry = FindSparseEntry(mat_rm, 0, j);
+    if (entry != nullptr) {
+      EXPECT_EQ(*entry, mat_rm.coeff(0, j));
+    }
+  }
+  EXPECT_EQ(mat_rm.nonZeros(), nnz);
+}
+
+}  // namespace lf::assemble::test
@@ -0,0 +1,166 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Unit tests for subdomain-wise assembly with owned and ghost d.o.f.s
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+
+#include <lf/assemble/assemble.h>
+#include <lf/mesh/test_utils/test_meshes.h>
+
+namespace lf::assemble::test {
+
+/** Non-symmetric element matrices and vectors depending on the cell index */
+class CellIndexProvider {
+ public:
+  explicit CellIndexProvider(const DofHandler &dofh) : dofh_(dofh) {}
+  bool isActive(const lf::mesh::Entity & /*unused*/) { return true; }
+  Eigen::MatrixXd Eval(const lf::mesh::Entity &cell) {
+    const auto n = static_cast<Eigen::Index>(dofh_.NumLocalDofs(cell));
+    const double idx = dofh_.Mesh()->Index(cell);
+    Eigen::MatrixXd mat(n, n);
+    for (Eigen::Index i = 0; i < n; ++i) {
+      for (Eigen::Index j = 0; j < n; ++j) {
+        mat(i, j) = (i == j) ? n + idx : 1.0 / (1.0 + i + 2 * j + idx);
+      }
+    }
+    return mat;
+  }
+
+ private:
+  const DofHandler &dofh_;
+};
+
+class CellIndexVectorProvider {
+ public:
+  explicit CellIndexVectorProvider(const DofHandler &dofh) : dofh_(dofh) {}
+  bool isActive(const lf::mesh::Entity & /*unused*/) { return true; }
+  Eigen::VectorXd Eval(const lf::mesh::Entity &cell) {
+    const auto n = static_cast<Eigen::Index>(dofh_.NumLocalDofs(cell));
+    return Eigen::VectorXd::LinSpaced(n, 1.0, 2.0) *
+           (1.0 + dofh_.Mesh()->Index(cell));
+  }
+
+ private:
+  const DofHandler &dofh_;
+};
+
+TEST(lf_assembly, partitioned_dofhandler) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  const UniformFEDofHandler dofh(mesh_p, {{lf::base::RefEl::kPoint(), 1},
+                                          {lf::base::RefEl::kSegment(), 1},
+                                          {lf::base::RefEl::kQuad(), 1}});
+  const size_type N_dofs = dofh.NumDofs();
+  const PartitionedDofHandler pdofh(dofh, PartitionCells(*mesh_p, 3));
+  ASSERT_EQ(pdofh.NumPartitions(), 3);
+  EXPECT_EQ(pdofh.OwnedOffset(3), N_dofs);
+
+  // Ownership and numberings
+  size_type num_cells = 0;
+  std::vector<int> owned_count(N_dofs, 0);
+  for (size_type p = 0; p < 3; ++p) {
+    const SubdomainDofHandler &sub{pdofh.Subdomain(p)};
+    num_cells += sub.Cells().size();
+    EXPECT_GT(sub.Cells().size(), 0);
+    EXPECT_EQ(sub.NumOwnedDofs(),
+              pdofh.OwnedOffset(p + 1) - pdofh.OwnedOffset(p));
+    const nonstd::span<const gdof_idx_t> l2g{sub.LocalToGlobal()};
+    ASSERT_EQ(l2g.size(), sub.NumDofs());
+    for (size_type k = 0; k < sub.NumDofs(); ++k) {
+      const bool owned = k < sub.NumOwnedDofs();
+      EXPECT_EQ(pdofh.Owner(l2g[k]) == p, owned);
+      if (owned) {
+        owned_count[l2g[k]]++;
+        EXPECT_EQ(pdofh.PartitionedIndex(l2g[k]), pdofh.OwnedOffset(p) + k);
+      } else {
+        EXPECT_LT(pdofh.Owner(l2g[k]), p);
+      }
+      EXPECT_EQ(&sub.Entity(k), &dofh.Entity(l2g[k]));
+    }
+    // Local indices of cells are translated global indices
+    for (const glb_idx_t cell_idx : sub.Cells()) {
+      const lf::mesh::Entity &cell{*mesh_p->EntityByIndex(0, cell_idx)};
+      const auto loc{sub.GlobalDofIndices(cell)};
+      const auto glob{dofh.GlobalDofIndices(cell)};
+      ASSERT_EQ(loc.size(), glob.size());
+      const auto num_dofs = static_cast<size_type>(loc.size());
+      for (size_type k = 0; k < num_dofs; ++k) {
+        EXPECT_EQ(l2g[loc[k]], glob[k]);
+      }
+      EXPECT_EQ(sub.NumInteriorDofs(cell), dofh.NumInteriorDofs(cell));
+    }
+    // Entities not covered by the subdomain have no local d.o.f.s
+    size_type num_covered_cells = 0;
+    for (dim_t codim = 0; codim <= 2; ++codim) {
+      for (const lf::mesh::Entity *e : mesh_p->Entities(codim)) {
+        const auto loc{sub.GlobalDofIndices(*e)};
+        if (!loc.empty()) {
+          const auto glob{dofh.GlobalDofIndices(*e)};
+          ASSERT_EQ(loc.size(), glob.size());
+          const auto num_dofs = static_cast<size_type>(loc.size());
+          for (size_type k = 0; k < num_dofs; ++k) {
+            EXPECT_EQ(l2g[loc[k]], glob[k]);
+          }
+          num_covered_cells += (codim == 0) ? 1 : 0;
+        }
+      }
+    }
+    EXPECT_EQ(num_covered_cells, sub.Cells().size());
+  }
+  EXPECT_EQ(num_cells, mesh_p->NumEntities(0));
+  for (const int count : owned_count) {
+    EXPECT_EQ(count, 1);
+  }
+
+  // Subassembled matrix-vector product and right-hand side
+  CellIndexProvider provider(dofh);
+  CellIndexVectorProvider vec_provider(dofh);
+  const Eigen::SparseMatrix<double> A{
+      AssembleMatrixLocally<COOMatrix<double>>(0, dofh, dofh, provider)
+          .makeSparse()};
+  const Eigen::VectorXd phi{
+      AssembleVectorLocally<Eigen::VectorXd>(0, dofh, vec_provider)};
+  const Eigen::VectorXd x = Eigen::VectorXd::LinSpaced(N_dofs, -1.0, 2.0);
+  std::vector<Eigen::VectorXd> x_loc = pdofh.Gather(x);
+  std::vector<Eigen::VectorXd> y_loc(3);
+  std::vector<Eigen::VectorXd> phi_loc(3);
+  for (size_type p = 0; p < 3; ++p) {
+    const SubdomainDofHandler &sub{pdofh.Subdomain(p)};
+    COOMatrix<double> A_p(sub.NumDofs(), sub.NumDofs());
+    AssembleSubdomainMatrixLocally(sub, provider, A_p);
+    // Also the generic assembly function skips cells of other subdomains
+    const COOMatrix<double> A_p_generic{
+        AssembleMatrixLocally<COOMatrix<double>>(0, sub, sub, provider)};
+    EXPECT_EQ(A_p.triplets().size(), A_p_generic.triplets().size());
+    y_loc[p] = A_p.makeSparse() * x_loc[p];
+    phi_loc[p] = Eigen::VectorXd::Zero(sub.NumDofs());
+    AssembleSubdomainVectorLocally(sub, vec_provider, phi_loc[p]);
+  }
+  pdofh.AccumulateGhosts(y_loc, 2);
+  pdofh.AccumulateGhosts(phi_loc);
+  EXPECT_NEAR((pdofh.Scatter(y_loc) - A * x).norm(), 0.0, 1.0E-10);
+  EXPECT_NEAR((pdofh.Scatter(phi_loc) - phi).norm(), 0.0, 1.0E-10);
+  for (size_type p = 0; p < 3; ++p) {
+    EXPECT_EQ(y_loc[p].tail(pdofh.Subdomain(p).NumGhostDofs()).norm(), 0.0);
+  }
+
+  // Halo exchange restores the ghost values
+  for (size_type p = 0; p < 3; ++p) {
+    x_loc[p].tail(pdofh.Subdomain(p).NumGhostDofs()).setZero();
+  }
+  pdofh.UpdateGhosts(x_loc, 2);
+  const std::vector<Eigen::VectorXd> x_ref = pdofh.Gather(x);
+  for (size_type p = 0; p < 3; ++p) {
+    EXPECT_EQ(x_loc[p], x_ref[p]);
+  }
+}
+
+}  // namespace lf::assemble::test
@@ -0,0 +1,151 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Tests for symbolic/numeric split of assembly
+ * @date October 2026
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+
+#include <lf/assemble/assemble.h>
+#include <lf/mesh/test_utils/test_meshes.h>
+#include <lf/mesh/utils/utils.h>
+
+namespace lf::assemble::test {
+
+/** Element matrix provider with entries depending on the cell index, which
+ * skips all triangles
+ */
+class QuadOnlyTestProvider {
+ public:
+  explicit QuadOnlyTestProvider(const lf::mesh::Mesh &mesh) : mesh_(mesh) {}
+  bool isActive(const lf::mesh::Entity &cell) {
+    return cell.RefEl() == lf::base::RefEl::kQuad();
+  }
+  Eigen::MatrixXd Eval(const lf::mesh::Entity &cell) {
+    Eigen::MatrixXd mat(8, 8);
+    for (int i = 0; i < 8; ++i) {
+      for (int j = 0; j < 8; ++j) {
+        mat(i, j) = mesh_.Index(cell) + 0.1 * i - 0.01 * j;
+      }
+    }
+    return mat;
+  }
+
+ private:
+  const lf::mesh::Mesh &mesh_;
+};
+
+TEST(lf_assembly, sparsity_pattern_numeric_assembly) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  // Rectangular matrix: dofs on nodes for test, on nodes and edges for trial
+  UniformFEDofHandler dofh_test(mesh_p, {{lf::base::RefEl::kPoint(), 1}});
+  UniformFEDofHandler dofh_trial(mesh_p, {{lf::base::RefEl::kPoint(), 1},
+                                          {lf::base::RefEl::kSegment(), 1}});
+  QuadOnlyTestProvider provider(*mesh_p);
+  const Eigen::MatrixXd ref{AssembleMatrixLocally<COOMatrix<double>>(
+                                0, dofh_trial, dofh_test, provider)
+                                .makeDense()};
+
+  const SparsityPattern pattern(0, dofh_trial, dofh_test);
+  EXPECT_TRUE(pattern.BuiltFrom(dofh_trial, dofh_test));
+  EXPECT_EQ(pattern.rows(), dofh_test.NumDofs());
+  EXPECT_EQ(pattern.cols(), dofh_trial.NumDofs());
+  for (const lf::mesh::Entity *cell : mesh_p->Entities(0)) {
+    EXPECT_EQ(pattern.ScatterMap(mesh_p->Index(*cell)).size(),
+              dofh_test.NumLocalDofs(*cell) * dofh_trial.NumLocalDofs(*cell));
+  }
+
+  auto mat = pattern.MakeMatrix<double>();
+  EXPECT_TRUE(pattern.Matches(mat));
+  EXPECT_EQ(mat.nonZeros(), pattern.NonZeros());
+  // Repeated numeric assembly into the same matrix
+  for (int step = 0; step < 3; ++step) {
+    mat.coeffs().setZero();
+    AssembleMatrixLocally(pattern, provider, mat);
+    EXPECT_TRUE(pattern.Matches(mat));
+    EXPECT_NEAR((Eigen::MatrixXd(mat) - ref).norm(), 0.0, 1.0E-12);
+  }
+
+  // The pattern coincides with that of the Galerkin matrix obtained
+  // from the triplet based assembly using a provider active everywhere
+  struct AllActive {
+    bool isActive(const lf::mesh::Entity & /*cell*/) { return true; }
+    Eigen::MatrixXd Eval(const lf::mesh::Entity & /*cell*/) {
+      return Eigen::MatrixXd::Ones(8, 8);
+    }
+  } all_active;
+  const Eigen::SparseMatrix<double, Eigen::RowMajor> full{
+      AssembleMatrixLocally<COOMatrix<double>>(0, dofh_trial, dofh_test,
+                                               all_active)
+          .makeSparse()};
+  EXPECT_TRUE(pattern.Matches(full));
+}
+
+/** Element matrix provider scaling a fixed matrix by a per-cell coefficient,
+ * cells with a zero coefficient are inactive */
+class CellCoefficientProvider {
+ public:
+  explicit CellCoefficientProvider(const lf::mesh::Mesh &mesh)
+      : mesh_(mesh), coeff_(mesh.NumEntities(0), 1.0) {}
+  bool isActive(const lf::mesh::Entity &cell) {
+    return coeff_[mesh_.Index(cell)] != 0.0;
+  }
+  Eigen::MatrixXd Eval(const lf::mesh::Entity &cell) {
+    const auto n = static_cast<Eigen::Index>(cell.RefEl().NumNodes());
+    Eigen::MatrixXd mat = Eigen::MatrixXd::Constant(n, n, -1.0);
+    mat.diagonal().setConstant(n - 1.0);
+    mat(0, 1) += 0.5;
+    return coeff_[mesh_.Index(cell)] * mat;
+  }
+  void SetCoefficient(glb_idx_t cell_index, double value) {
+    coeff_[cell_index] = value;
+  }
+
+ private:
+  const lf::mesh::Mesh &mesh_;
+  std::vector<double> coeff_;
+};
+
+TEST(lf_assembly, incremental_assembly) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  UniformFEDofHandler dofh(mesh_p, {{lf::base::RefEl::kPoint(), 1}});
+  CellCoefficientProvider provider(*mesh_p);
+  const SparsityPattern pattern(0, dofh, dofh);
+  IncrementalAssembler<double> inc_assembler(pattern);
+  inc_assembler.Assemble(provider);
+  auto reference = [&]() -> Eigen::MatrixXd {
+    return AssembleMatrixLocally<COOMatrix<double>>(0, dofh, dofh, provider)
+        .makeDense();
+  };
+  EXPECT_NEAR((Eigen::MatrixXd(inc_assembler.Galerkin()) - reference()).norm(),
+              0.0, 1.0E-12);
+
+  // Change coefficients on a few cells, switch one cell off
+  std::vector<glb_idx_t> dirty{1, 4, 7};
+  provider.SetCoefficient(1, 3.0);
+  provider.SetCoefficient(4, 0.0);
+  provider.SetCoefficient(7, -2.0);
+  inc_assembler.Update(provider, nonstd::span<const glb_idx_t>(
+                                     dirty.data(), dirty.size()));
+  EXPECT_NEAR((Eigen::MatrixXd(inc_assembler.Galerkin()) - reference()).norm(),
+              0.0, 1.0E-12);
+
+  // Same with a mesh data set, switch the cell on again
+  lf::mesh::utils::CodimMeshDataSet<bool> dirty_flags(mesh_p, 0, false);
+  provider.SetCoefficient(4, 0.25);
+  provider.SetCoefficient(2, 5.0);
+  dirty_flags(*mesh_p->EntityByIndex(0, 4)) = true;
+  dirty_flags(*mesh_p->EntityByIndex(0, 2)) = true;
+  inc_assembler.Update(provider, dirty_flags);
+  EXPECT_NEAR((Eigen::MatrixXd(inc_assembler.Galerkin()) - reference()).norm(),
+              0.0, 1.0E-12);
+}
+
+}  // namespace lf::assemble::test
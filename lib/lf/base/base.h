@@ -42,6 +42,7 @@ constexpr double kPi = 3.14159265358979323846;
 #include "invalid_type_exception.h"
 #include "lf_assert.h"
 #include "lf_exception.h"
+#include "parallel.h"
 #include "predicate_true.h"
 #include "ref_el.h"
 #include "span.h"
@@ -0,0 +1,113 @@
+/**
+ * @file
+ * @brief Minimal facilities for splitting index ranges over worker threads
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#ifndef __0f0c7c3ffdb14e639803e104bbdb9af5
+#define __0f0c7c3ffdb14e639803e104bbdb9af5
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "base.h"
+
+namespace lf::base {
+
+/**
+ * @brief Number of worker threads to be used when a function is asked to
+ * choose the number of threads itself
+ *
+ * @param requested number of threads requested by the caller; `0` means "use
+ * all hardware threads".
+ * @return a number >= 1
+ */
+inline unsigned int NumWorkerThreads(unsigned int requested = 0) {
+  if (requested > 0) {
+    return requested;
+  }
+  const unsigned int hw = std::thread::hardware_concurrency();
+  return (hw > 0) ? hw : 1;
+}
+
+/**
+ * @brief Boundaries of a partition of `[0,n)` into `num_chunks` contiguous
+ * chunks of (almost) equal length
+ *
+ * @return vector of length `num_chunks+1`, chunk `k` is the index range
+ * `[result[k], result[k+1])`
+ */
+inline std::vector<size_type> ChunkBoundaries(size_type n,
+                                              unsigned int num_chunks) {
+  LF_ASSERT_MSG(num_chunks > 0, "At least one chunk required");
+  std::vector<size_type> bounds(num_chunks + 1);
+  const size_type chunk_len = n / num_chunks;
+  const size_type remainder = n % num_chunks;
+  bounds[0] = 0;
+  for (unsigned int k = 0; k < num_chunks; ++k) {
+    bounds[k + 1] = bounds[k] + chunk_len + ((k < remainder) ? 1 : 0);
+  }
+  return bounds;
+}
+
+/**
+ * @brief Process contiguous chunks of an index range concurrently
+ *
+ * @tparam CHUNK_FUNCTOR type compatible with
+ * `std::function<void(unsigned int, size_type, size_type)>`
+ * @param n length of the index range `[0,n)`
+ * @param num_threads number of worker threads, `0` selects
+ * NumWorkerThreads(). Never more threads than indices are used.
+ * @param chunk_fn functor called as `chunk_fn(chunk_id, begin, end)` exactly
+ * once for each of the chunks returned by ChunkBoundaries().
+ * @return number of chunks the range was split into
+ *
+ * Chunk 0 is processed by the calling thread. The function returns only after
+ * all chunks have been processed. If `chunk_fn` throws an exception in any of
+ * the threads, the exception of the chunk with the smallest id is rethrown in
+ * the calling thread.
+ *
+ * @note `chunk_fn` is invoked concurrently and must therefore not modify
+ * shared state without synchronization.
+ */
+template <typename CHUNK_FUNCTOR>
+unsigned int ParallelForChunks(size_type n, unsigned int num_threads,
+                               CHUNK_FUNCTOR &&chunk_fn) {
+  unsigned int num_chunks = NumWorkerThreads(num_threads);
+  num_chunks = std::max(1U, std::min<unsigned int>(num_chunks, n));
+  const std::vector<size_type> bounds = ChunkBoundaries(n, num_chunks);
+  if (num_chunks == 1) {
+    chunk_fn(0U, bounds[0], bounds[1]);
+    return 1;
+  }
+  std::vector<std::exception_ptr> errors(num_chunks);
+  auto guarded = [&chunk_fn, &bounds, &errors](unsigned int k) {
+    try {
+      chunk_fn(k, bounds[k], bounds[k + 1]);
+    } catch (...) {
+      errors[k] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> workers;
+  workers.reserve(num_chunks - 1);
+  for (unsigned int k = 1; k < num_chunks; ++k) {
+    workers.emplace_back(guarded, k);
+  }
+  guarded(0);
+  for (std::thread &w : workers) {
+    w.join();
+  }
+  for (const std::exception_ptr &e : errors) {
+    if (e) {
+      std::rethrow_exception(e);
+    }
+  }
+  return num_chunks;
+}
+
+}  // namespace lf::base
+
+#endif  // __0f0c7c3ffdb14e639803e104bbdb9af5
@@ -63,6 +63,9 @@ class QuadO2 : public Geometry {
   [[nodiscard]] std::vector<std::unique_ptr<Geometry>> ChildGeometry(
       const RefinementPattern &ref_pat, lf::base::dim_t codim) const override;
 
+  /** @copydoc Geometry::isAffine() */
+  [[nodiscard]] bool isAffine() const override { return false; }
+
  private:
   /**
    * @brief Coordinates of the 8 vertices/midpoints, stored in matrix columns
@@ -52,6 +52,9 @@ class SegmentO2 : public Geometry {
   [[nodiscard]] std::vector<std::unique_ptr<Geometry>> ChildGeometry(
       const RefinementPattern& ref_pat, base::dim_t codim) const override;
 
+  /** @copydoc Geometry::isAffine() */
+  [[nodiscard]] bool isAffine() const override { return false; }
+
  private:
   /**
    * @brief Coordinates of the 3 vertices/midpoints, stored in matrix columns
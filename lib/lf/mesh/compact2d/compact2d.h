@@ -0,0 +1,24 @@
+/**
+ * @file
+ * @brief Master include file for the module lf::mesh::compact2d
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#ifndef __f1b6c2d8a4e94e07b3c5d9a2e7f4b816
+#define __f1b6c2d8a4e94e07b3c5d9a2e7f4b816
+
+/**
+ * @brief A 2D hybrid mesh manager that stores the mesh in flat index arrays
+ * and creates entity geometries on demand.
+ *
+ * It is a drop-in replacement for lf::mesh::hybrid2d with a much smaller
+ * memory footprint, see lf::mesh::compact2d::Mesh.
+ */
+namespace lf::mesh::compact2d {}
+
+#include "entity.h"
+#include "mesh.h"
+#include "mesh_factory.h"
+
+#endif  // __f1b6c2d8a4e94e07b3c5d9a2e7f4b816
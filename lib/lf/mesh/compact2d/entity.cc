@@ -0,0 +1,196 @@
+/**
+ * @file
+ * @brief Implementation of entity handles and on-demand geometries
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#include "entity.h"
+
+#include <cmath>
+
+#include "mesh.h"
+
+namespace lf::mesh::compact2d {
+
+dim_t EntityGeometry::DimGlobal() const { return mesh_->DimWorld(); }
+
+template <typename FUNCTOR>
+auto EntityGeometry::Visit(FUNCTOR&& f) const {
+  LF_ASSERT_MSG(kind_ != GeometryKind::kExplicit,
+                "No on-demand geometry for entity " << index_);
+  const Eigen::MatrixXd& coords{mesh_->coords_};
+  const Eigen::Index dim_world = coords.rows();
+  if (kind_ == GeometryKind::kPoint) {
+    return f(geometry::Point(coords.col(index_)));
+  }
+  if (kind_ == GeometryKind::kSegmentO1) {
+    const nonstd::span<const size_type> nodes{mesh_->EdgeNodes(index_)};
+    Eigen::Matrix<double, Eigen::Dynamic, 2> vertices(dim_world, 2);
+    vertices << coords.col(nodes[0]), coords.col(nodes[1]);
+    return f(geometry::SegmentO1(std::move(vertices)));
+  }
+  const nonstd::span<const size_type> nodes{mesh_->CellNodes(index_)};
+  if (kind_ == GeometryKind::kTriaO1) {
+    Eigen::Matrix<double, Eigen::Dynamic, 3> vertices(dim_world, 3);
+    vertices << coords.col(nodes[0]), coords.col(nodes[1]),
+        coords.col(nodes[2]);
+    return f(geometry::TriaO1(std::move(vertices)));
+  }
+  Eigen::Matrix<double, Eigen::Dynamic, 4> vertices(dim_world, 4);
+  vertices << coords.col(nodes[0]), coords.col(nodes[1]), coords.col(nodes[2]),
+      coords.col(nodes[3]);
+  if (kind_ == GeometryKind::kParallelogram) {
+    return f(geometry::Parallelogram(std::move(vertices)));
+  }
+  return f(geometry::QuadO1(std::move(vertices)));
+}
+
+void EntityGeometry::AffineMap(Eigen::Vector2d& origin,
+                               AffineJacobian& jacobian) const {
+  LF_ASSERT_MSG(
+      kind_ != GeometryKind::kExplicit && kind_ != GeometryKind::kQuadO1,
+      "No affine map for entity " << index_);
+  const Eigen::MatrixXd& coords{mesh_->coords_};
+  if (kind_ == GeometryKind::kPoint) {
+    origin = coords.col(index_);
+    jacobian.resize(2, 0);
+    return;
+  }
+  if (kind_ == GeometryKind::kSegmentO1) {
+    const nonstd::span<const size_type> nodes{mesh_->EdgeNodes(index_)};
+    origin = coords.col(nodes[0]);
+    jacobian.resize(2, 1);
+    jacobian.col(0) = coords.col(nodes[1]) - origin;
+    return;
+  }
+  // Same parametrizations as geometry::TriaO1 and geometry::Parallelogram
+  const nonstd::span<const size_type> nodes{mesh_->CellNodes(index_)};
+  origin = coords.col(nodes[0]);
+  jacobian.resize(2, 2);
+  jacobian.col(0) = coords.col(nodes[1]) - origin;
+  jacobian.col(1) =
+      coords.col(nodes[(kind_ == GeometryKind::kTriaO1) ? 2 : 3]) - origin;
+}
+
+Eigen::MatrixXd EntityGeometry::Global(const Eigen::MatrixXd& local) const {
+  if (!isAffine()) {
+    return Visit(
+        [&local](const geometry::Geometry& geo) { return geo.Global(local); });
+  }
+  Eigen::Vector2d origin;
+  AffineJacobian jacobian;
+  AffineMap(origin, jacobian);
+  return (jacobian * local).colwise() + origin;
+}
+
+Eigen::MatrixXd EntityGeometry::Jacobian(const Eigen::MatrixXd& local) const {
+  if (!isAffine()) {
+    return Visit([&local](const geometry::Geometry& geo) {
+      return geo.Jacobian(local);
+    });
+  }
+  Eigen::Vector2d origin;
+  AffineJacobian jacobian;
+  AffineMap(origin, jacobian);
+  return jacobian.replicate(1, local.cols());
+}
+
+Eigen::MatrixXd EntityGeometry::JacobianInverseGramian(
+    const Eigen::MatrixXd& local) const {
+  if (!isAffine()) {
+    return Visit([&local](const geometry::Geometry& geo) {
+      return geo.JacobianInverseGramian(local);
+    });
+  }
+  LF_VERIFY_MSG(kind_ != GeometryKind::kPoint,
+                "JacobianInverseGramian undefined for points.");
+  Eigen::Vector2d origin;
+  AffineJacobian jacobian;
+  AffineMap(origin, jacobian);
+  if (kind_ == GeometryKind::kSegmentO1) {
+    return (jacobian / jacobian.squaredNorm()).replicate(1, local.cols());
+  }
+  const Eigen::Matrix2d jac{jacobian};
+  return jac.transpose().inverse().replicate(1, local.cols());
+}
+
+Eigen::VectorXd EntityGeometry::IntegrationElement(
+    const Eigen::MatrixXd& local) const {
+  if (!isAffine()) {
+    return Visit([&local](const geometry::Geometry& geo) {
+      return geo.IntegrationElement(local);
+    });
+  }
+  Eigen::Vector2d origin;
+  AffineJacobian jacobian;
+  AffineMap(origin, jacobian);
+  double integration_element = 1.0;
+  if (kind_ == GeometryKind::kSegmentO1) {
+    integration_element = jacobian.norm();
+  } else if (kind_ != GeometryKind::kPoint) {
+    integration_element = std::abs(Eigen::Matrix2d(jacobian).determinant());
+  }
+  return Eigen::VectorXd::Constant(local.cols(), integration_element);
+}
+
+std::unique_ptr<geometry::Geometry> EntityGeometry::SubGeometry(
+    dim_t codim, dim_t i) const {
+  return Visit([codim, i](const geometry::Geometry& geo) {
+    return geo.SubGeometry(codim, i);
+  });
+}
+
+std::vector<std::unique_ptr<geometry::Geometry>> EntityGeometry::ChildGeometry(
+    const geometry::RefinementPattern& ref_pat, lf::base::dim_t codim) const {
+  return Visit([&ref_pat, codim](const geometry::Geometry& geo) {
+    return geo.ChildGeometry(ref_pat, codim);
+  });
+}
+
+nonstd::span<const mesh::Entity* const> EntityHandle::SubEntities(
+    unsigned rel_codim) const {
+  const Mesh& mesh{*geometry_.mesh()};
+  const glb_idx_t idx = geometry_.index();
+  const unsigned codim = Codim();
+  if (rel_codim == 0) {
+    return {&mesh.entity_pointers_[codim][idx], 1};
+  }
+  if (codim == 0 && rel_codim == 1) {
+    return {&mesh.cell_edge_ptrs_[4 * idx], mesh.NumCellNodes(idx)};
+  }
+  if (codim == 0 && rel_codim == 2) {
+    return {&mesh.cell_node_ptrs_[4 * idx], mesh.NumCellNodes(idx)};
+  }
+  if (codim == 1 && rel_codim == 1) {
+    return {&mesh.edge_node_ptrs_[2 * idx], 2};
+  }
+  LF_VERIFY_MSG(false, RefEl() << ": rel_codim " << rel_codim
+                               << " out of range");
+  return {};
+}
+
+nonstd::span<const lf::mesh::Orientation> EntityHandle::RelativeOrientations()
+    const {
+  // Same convention as for hybrid2d::Segment
+  static constexpr std::array<lf::mesh::Orientation, 2> endpoint_ori{
+      lf::mesh::Orientation::negative, lf::mesh::Orientation::positive};
+  switch (Codim()) {
+    case 0:
+      return geometry_.mesh()->CellEdgeOrientations(geometry_.index());
+    case 1:
+      return endpoint_ori;
+    default:
+      LF_ASSERT_MSG(false, "A point has not sub-entities");
+      return {};
+  }
+}
+
+geometry::Geometry* EntityHandle::Geometry() const {
+  if (geometry_.kind() == GeometryKind::kExplicit) {
+    return geometry_.mesh()->ExplicitGeometry(Codim(), geometry_.index());
+  }
+  return &geometry_;
+}
+
+}  // namespace lf::mesh::compact2d
@@ -0,0 +1,188 @@
+/**
+ * @file
+ * @brief Lightweight entity handles and on-demand geometries for
+ * lf::mesh::compact2d::Mesh
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#ifndef __2b7f4d0c9e1a4c35b8e6f3a1d5c7e924
+#define __2b7f4d0c9e1a4c35b8e6f3a1d5c7e924
+
+#include <lf/mesh/mesh.h>
+
+#include <cstdint>
+
+namespace lf::mesh::compact2d {
+
+using size_type = lf::base::size_type;
+using dim_t = lf::base::dim_t;
+using glb_idx_t = lf::base::glb_idx_t;
+const unsigned int idx_nil = lf::base::kIdxNil;
+
+class Mesh;
+
+/**
+ * @brief Type of the shape of an entity of a compact2d::Mesh
+ *
+ * All kinds but `kExplicit` are fixed by the coordinates of the vertices of
+ * the entity. Only for `kExplicit` a geometry object is stored in the mesh.
+ */
+enum class GeometryKind : std::uint8_t {
+  kPoint,          /**< lf::geometry::Point */
+  kSegmentO1,      /**< lf::geometry::SegmentO1 */
+  kTriaO1,         /**< lf::geometry::TriaO1 */
+  kQuadO1,         /**< lf::geometry::QuadO1 */
+  kParallelogram,  /**< lf::geometry::Parallelogram */
+  kExplicit        /**< geometry object stored in the mesh */
+};
+
+/**
+ * @brief Shape of an entity of a compact2d::Mesh computed on demand from the
+ * vertex coordinates stored in the mesh
+ *
+ * For affine shapes, that is, all kinds but `kQuadO1`, the mapping and its
+ * derivatives are evaluated directly from the vertex coordinates. For the
+ * other methods and bilinear quadrilaterals a temporary first-order geometry
+ * object of the type given by the GeometryKind is created from the vertex
+ * coordinates. Hence the shape of an entity does not occupy any memory of
+ * its own and the object is safe to use from several threads.
+ *
+ * @note Also holds index and reference element of the entity, so that an
+ * EntityHandle consists of little more than this object.
+ */
+class EntityGeometry : public geometry::Geometry {
+ public:
+  /** @name Default constructors and assignment
+   * @{ */
+  EntityGeometry() = default;
+  EntityGeometry(const EntityGeometry&) = default;
+  EntityGeometry(EntityGeometry&&) noexcept = default;
+  EntityGeometry& operator=(const EntityGeometry&) = default;
+  EntityGeometry& operator=(EntityGeometry&&) noexcept = default;
+  /** @} */
+
+  /**
+   * @brief Geometry of an entity of a mesh
+   * @param mesh mesh storing the vertex coordinates
+   * @param index index of the entity in the mesh
+   * @param ref_el type of the entity
+   * @param kind type of the shape, must not be `kExplicit`
+   */
+  EntityGeometry(const Mesh* mesh, glb_idx_t index, base::RefEl ref_el,
+                 GeometryKind kind)
+      : mesh_(mesh), index_(index), ref_el_(ref_el), kind_(kind) {}
+
+  /** @name Methods of the lf::geometry::Geometry interface
+   * @sa geometry::Geometry
+   * @{ */
+  [[nodiscard]] dim_t DimLocal() const override { return ref_el_.Dimension(); }
+  [[nodiscard]] dim_t DimGlobal() const override;
+  [[nodiscard]] base::RefEl RefEl() const override { return ref_el_; }
+  [[nodiscard]] Eigen::MatrixXd Global(
+      const Eigen::MatrixXd& local) const override;
+  [[nodiscard]] Eigen::MatrixXd Jacobian(
+      const Eigen::MatrixXd& local) const override;
+  [[nodiscard]] Eigen::MatrixXd JacobianInverseGramian(
+      const Eigen::MatrixXd& local) const override;
+  [[nodiscard]] Eigen::VectorXd IntegrationElement(
+      const Eigen::MatrixXd& local) const override;
+  [[nodiscard]] std::unique_ptr<geometry::Geometry> SubGeometry(
+      dim_t codim, dim_t i) const override;
+  [[nodiscard]] std::vector<std::unique_ptr<geometry::Geometry>> ChildGeometry(
+      const geometry::RefinementPattern& ref_pat,
+      lf::base::dim_t codim) const override;
+  [[nodiscard]] bool isAffine() const override {
+    return kind_ != GeometryKind::kQuadO1;
+  }
+  /** @} */
+
+  /** @brief mesh the entity belongs to */
+  [[nodiscard]] const Mesh* mesh() const { return mesh_; }
+  /** @brief index of the entity */
+  [[nodiscard]] glb_idx_t index() const { return index_; }
+  /** @brief type of the shape of the entity */
+  [[nodiscard]] GeometryKind kind() const { return kind_; }
+
+  ~EntityGeometry() override = default;
+
+ private:
+  // Creates the first-order geometry and passes it to the functor
+  template <typename FUNCTOR>
+  auto Visit(FUNCTOR&& f) const;
+
+  // Constant Jacobian of an affine shape, 2 x DimLocal(), no heap memory
+  using AffineJacobian =
+      Eigen::Matrix<double, 2, Eigen::Dynamic, Eigen::ColMajor, 2, 2>;
+  // Image of the origin of the reference element and constant Jacobian of
+  // an affine shape
+  void AffineMap(Eigen::Vector2d& origin, AffineJacobian& jacobian) const;
+
+  const Mesh* mesh_ = nullptr;
+  glb_idx_t index_ = idx_nil;
+  base::RefEl ref_el_ = base::RefEl::kPoint();
+  GeometryKind kind_ = GeometryKind::kPoint;
+};
+
+/**
+ * @brief Entity of a compact2d::Mesh of any co-dimension
+ *
+ * An entity handle only knows its mesh, its index and its type. Sub-entities,
+ * relative orientations and vertex coordinates are looked up in the arrays
+ * of the mesh.
+ */
+class EntityHandle : public mesh::Entity {
+ public:
+  /** @name Default constructors and assignment, needed by std::vector
+   * @{ */
+  EntityHandle() = default;
+  EntityHandle(const EntityHandle&) = default;
+  EntityHandle(EntityHandle&&) noexcept = default;
+  EntityHandle& operator=(const EntityHandle&) = default;
+  EntityHandle& operator=(EntityHandle&&) noexcept = default;
+  /** @} */
+
+  /**
+   * @brief constructor, is called from the constructor of compact2d::Mesh
+   * @param mesh mesh the entity belongs to
+   * @param index index of the entity
+   * @param ref_el type of the entity
+   * @param kind type of the shape of the entity
+   */
+  EntityHandle(const Mesh* mesh, glb_idx_t index, base::RefEl ref_el,
+               GeometryKind kind)
+      : geometry_(mesh, index, ref_el, kind) {}
+
+  /** @brief access to index of an entity */
+  [[nodiscard]] glb_idx_t index() const { return geometry_.index(); }
+
+  /** @name Standard methods of an Entity object
+   * @sa mesh::Entity
+   * @{
+   */
+  [[nodiscard]] unsigned Codim() const override {
+    return 2 - geometry_.RefEl().Dimension();
+  }
+  [[nodiscard]] nonstd::span<const Entity* const> SubEntities(
+      unsigned rel_codim) const override;
+  [[nodiscard]] nonstd::span<const lf::mesh::Orientation> RelativeOrientations()
+      const override;
+  [[nodiscard]] geometry::Geometry* Geometry() const override;
+  [[nodiscard]] base::RefEl RefEl() const override {
+    return geometry_.RefEl();
+  }
+  [[nodiscard]] bool operator==(const mesh::Entity& rhs) const override {
+    return this == &rhs;
+  }
+  /** @} */
+
+  ~EntityHandle() override = default;
+
+ private:
+  // Mutable, because the geometry is handed out as a non-const pointer
+  mutable EntityGeometry geometry_;
+};
+
+}  // namespace lf::mesh::compact2d
+
+#endif  // __2b7f4d0c9e1a4c35b8e6f3a1d5c7e924
@@ -0,0 +1,275 @@
+/**
+ * @file
+ * @brief Implementation of the compact2d Mesh class
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#include "mesh.h"
+
+#include <lf/mesh/utils/edge_occurrences.h>
+
+#include <algorithm>
+
+namespace lf::mesh::compact2d {
+
+nonstd::span<const mesh::Entity* const> Mesh::Entities(unsigned codim) const {
+  LF_ASSERT_MSG(codim <= 2, "Illegal codimension " << codim);
+  return entity_pointers_[codim];
+}
+
+size_type Mesh::NumEntities(unsigned codim) const {
+  LF_ASSERT_MSG(codim <= 2, "Illegal codimension " << codim);
+  return entities_[codim].size();
+}
+
+size_type Mesh::NumEntities(lf::base::RefEl ref_el_type) const {
+  switch (ref_el_type) {
+    case lf::base::RefEl::kPoint():
+      return entities_[2].size();
+    case lf::base::RefEl::kSegment():
+      return entities_[1].size();
+    case lf::base::RefEl::kTria():
+      return num_trias_;
+    case lf::base::RefEl::kQuad():
+      return entities_[0].size() - num_trias_;
+    default:
+      LF_ASSERT_MSG(false, "Illegal entity type");
+  }
+  return 0;
+}
+
+size_type Mesh::Index(const mesh::Entity& e) const {
+  return dynamic_cast<const EntityHandle&>(e).index();
+}
+
+const mesh::Entity* Mesh::EntityByIndex(dim_t codim, glb_idx_t index) const {
+  LF_ASSERT_MSG(codim <= 2, "Illegal codimension " << codim);
+  LF_ASSERT_MSG(index < NumEntities(codim),
+                "Index " << index << " > " << NumEntities(codim));
+  return entity_pointers_[codim][index];
+}
+
+bool Mesh::Contains(const mesh::Entity& e) const {
+  const unsigned codim = e.Codim();
+  if (codim > 2) {
+    return false;
+  }
+  const std::vector<EntityHandle>& handles{entities_[codim]};
+  return !handles.empty() && &e >= &handles.front() && &e <= &handles.back();
+}
+
+geometry::Geometry* Mesh::ExplicitGeometry(dim_t codim,
+                                           glb_idx_t index) const {
+  const auto& geometries{explicit_geometries_[codim]};
+  auto it = std::lower_bound(
+      geometries.begin(), geometries.end(), index,
+      [](const auto& entry, glb_idx_t idx) { return entry.first < idx; });
+  LF_ASSERT_MSG(it != geometries.end() && it->first == index,
+                "No geometry stored for entity " << index);
+  return it->second.get();
+}
+
+namespace /*anonymous */ {
+// Does a first-order geometry of the given type span the given vertices? Then
+// it can be recomputed on demand and need not be stored.
+template <typename FIRST_ORDER_GEOMETRY>
+bool IsSpannedBy(const geometry::Geometry& geo,
+                 const Eigen::MatrixXd& vertices) {
+  if (dynamic_cast<const FIRST_ORDER_GEOMETRY*>(&geo) == nullptr) {
+    return false;
+  }
+  const Eigen::MatrixXd corners{geo.Global(geo.RefEl().NodeCoords())};
+  return (corners - vertices).norm() <= 1.0E-12 * (1.0 + vertices.norm());
+}
+}  // namespace
+
+// **********************************************************************
+// The construction follows hybrid2d::Mesh::Mesh() step by step, so that both
+// mesh types number and orient their entities in the same way.
+// **********************************************************************
+Mesh::Mesh(dim_t dim_world, NodeCoordList nodes, EdgeList edges, CellList cells,
+           bool check_completeness)
+    : dim_world_(dim_world) {
+  using utils::EdgeOccurrence;
+  LF_VERIFY_MSG(dim_world == 2, "compact2d::Mesh requires dim_world = 2");
+  const Eigen::MatrixXd zero_point = base::RefEl::kPoint().NodeCoords();
+  const size_type no_of_nodes = nodes.size();
+  const auto no_of_supplied_edges = static_cast<size_type>(edges.size());
+  const size_type no_of_cells = cells.size();
+
+  // ======================================================================
+  // STEP I: Register supplied edges and all edges of cells
+  std::vector<EdgeOccurrence> occurrences;
+  occurrences.reserve(edges.size() + 4 * cells.size());
+  for (size_type edge_index = 0; edge_index < no_of_supplied_edges;
+       ++edge_index) {
+    auto& e(edges[edge_index]);
+    const std::array<size_type, 2>& end_nodes(e.first);
+    LF_ASSERT_MSG(
+        (end_nodes[0] < no_of_nodes) && (end_nodes[1] < no_of_nodes),
+        "Illegal edge node numbers " << end_nodes[0] << ", " << end_nodes[1]);
+    LF_ASSERT_MSG(e.second != nullptr,
+                  "Edge " << edge_index << ": missing geometry!");
+    // Nodes without geometry inherit it from the edge
+    for (int j = 0; j < 2; ++j) {
+      if (nodes[end_nodes[j]] == nullptr) {
+        nodes[end_nodes[j]] = e.second->SubGeometry(1, j);
+      }
+    }
+    occurrences.push_back(
+        {utils::EdgeKey(end_nodes[0], end_nodes[1]), edge_index, idx_nil});
+  }
+  cell_nodes_.resize(4 * no_of_cells);
+  for (size_type cell_index = 0; cell_index < no_of_cells; ++cell_index) {
+    const std::array<size_type, 4>& cell_node_list(cells[cell_index].first);
+    const GeometryPtr& cell_geometry(cells[cell_index].second);
+    // A triangle is marked by an invalid node number in the last position
+    const base::RefEl ref_el = (cell_node_list[3] == idx_nil)
+                                   ? base::RefEl::kTria()
+                                   : base::RefEl::kQuad();
+    if (ref_el == base::RefEl::kTria()) {
+      num_trias_++;
+    }
+    for (unsigned l = 0; l < ref_el.NumNodes(); l++) {
+      LF_VERIFY_MSG(cell_node_list[l] < no_of_nodes,
+                    "Node " << l << " of cell " << cell_index
+                            << ": invalid index " << cell_node_list[l]);
+      // Nodes without geometry inherit it from the cell
+      if (nodes[cell_node_list[l]] == nullptr && cell_geometry != nullptr) {
+        nodes[cell_node_list[l]] = cell_geometry->SubGeometry(2, l);
+      }
+    }
+    std::copy(cell_node_list.begin(), cell_node_list.end(),
+              cell_nodes_.begin() + 4 * cell_index);
+    for (unsigned int j = 0; j < ref_el.NumSubEntities(1); j++) {
+      occurrences.push_back(
+          {utils::EdgeKey(
+               cell_node_list[ref_el.SubSubEntity2SubEntity(1, j, 1, 0)],
+               cell_node_list[ref_el.SubSubEntity2SubEntity(1, j, 1, 1)]),
+           cell_index, j});
+    }
+  }
+
+  // ======================================================================
+  // STEP II: Node coordinates
+  coords_.resize(dim_world, no_of_nodes);
+  for (size_type node_index = 0; node_index < no_of_nodes; ++node_index) {
+    LF_VERIFY_MSG(nodes[node_index] != nullptr,
+                  "Missing geometry for node " << node_index);
+    coords_.col(node_index) = nodes[node_index]->Global(zero_point);
+  }
+  nodes = NodeCoordList{};
+
+  // ======================================================================
+  // STEP III: Edges, numbered and oriented as in hybrid2d::Mesh
+  const std::vector<size_type> edge_begin =
+      utils::GroupEdgeOccurrences(occurrences);
+  const size_type no_of_edges = edge_begin.size() - 1;
+  edge_nodes_.resize(2 * no_of_edges);
+  cell_edges_.assign(4 * no_of_cells, idx_nil);
+  std::vector<GeometryKind> edge_kind(no_of_edges);
+
+  utils::BuildMeshEdges(
+      edges, cells, occurrences, edge_begin, no_of_nodes, check_completeness,
+      [&](utils::MeshEdge& edge) {
+        for (const EdgeOccurrence* adj = edge.adj_begin; adj != edge.adj_end;
+             ++adj) {
+          cell_edges_[4 * adj->owner + adj->local_idx] = edge.index;
+        }
+        edge_nodes_[2 * edge.index] = edge.nodes[0];
+        edge_nodes_[2 * edge.index + 1] = edge.nodes[1];
+        Eigen::MatrixXd vertices(dim_world, 2);
+        vertices << coords_.col(edge.nodes[0]), coords_.col(edge.nodes[1]);
+        if (!edge.geometry ||
+            IsSpannedBy<geometry::SegmentO1>(*edge.geometry, vertices)) {
+          edge_kind[edge.index] = GeometryKind::kSegmentO1;
+        } else {
+          edge_kind[edge.index] = GeometryKind::kExplicit;
+          explicit_geometries_[1].emplace_back(edge.index,
+                                               std::move(edge.geometry));
+        }
+      });
+  std::sort(
+      explicit_geometries_[1].begin(), explicit_geometries_[1].end(),
+      [](const auto& a, const auto& b) { return a.first < b.first; });
+  occurrences = std::vector<EdgeOccurrence>{};
+  edges = EdgeList{};
+
+  // ======================================================================
+  // STEP IV: Cells. Edge j has positive orientation, if its first node agrees
+  // with vertex j of the cell.
+  cell_edge_ori_.assign(4 * no_of_cells, Orientation::positive);
+  std::vector<GeometryKind> cell_kind(no_of_cells);
+  for (size_type cell_index = 0; cell_index < no_of_cells; ++cell_index) {
+    const nonstd::span<const size_type> c_nodes{CellNodes(cell_index)};
+    const auto num_vertices = static_cast<Eigen::Index>(c_nodes.size());
+    Eigen::MatrixXd vertices(dim_world, num_vertices);
+    for (Eigen::Index l = 0; l < num_vertices; ++l) {
+      vertices.col(l) = coords_.col(c_nodes[l]);
+      cell_edge_ori_[4 * cell_index + l] =
+          (edge_nodes_[2 * cell_edges_[4 * cell_index + l]] == c_nodes[l])
+              ? Orientation::positive
+              : Orientation::negative;
+    }
+    GeometryPtr& c_geo_ptr(cells[cell_index].second);
+    if (num_vertices == 3) {
+      cell_kind[cell_index] =
+          (!c_geo_ptr || IsSpannedBy<geometry::TriaO1>(*c_geo_ptr, vertices))
+              ? GeometryKind::kTriaO1
+              : GeometryKind::kExplicit;
+    } else if (!c_geo_ptr ||
+               IsSpannedBy<geometry::QuadO1>(*c_geo_ptr, vertices)) {
+      cell_kind[cell_index] = GeometryKind::kQuadO1;
+    } else if (IsSpannedBy<geometry::Parallelogram>(*c_geo_ptr, vertices)) {
+      cell_kind[cell_index] = GeometryKind::kParallelogram;
+    } else {
+      cell_kind[cell_index] = GeometryKind::kExplicit;
+    }
+    if (cell_kind[cell_index] == GeometryKind::kExplicit) {
+      explicit_geometries_[0].emplace_back(cell_index, std::move(c_geo_ptr));
+    }
+  }
+  cells = CellList{};
+
+  // ======================================================================
+  // STEP V: Entity handles and the pointer arrays handed out through the
+  // Entity interface
+  entities_[2].reserve(no_of_nodes);
+  for (size_type i = 0; i < no_of_nodes; ++i) {
+    entities_[2].emplace_back(this, i, base::RefEl::kPoint(),
+                              GeometryKind::kPoint);
+  }
+  entities_[1].reserve(no_of_edges);
+  for (size_type i = 0; i < no_of_edges; ++i) {
+    entities_[1].emplace_back(this, i, base::RefEl::kSegment(), edge_kind[i]);
+  }
+  entities_[0].reserve(no_of_cells);
+  for (size_type i = 0; i < no_of_cells; ++i) {
+    entities_[0].emplace_back(
+        this, i, (NumCellNodes(i) == 3) ? base::RefEl::kTria()
+                                        : base::RefEl::kQuad(),
+        cell_kind[i]);
+  }
+  for (dim_t codim = 0; codim <= 2; ++codim) {
+    entity_pointers_[codim].reserve(entities_[codim].size());
+    for (const EntityHandle& e : entities_[codim]) {
+      entity_pointers_[codim].push_back(&e);
+    }
+  }
+  auto to_pointers = [this](const std::vector<size_type>& indices,
+                            dim_t codim) {
+    std::vector<const mesh::Entity*> ptrs(indices.size(), nullptr);
+    for (std::size_t k = 0; k < indices.size(); ++k) {
+      if (indices[k] != idx_nil) {
+        ptrs[k] = entity_pointers_[codim][indices[k]];
+      }
+    }
+    return ptrs;
+  };
+  cell_node_ptrs_ = to_pointers(cell_nodes_, 2);
+  cell_edge_ptrs_ = to_pointers(cell_edges_, 1);
+  edge_node_ptrs_ = to_pointers(edge_nodes_, 2);
+}
+
+}  // namespace lf::mesh::compact2d
@@ -0,0 +1,163 @@
+/**
+ * @file
+ * @brief Declares the compact2d Mesh class storing the mesh in flat arrays
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#ifndef __9c3e5a71f0d24b8e86a2c4f7b1e0d653
+#define __9c3e5a71f0d24b8e86a2c4f7b1e0d653
+
+#include <lf/mesh/mesh.h>
+
+#include "entity.h"
+
+namespace lf::mesh::compact2d {
+
+class MeshFactory;
+
+/**
+ * @brief 2D hybrid mesh type compliant with the abstract mesh interface that
+ * stores its data in a structure of arrays
+ *
+ * The mesh keeps
+ * - the coordinates of all nodes in one matrix,
+ * - the node and edge indices of all cells, the relative orientations of the
+ *   edges of all cells and the endpoint indices of all edges in flat index
+ *   arrays,
+ * - one lightweight EntityHandle per entity.
+ *
+ * Straight edges, affine triangles and bilinear quadrilaterals, which make up
+ * most meshes, do not store any shape information. Their
+ * lf::geometry::Geometry objects are computed on demand from the node
+ * coordinates, see EntityGeometry. Only geometry objects that are not
+ * determined by the vertex positions, e.g. those of curved cells, are kept
+ * in the mesh.
+ *
+ * Compared to lf::mesh::hybrid2d::Mesh, which owns one geometry object per
+ * entity, this more than halves the memory consumption and keeps all
+ * entity data contiguous in memory. The index and edge numberings agree with
+ * those of lf::mesh::hybrid2d::Mesh for the same input.
+ *
+ * @note The embedding dimension must be 2.
+ */
+class Mesh : public mesh::Mesh {
+ public:
+  /** @name Entity handles point to the mesh, which must therefore stay put
+   * @{ */
+  Mesh(const Mesh&) = delete;
+  Mesh(Mesh&&) = delete;
+  Mesh& operator=(const Mesh&) = delete;
+  Mesh& operator=(Mesh&&) = delete;
+  /** @} */
+  ~Mesh() override = default;
+
+  [[nodiscard]] unsigned DimMesh() const override { return 2; }
+  [[nodiscard]] unsigned DimWorld() const override { return dim_world_; }
+
+  [[nodiscard]] nonstd::span<const mesh::Entity* const> Entities(
+      unsigned codim) const override;
+  [[nodiscard]] size_type NumEntities(unsigned codim) const override;
+  [[nodiscard]] size_type NumEntities(
+      lf::base::RefEl ref_el_type) const override;
+  [[nodiscard]] size_type Index(const mesh::Entity& e) const override;
+  [[nodiscard]] const mesh::Entity* EntityByIndex(
+      dim_t codim, glb_idx_t index) const override;
+  [[nodiscard]] bool Contains(const mesh::Entity& e) const override;
+
+  /** @name Direct access to the arrays of the mesh
+   * @{ */
+  /** @brief Coordinates of all nodes, column `i` belongs to node `i` */
+  [[nodiscard]] const Eigen::MatrixXd& NodeCoordinates() const {
+    return coords_;
+  }
+  /** @brief Indices of the 3 or 4 vertices of a cell */
+  [[nodiscard]] nonstd::span<const size_type> CellNodes(glb_idx_t cell) const {
+    return {&cell_nodes_[4 * cell], NumCellNodes(cell)};
+  }
+  /** @brief Indices of the 3 or 4 edges of a cell */
+  [[nodiscard]] nonstd::span<const size_type> CellEdges(glb_idx_t cell) const {
+    return {&cell_edges_[4 * cell], NumCellNodes(cell)};
+  }
+  /** @brief Relative orientations of the edges of a cell */
+  [[nodiscard]] nonstd::span<const Orientation> CellEdgeOrientations(
+      glb_idx_t cell) const {
+    return {&cell_edge_ori_[4 * cell], NumCellNodes(cell)};
+  }
+  /** @brief Indices of the two endpoints of an edge */
+  [[nodiscard]] nonstd::span<const size_type> EdgeNodes(glb_idx_t edge) const {
+    return {&edge_nodes_[2 * edge], 2};
+  }
+  /** @} */
+
+ private:
+  [[nodiscard]] size_type NumCellNodes(glb_idx_t cell) const {
+    return (cell_nodes_[4 * cell + 3] == idx_nil) ? 3 : 4;
+  }
+  // Geometry object of an entity with GeometryKind::kExplicit
+  [[nodiscard]] geometry::Geometry* ExplicitGeometry(dim_t codim,
+                                                     glb_idx_t index) const;
+
+  dim_t dim_world_{};
+  size_type num_trias_ = 0;
+  // dim_world x (number of nodes) matrix of node coordinates
+  Eigen::MatrixXd coords_;
+  // Node and edge indices and edge orientations of the cells, 4 entries per
+  // cell, the last one is unused for triangles
+  std::vector<size_type> cell_nodes_;
+  std::vector<size_type> cell_edges_;
+  std::vector<Orientation> cell_edge_ori_;
+  // Node indices of the edges, 2 entries per edge
+  std::vector<size_type> edge_nodes_;
+
+  // One handle per entity, ordered by index
+  std::array<std::vector<EntityHandle>, 3> entities_;
+  // Pointers to the handles: the Entity interface hands out ranges of
+  // pointers to entities and sub-entities. Same layout as the index arrays.
+  std::array<std::vector<const mesh::Entity*>, 3> entity_pointers_;
+  std::vector<const mesh::Entity*> cell_node_ptrs_;
+  std::vector<const mesh::Entity*> cell_edge_ptrs_;
+  std::vector<const mesh::Entity*> edge_node_ptrs_;
+
+  /** @brief Data types for passing information about mesh intities */
+  using GeometryPtr = std::unique_ptr<geometry::Geometry>;
+  using NodeCoordList = std::vector<GeometryPtr>;
+  using EdgeList =
+      std::vector<std::pair<std::array<size_type, 2>, GeometryPtr>>;
+  using CellList =
+      std::vector<std::pair<std::array<size_type, 4>, GeometryPtr>>;
+
+  // Geometries of entities with GeometryKind::kExplicit, sorted by index
+  std::array<std::vector<std::pair<glb_idx_t, GeometryPtr>>, 3>
+      explicit_geometries_;
+
+  /**
+   * @brief Construction of mesh from information gathered in a MeshFactory
+   * @param dim_world Dimension of the ambient space, must be 2.
+   * @param nodes sequential container of node geometries
+   * @param edges sequential container of pairs of
+   *               (i) vectors of indices of the nodes of an edge
+   *               (ii) pointers to the geometry object describing an edge
+   * @param cells sequential container of pairs of
+   *               (i) vectors of indices of the nodes of a cell, the last
+   *               one set to `idx_nil` for triangles
+   *               (ii) pointers to the geometry object for the cell, may be
+   *               `nullptr`
+   * @param check_completeness If set to true, the constructor will check that
+   * every node belongs to an edge and every edge to a cell.
+   *
+   * The handling of missing entities and geometries follows
+   * lf::mesh::hybrid2d::Mesh::Mesh(). A supplied geometry is discarded if it
+   * is a first-order geometry whose vertices agree with the nodes.
+   */
+  Mesh(dim_t dim_world, NodeCoordList nodes, EdgeList edges, CellList cells,
+       bool check_completeness);
+
+  friend class MeshFactory;
+  friend class EntityGeometry;
+  friend class EntityHandle;
+};
+
+}  // namespace lf::mesh::compact2d
+
+#endif  // __9c3e5a71f0d24b8e86a2c4f7b1e0d653
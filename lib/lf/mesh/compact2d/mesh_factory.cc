@@ -0,0 +1,75 @@
+/**
+ * @file
+ * @brief Implementation of the compact2d MeshFactory
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#include "mesh_factory.h"
+
+namespace lf::mesh::compact2d {
+
+MeshFactory::size_type MeshFactory::AddPoint(coord_t coord) {
+  LF_ASSERT_MSG(coord.rows() == dim_world_,
+                "coord has incompatible number of rows.");
+  nodes_.emplace_back(std::make_unique<geometry::Point>(std::move(coord)));
+  return nodes_.size() - 1;
+}
+
+MeshFactory::size_type MeshFactory::AddPoint(
+    std::unique_ptr<geometry::Geometry>&& geometry) {
+  LF_ASSERT_MSG(geometry != nullptr,
+                "No creation of a point without a valid geometry");
+  LF_ASSERT_MSG(geometry->DimGlobal() == dim_world_,
+                "geometry->DimGlobal() != dim_world_");
+  LF_ASSERT_MSG(geometry->RefEl() == lf::base::RefEl::kPoint(),
+                "Geometry object must belong to a point");
+  nodes_.emplace_back(std::move(geometry));
+  return nodes_.size() - 1;
+}
+
+MeshFactory::size_type MeshFactory::AddEntity(
+    base::RefEl ref_el, const nonstd::span<const size_type>& nodes,
+    std::unique_ptr<geometry::Geometry>&& geometry) {
+  LF_ASSERT_MSG(ref_el.Dimension() > 0,
+                "Use AddPoint() to add a node to a mesh.");
+  LF_ASSERT_MSG(ref_el.Dimension() <= 2, "ref_el.Dimension > 2");
+  LF_ASSERT_MSG(nodes.size() == ref_el.NumNodes(),
+                "ref_el.NumNodes() = " << ref_el.NumNodes()
+                                       << ", but argument nodes contained "
+                                       << nodes.size() << " nodes");
+  if (geometry != nullptr) {
+    LF_ASSERT_MSG(geometry->DimGlobal() == dim_world_,
+                  "geometry->DimGlobal() != dim_world_");
+    LF_ASSERT_MSG(geometry->RefEl() == ref_el, "ref_el != geometry->RefEl()");
+  }
+  for ([[maybe_unused]] const size_type n : nodes) {
+    LF_ASSERT_MSG(n < nodes_.size(),
+                  "Node " << n << " for " << ref_el.ToString()
+                          << " must be inserted with AddPoint() first.");
+  }
+
+  if (ref_el == base::RefEl::kSegment()) {
+    edges_.emplace_back(std::array<size_type, 2>{nodes[0], nodes[1]},
+                        std::move(geometry));
+    return edges_.size() - 1;
+  }
+  // A triangle is marked by an invalid node number in the last position
+  std::array<size_type, 4> ns{idx_nil, idx_nil, idx_nil, idx_nil};
+  std::copy(nodes.begin(), nodes.end(), ns.begin());
+  elements_.emplace_back(ns, std::move(geometry));
+  return elements_.size() - 1;
+}
+
+std::shared_ptr<mesh::Mesh> MeshFactory::Build() {
+  std::shared_ptr<mesh::Mesh> mesh_ptr(
+      new compact2d::Mesh(dim_world_, std::move(nodes_), std::move(edges_),
+                          std::move(elements_), check_completeness_));
+  // Clear all information supplied to the MeshFactory object
+  nodes_ = compact2d::Mesh::NodeCoordList{};
+  edges_ = compact2d::Mesh::EdgeList{};
+  elements_ = compact2d::Mesh::CellList{};
+  return mesh_ptr;
+}
+
+}  // namespace lf::mesh::compact2d
@@ -0,0 +1,72 @@
+/**
+ * @file
+ * @brief MeshFactory building a compact2d::Mesh
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#ifndef __d4a81c6e2f0b4973a5e7c3b9f162d08e
+#define __d4a81c6e2f0b4973a5e7c3b9f162d08e
+
+#include <lf/mesh/mesh.h>
+
+#include "mesh.h"
+
+namespace lf::mesh::compact2d {
+
+/**
+ * @brief Implements mesh::MeshFactory interface and can be used to construct
+ *        a compact2d::Mesh.
+ *
+ * Accepts the same input as lf::mesh::hybrid2d::MeshFactory and produces a
+ * mesh with the same numbering of entities. Hence it can replace the hybrid2d
+ * factory, e.g., in lf::io::GmshReader or the structured mesh builders, to
+ * obtain a mesh with a much smaller memory footprint.
+ */
+class MeshFactory : public mesh::MeshFactory {
+ public:
+  MeshFactory(const MeshFactory&) = delete;
+  MeshFactory(MeshFactory&&) = delete;
+  MeshFactory& operator=(const MeshFactory&) = delete;
+  MeshFactory& operator=(MeshFactory&&) = delete;
+
+  /**
+   * @brief Construct a new builder for a compact2d::Mesh
+   * @param dim_world The dimension of the euclidean space in which the
+   *                  mesh is embedded, must be 2.
+   * @param check_completeness If set to true, calling Build() will check that
+   * every node belongs to an edge and every edge to a cell.
+   */
+  explicit MeshFactory(dim_t dim_world, bool check_completeness = true)
+      : dim_world_(dim_world), check_completeness_(check_completeness) {}
+
+  [[nodiscard]] dim_t DimWorld() const override { return dim_world_; }
+
+  [[nodiscard]] dim_t DimMesh() const override { return 2; }
+
+  // NOLINTNEXTLINE(modernize-use-nodiscard)
+  size_type AddPoint(coord_t coord) override;
+
+  // NOLINTNEXTLINE(modernize-use-nodiscard)
+  size_type AddPoint(std::unique_ptr<geometry::Geometry>&& geometry) override;
+
+  // NOLINTNEXTLINE(modernize-use-nodiscard)
+  size_type AddEntity(base::RefEl ref_el,
+                      const nonstd::span<const size_type>& nodes,
+                      std::unique_ptr<geometry::Geometry>&& geometry) override;
+
+  [[nodiscard]] std::shared_ptr<mesh::Mesh> Build() override;
+
+  ~MeshFactory() override = default;
+
+ private:
+  dim_t dim_world_;  // dimension of ambient space
+  compact2d::Mesh::NodeCoordList nodes_;
+  compact2d::Mesh::EdgeList edges_;
+  compact2d::Mesh::CellList elements_;
+  bool check_completeness_;
+};
+
+}  // namespace lf::mesh::compact2d
+
+#endif  // __d4a81c6e2f0b4973a5e7c3b9f162d08e
@@ -0,0 +1,184 @@
+/**
+ * @file
+ * @brief Tests for lf::mesh::compact2d::Mesh against lf::mesh::hybrid2d::Mesh
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <lf/assemble/assemble.h>
+#include <lf/io/io.h>
+#include <lf/io/test_utils/read_mesh.h>
+#include <lf/mesh/compact2d/compact2d.h>
+#include <lf/mesh/hybrid2d/hybrid2d.h>
+#include <lf/mesh/utils/utils.h>
+#include <lf/uscalfe/uscalfe.h>
+#include "lf/mesh/test_utils/check_entity_indexing.h"
+#include "lf/mesh/test_utils/check_mesh_completeness.h"
+
+namespace lf::mesh::compact2d::test {
+
+// Both meshes must have the same entities with the same indices, topology
+// and shape
+void ExpectSameMesh(const lf::mesh::Mesh &mesh, const lf::mesh::Mesh &ref) {
+  ASSERT_EQ(mesh.DimWorld(), ref.DimWorld());
+  for (dim_t codim = 0; codim <= 2; ++codim) {
+    ASSERT_EQ(mesh.NumEntities(codim), ref.NumEntities(codim));
+  }
+  for (const auto &ref_el :
+       {base::RefEl::kPoint(), base::RefEl::kSegment(), base::RefEl::kTria(),
+        base::RefEl::kQuad()}) {
+    EXPECT_EQ(mesh.NumEntities(ref_el), ref.NumEntities(ref_el));
+  }
+  for (dim_t codim = 0; codim <= 2; ++codim) {
+    for (glb_idx_t idx = 0; idx < mesh.NumEntities(codim); ++idx) {
+      const Entity &e{*mesh.EntityByIndex(codim, idx)};
+      const Entity &e_ref{*ref.EntityByIndex(codim, idx)};
+      ASSERT_EQ(e.RefEl(), e_ref.RefEl());
+      EXPECT_EQ(e.Codim(), codim);
+      EXPECT_EQ(mesh.Index(e), idx);
+      EXPECT_TRUE(mesh.Contains(e));
+      EXPECT_FALSE(mesh.Contains(e_ref));
+      for (dim_t rel_codim = 1; rel_codim + codim <= 2; ++rel_codim) {
+        const auto subs{e.SubEntities(rel_codim)};
+        const auto subs_ref{e_ref.SubEntities(rel_codim)};
+        ASSERT_EQ(subs.size(), subs_ref.size());
+        const auto num_subs = static_cast<size_type>(subs.size());
+        for (size_type k = 0; k < num_subs; ++k) {
+          EXPECT_EQ(mesh.Index(*subs[k]), ref.Index(*subs_ref[k]));
+        }
+      }
+      if (codim < 2) {
+        const auto ori{e.RelativeOrientations()};
+        const auto ori_ref{e_ref.RelativeOrientations()};
+        EXPECT_TRUE(std::equal(ori.begin(), ori.end(), ori_ref.begin(),
+                               ori_ref.end()));
+      }
+      // Shapes agree in the vertices and in an interior point
+      const geometry::Geometry &geo{*e.Geometry()};
+      const geometry::Geometry &geo_ref{*e_ref.Geometry()};
+      EXPECT_EQ(geo.RefEl(), geo_ref.RefEl());
+      EXPECT_EQ(geo.DimGlobal(), 2);
+      EXPECT_EQ(geo.isAffine(), geo_ref.isAffine());
+      Eigen::MatrixXd local(e.RefEl().Dimension(), 0);
+      if (codim < 2) {
+        local.resize(e.RefEl().Dimension(), e.RefEl().NumNodes() + 1);
+        local << e.RefEl().NodeCoords(),
+            Eigen::VectorXd::Constant(e.RefEl().Dimension(), 0.3);
+      } else {
+        local.resize(0, 1);
+      }
+      EXPECT_TRUE(geo.Global(local).isApprox(geo_ref.Global(local)));
+      if (codim < 2) {
+        EXPECT_TRUE(geo.Jacobian(local).isApprox(geo_ref.Jacobian(local)));
+        EXPECT_TRUE(geo.JacobianInverseGramian(local).isApprox(
+            geo_ref.JacobianInverseGramian(local)));
+        EXPECT_TRUE(geo.IntegrationElement(local).isApprox(
+            geo_ref.IntegrationElement(local)));
+      }
+    }
+  }
+}
+
+TEST(compact_mesh, tensor_product_meshes) {
+  lf::mesh::hybrid2d::TPTriagMeshBuilder tria_builder(
+      std::make_unique<MeshFactory>(2));
+  tria_builder.setBottomLeftCorner(Eigen::Vector2d(0, 0))
+      .setTopRightCorner(Eigen::Vector2d(2, 1))
+      .setNumXCells(7)
+      .setNumYCells(4);
+  auto mesh_p = tria_builder.Build();
+  lf::mesh::hybrid2d::TPTriagMeshBuilder tria_builder_ref(
+      std::make_unique<lf::mesh::hybrid2d::MeshFactory>(2));
+  tria_builder_ref.setBottomLeftCorner(Eigen::Vector2d(0, 0))
+      .setTopRightCorner(Eigen::Vector2d(2, 1))
+      .setNumXCells(7)
+      .setNumYCells(4);
+  ExpectSameMesh(*mesh_p, *tria_builder_ref.Build());
+  lf::mesh::test_utils::checkEntityIndexing(*mesh_p);
+  EXPECT_TRUE(lf::mesh::test_utils::checkMeshCompleteness(*mesh_p));
+  EXPECT_TRUE(lf::mesh::test_utils::isWatertightMesh(*mesh_p, false).empty());
+
+  lf::mesh::hybrid2d::TPQuadMeshBuilder quad_builder(
+      std::make_unique<MeshFactory>(2));
+  quad_builder.setBottomLeftCorner(Eigen::Vector2d(0, 0))
+      .setTopRightCorner(Eigen::Vector2d(1, 3))
+      .setNumXCells(5)
+      .setNumYCells(6);
+  lf::mesh::hybrid2d::TPQuadMeshBuilder quad_builder_ref(
+      std::make_unique<lf::mesh::hybrid2d::MeshFactory>(2));
+  quad_builder_ref.setBottomLeftCorner(Eigen::Vector2d(0, 0))
+      .setTopRightCorner(Eigen::Vector2d(1, 3))
+      .setNumXCells(5)
+      .setNumYCells(6);
+  ExpectSameMesh(*quad_builder.Build(), *quad_builder_ref.Build());
+}
+
+TEST(compact_mesh, cells_without_geometry) {
+  // Hybrid mesh with one supplied edge and cells without geometry
+  auto fill = [](lf::mesh::MeshFactory &mf) {
+    mf.AddPoint(Eigen::Vector2d(0, 0));
+    mf.AddPoint(Eigen::Vector2d(1, 0));
+    mf.AddPoint(Eigen::Vector2d(2, 0.5));
+    mf.AddPoint(Eigen::Vector2d(0, 1));
+    mf.AddPoint(Eigen::Vector2d(1, 1));
+    mf.AddEntity(base::RefEl::kQuad(), std::array<size_type, 4>{{0, 1, 4, 3}},
+                 nullptr);
+    mf.AddEntity(base::RefEl::kTria(), std::array<size_type, 3>{{4, 1, 2}},
+                 nullptr);
+    mf.AddEntity(base::RefEl::kSegment(), std::array<size_type, 2>{{2, 4}},
+                 std::make_unique<geometry::SegmentO1>(
+                     (Eigen::Matrix2d() << 2, 1, 0.5, 1).finished()));
+  };
+  MeshFactory mf(2);
+  fill(mf);
+  lf::mesh::hybrid2d::MeshFactory mf_ref(2);
+  fill(mf_ref);
+  auto mesh_p = mf.Build();
+  ExpectSameMesh(*mesh_p, *mf_ref.Build());
+  EXPECT_EQ(mesh_p->NumEntities(1), 6);
+  EXPECT_EQ(mesh_p->Index(*mesh_p->EntityByIndex(0, 1)->SubEntities(1)[2]), 0);
+}
+
+TEST(compact_mesh, gmsh_meshes) {
+  // First-order and curved second-order meshes
+  for (const std::string name :
+       {"two_element_hybrid_2d.msh", "lecturedemomesh.msh",
+        "two_element_hybrid_2d_second_order.msh", "circle_second_order.msh",
+        "curved_square_quads_2nd_order.msh"}) {
+    const std::string path = lf::io::test_utils::getMeshPath(name);
+    lf::io::GmshReader reader(std::make_unique<MeshFactory>(2), path);
+    lf::io::GmshReader reader_ref(
+        std::make_unique<lf::mesh::hybrid2d::MeshFactory>(2), path);
+    SCOPED_TRACE(name);
+    EXPECT_GT(reader.mesh()->NumEntities(0), 0);
+    ExpectSameMesh(*reader.mesh(), *reader_ref.mesh());
+  }
+}
+
+TEST(compact_mesh, assembly) {
+  // Galerkin matrices of quadratic Lagrangian finite elements coincide
+  const std::string path =
+      lf::io::test_utils::getMeshPath("two_element_hybrid_2d.msh");
+  lf::io::GmshReader reader(std::make_unique<MeshFactory>(2), path);
+  lf::io::GmshReader reader_ref(
+      std::make_unique<lf::mesh::hybrid2d::MeshFactory>(2), path);
+  auto galerkin_matrix = [](const std::shared_ptr<const lf::mesh::Mesh> &mesh) {
+    auto fe_space =
+        std::make_shared<lf::uscalfe::FeSpaceLagrangeO2<double>>(mesh);
+    auto alpha = lf::mesh::utils::MeshFunctionGlobal(
+        [](Eigen::Vector2d x) -> double { return 1.0 + x[0]; });
+    auto gamma = lf::mesh::utils::MeshFunctionConstant(2.0);
+    lf::uscalfe::ReactionDiffusionElementMatrixProvider elmat_builder(
+        fe_space, alpha, gamma);
+    const lf::assemble::DofHandler &dofh{fe_space->LocGlobMap()};
+    lf::assemble::COOMatrix<double> A(dofh.NumDofs(), dofh.NumDofs());
+    lf::assemble::AssembleMatrixLocally(0, dofh, dofh, elmat_builder, A);
+    return Eigen::MatrixXd(A.makeDense());
+  };
+  const Eigen::MatrixXd A = galerkin_matrix(reader.mesh());
+  const Eigen::MatrixXd A_ref = galerkin_matrix(reader_ref.mesh());
+  EXPECT_NEAR((A - A_ref).norm(), 0.0, 1.0E-12 * A_ref.norm());
+}
+
+}  // namespace lf::mesh::compact2d::test
@@ -7,6 +7,7 @@
  */
 
 #include "mesh.h"
+#include <lf/mesh/utils/edge_occurrences.h>
 #include <iostream>
 #include <numeric>
 
@@ -125,46 +126,6 @@ bool Mesh::Contains(const Entity &e) const {
   }
 }
 
-namespace /*anonymous */ {
-/** @brief Auxliary class for mesh_from_node_incidence */
-class EndpointIndexPair {
- public:
-  using size_type = Mesh::size_type;
-  // Constructor
-  EndpointIndexPair(size_type p0, size_type p1) : p0_(p0), p1_(p1) {
-    LF_ASSERT_MSG(p0 != p1, "No loops allowed");
-    if (p1 > p0) {
-      cmp_p0_ = p0;
-      cmp_p1_ = p1;
-    } else {
-      cmp_p0_ = p1;
-      cmp_p1_ = p0;
-    }
-  }
-  // Access operators
-  [[nodiscard]] size_type first_node() const { return p0_; }
-  [[nodiscard]] size_type second_node() const { return p1_; }
-  // The only comparison operator expected from a Map key
-  // Edges are considered equal even if they have the opposite orientation
-  friend bool operator<(const EndpointIndexPair &e1,
-                        const EndpointIndexPair &e2) {
-    return ((e1.cmp_p0_ == e2.cmp_p0_) ? (e1.cmp_p1_ < e2.cmp_p1_)
-                                       : (e1.cmp_p0_ < e2.cmp_p0_));
-  }
-  // Reorienting an edge
-  void flip() { std::swap(p0_, p1_); }
-  // Checking topological equality (taking into account orientation)
-  friend bool coincide(const EndpointIndexPair &e1,
-                       const EndpointIndexPair &e2) {
-    return ((e1.p0_ == e2.p0_) && (e1.p1_ == e2.p1_));
-  }
-
- private:
-  size_type p0_, p1_;  // indices of endpoints
-  size_type cmp_p0_, cmp_p1_;
-};
-}  // namespace
-
 // **********************************************************************
 // Construction of a 2D hybrid mesh
 //
@@ -177,47 +138,7 @@ class EndpointIndexPair {
 Mesh::Mesh(dim_t dim_world, NodeCoordList nodes, EdgeList edges, CellList cells,
            bool check_completeness)
     : dim_world_(dim_world) {
-  // Auxiliary data type for gathering information about cells adjacent to an
-  // edge
-  struct AdjCellInfo {
-    AdjCellInfo(size_type _cell_idx, size_type _edge_idx)
-        : cell_idx(_cell_idx), edge_idx(_edge_idx) {}
-    size_type cell_idx;  // index of adjacent cell
-    size_type edge_idx;  // local index of edge in adjacent cell
-  };
-  // Information about cells adjacent to an edge
-  using AdjCellsList = std::vector<AdjCellInfo>;
-  // Information about edge in auxiliary array
-  struct EdgeData {
-    EdgeData(GeometryPtr geo_uptr, AdjCellsList _adj_cells_list)
-        : geo_uptr(std::move(geo_uptr)),
-          adj_cells_list(std::move(_adj_cells_list)),
-          edge_global_index(-1),
-          reversed(false) {}
-    EdgeData(GeometryPtr geo_uptr, AdjCellsList _adj_cells_list,
-             glb_idx_t global_index)
-        : geo_uptr(std::move(geo_uptr)),
-          adj_cells_list(std::move(_adj_cells_list)),
-          edge_global_index(global_index),
-          reversed(false) {}
-    EdgeData(const EdgeData &) = delete;
-    EdgeData(EdgeData &&) = default;
-    EdgeData &operator=(const EdgeData &) = delete;
-    EdgeData &operator=(EdgeData &&) = default;
-    ~EdgeData() = default;
-    // temporary storage for unique pointer to edge geometry, if provided
-    GeometryPtr geo_uptr;
-    // Information about neighbors
-    AdjCellsList adj_cells_list;
-    // Index of the edge
-    glb_idx_t edge_global_index;
-    // Flag indicating reversed orientation
-    bool reversed;
-  };
-
-  // Type of associative auxiliary array for edge information
-  using EdgeMap = std::map<EndpointIndexPair, EdgeData>;
-
+  using utils::EdgeOccurrence;
   // For extracting point coordinates
   const Eigen::MatrixXd zero_point = base::RefEl::kPoint().NodeCoords();
 
@@ -228,24 +149,29 @@ Mesh::Mesh(dim_t dim_world, NodeCoordList nodes, EdgeList edges, CellList cells,
     std::cout << "Constructing mesh: " << no_of_nodes << " nodes" << std::endl;
   }
 
-  // ======================================================================
-  // STEP I: Initialize array of edges using pointers to
-  //          entries of the array of nodes
+  // All occurrences of edges, both in the list of supplied edges and as
+  // edges of cells, are gathered in a flat array. Sorting it by the packed
+  // endpoint indices groups the occurrences of every edge.
+  std::vector<EdgeOccurrence> occurrences;
+  occurrences.reserve(edges.size() + 4 * cells.size());
 
-  // Register supplied edges in auxiliary map data structure
+  // ======================================================================
+  // STEP I: Register supplied edges
   if (output_ctrl_ > 0) {
-    std::cout << "Initializing edge map" << std::endl;
+    std::cout << "Registering supplied edges" << std::endl;
   }
-  EdgeMap edge_map;
-  glb_idx_t edge_index = 0;  // position in the array gives index of edge
-
-  for (auto &e : edges) {
-    // Node indices of endpoints: the KEY
-    std::array<size_type, 2> end_nodes(e.first);
-    EndpointIndexPair e_endpoint_idx(end_nodes[0], end_nodes[1]);
+  // position in the array gives index of edge
+  const auto no_of_supplied_edges = static_cast<size_type>(edges.size());
+  for (size_type edge_index = 0; edge_index < no_of_supplied_edges;
+       ++edge_index) {
+    auto &e(edges[edge_index]);
+    // Node indices of endpoints
+    const std::array<size_type, 2> &end_nodes(e.first);
     LF_ASSERT_MSG(
         (end_nodes[0] < no_of_nodes) && (end_nodes[1] < no_of_nodes),
         "Illegal edge node numbers " << end_nodes[0] << ", " << end_nodes[1]);
+    LF_ASSERT_MSG(e.second != nullptr,
+                  "Edge " << edge_index << ": missing geometry!");
     if (output_ctrl_ > 0) {
       std::cout << "Register edge: " << end_nodes[0] << " <-> " << end_nodes[1]
                 << std::endl;
@@ -260,52 +186,17 @@ Mesh::Mesh(dim_t dim_world, NodeCoordList nodes, EdgeList edges, CellList cells,
         nodes[end_nodes[j]] = e.second->SubGeometry(1, j);
       }
     }
-
-    // Store provided geometry information; information on adjacent cells
-    // not yet available.
-    LF_ASSERT_MSG(e.second != nullptr,
-                  "Edge " << edge_index << ": missing geometry!");
-    AdjCellsList empty_cells_list{};
-    EdgeData edge_data(std::move(e.second), empty_cells_list, edge_index);
-    EdgeMap::value_type edge_info =
-        std::make_pair(e_endpoint_idx, std::move(edge_data));
-    std::pair<EdgeMap::iterator, bool> insert_status =
-        edge_map.insert(std::move(edge_info));
-    LF_ASSERT_MSG(insert_status.second,
-                  "Duplicate edge " << end_nodes[0] << " <-> " << end_nodes[1]);
-
-    edge_index++;
+    occurrences.push_back(
+        {utils::EdgeKey(end_nodes[0], end_nodes[1]), edge_index, idx_nil});
   }  // end loop over predefined edges
   // ======================================================================
 
   // ======================================================================
-  // Step II: Building edge map from cell information
+  // Step II: Register the edges of the cells
   //
-  // At this point all predefined edges have been stored in the auxiliary
-  // associative array, though without information about adjacent cells.
-  // The variable edge_index contains the number of edges with externally
-  // supplied geometry. The indexing of all extra edges created below must start
-  // from this offset.
-
-  if (output_ctrl_ > 10) {
-    std::cout << "Edge map after edge registration" << std::endl;
-    for (auto &edge_info : edge_map) {
-      const EndpointIndexPair &eip(edge_info.first);
-      const EdgeData &edat(edge_info.second);
-      std::cout << "Edge " << eip.first_node() << " <-> " << eip.second_node()
-                << ": ";
-      const AdjCellsList &acl(edat.adj_cells_list);
-      const GeometryPtr &gptr(edat.geo_uptr);
-      for (auto &i : acl) {
-        std::cout << "[" << i.cell_idx << "," << i.edge_idx << "] ";
-      }
-      std::cout << std::endl;
-    }
-  }
-
   // Run through cells in order to
-  // (i) build edges missing in the list of predefined edges
-  // (ii) determine cells adjacent to edges
+  // (i) register edges missing in the list of predefined edges
+  // (ii) record cells adjacent to edges
   size_type cell_index = 0;
   size_type no_of_trilaterals = 0;
   size_type no_of_quadrilaterals = 0;
@@ -365,13 +256,6 @@ Mesh::Mesh(dim_t dim_world, NodeCoordList nodes, EdgeList edges, CellList cells,
       }
     }
 
-    //  A variant:
-    //    There may be cells without a specified geometry.
-    //    In case an edge is not equipped with a geometry and not
-    //    adjacent to a cell with a specific geometry, assume a straight
-    //    edge connecting the two endpoints.
-    //
-
     // Visit all edges of the current cell
     for (unsigned int j = 0; j < ref_el.NumSubEntities(1); j++) {
       // Fetch local indices of endpoints of edge j
@@ -379,60 +263,16 @@ Mesh::Mesh(dim_t dim_world, NodeCoordList nodes, EdgeList edges, CellList cells,
           ref_el.SubSubEntity2SubEntity(1, j, 1, 0);
       const size_type p1_local_index =
           ref_el.SubSubEntity2SubEntity(1, j, 1, 1);
-      // Fetch global indices of the endnodes of edge j
-      EndpointIndexPair c_edge_vertex_indices(cell_node_list[p0_local_index],
-                                              cell_node_list[p1_local_index]);
-
       if (output_ctrl_ > 10) {
         std::cout << "e(" << j << ") = local " << p0_local_index << " <-> "
                   << p1_local_index << ", global "
-                  << c_edge_vertex_indices.first_node() << " <-> "
-                  << c_edge_vertex_indices.second_node() << " # ";
+                  << cell_node_list[p0_local_index] << " <-> "
+                  << cell_node_list[p1_local_index] << " # ";
       }
       // Store number of cell and the local index j of the edge
-      AdjCellInfo edge_cell_info(cell_index, j);
-      // Check whether edge exists already
-      auto edge_ptr = edge_map.find(c_edge_vertex_indices);
-      if (edge_ptr == edge_map.end()) {
-        // Inherit geometry of edge from adjacent cell
-        GeometryPtr edge_geo_ptr;
-        if (cell_geometry) {
-          edge_geo_ptr = cell_geometry->SubGeometry(1, j);
-        }
-        // Beginning of list of adjacent elements
-        AdjCellsList single_cell_list{edge_cell_info};
-        EdgeData edge_data(std::move(edge_geo_ptr), single_cell_list);
-        std::pair<EdgeMap::iterator, bool> insert_status = edge_map.insert(
-            std::make_pair(c_edge_vertex_indices, std::move(edge_data)));
-        LF_ASSERT_MSG(insert_status.second, "Duplicate not found earlier!");
-        edge_ptr = insert_status.first;  // pointer to newly inserted edge
-      } else {
-        // Here *edge_ptr is a valid std::pair<EndpointIndexPair,EdgeData>
-
-        // Store information about neighboring cell
-        AdjCellsList &edge_adj_cellslist((edge_ptr->second).adj_cells_list);
-        edge_adj_cellslist.push_back(edge_cell_info);
-        // Check, if the edge possesses geometry information
-        GeometryPtr &edge_supplied_geo_uptr((*edge_ptr).second.geo_uptr);
-        if (edge_supplied_geo_uptr == nullptr) {
-          // Edge does not know its geometry yet. Try to obtain it from the
-          // cell.
-          if (cell_geometry) {
-            edge_supplied_geo_uptr =
-                std::move(cell_geometry->SubGeometry(1, j));
-            // NOTE: the local orientation of the edge of the cell and that
-            // pointed to by edge_ptr can differ. In this case the
-            // endpoints of the edge have to be swapped. To detect orientation
-            // mismatch, compare c_edge_vertex_indices (cell infomation) and
-            // edge_ptr->first (edge information)
-            if (!coincide(c_edge_vertex_indices, edge_ptr->first)) {
-              // Reverse the direction of the edge
-              (edge_ptr->second).reversed = true;
-            }
-          }
-        }
-      }
-      // At this point edge_ptr points to the map entry for the current edge
+      occurrences.push_back({utils::EdgeKey(cell_node_list[p0_local_index],
+                                     cell_node_list[p1_local_index]),
+                             cell_index, j});
     }  // end of loop over edges
     cell_index++;
 
@@ -442,42 +282,19 @@ Mesh::Mesh(dim_t dim_world, NodeCoordList nodes, EdgeList edges, CellList cells,
     }
   }  // end loop over cells
 
-  // DIAGNOSTICS
-  {
-    if (output_ctrl_ > 0) {
-      std::cout << "=============================================" << std::endl;
-    }
-    if (output_ctrl_ > 10) {
-      std::cout << "Edge map after cell scan" << std::endl;
-      size_type edge_cnt = 0;
-      for (auto &edge_info : edge_map) {
-        const EndpointIndexPair &eip(edge_info.first);
-        const EdgeData &edat(edge_info.second);
-        std::cout << "Edge " << edge_cnt << ": " << eip.first_node() << " <-> "
-                  << eip.second_node();
-        if (edat.edge_global_index == -1) {
-          std::cout << " no index : ";
-        } else {
-          std::cout << ": index = " << edat.edge_global_index << ": ";
-        }
-        const AdjCellsList &acl(edat.adj_cells_list);
-        const GeometryPtr &gptr(edat.geo_uptr);
-        for (auto &i : acl) {
-          std::cout << "[" << i.cell_idx << "," << i.edge_idx << "] ";
-        }
-        std::cout << " geo = " << std::endl;
-        if (gptr) {
-          Eigen::MatrixXd edp_c(
-              gptr->Global(base::RefEl::kSegment().NodeCoords()));
-          std::cout << edp_c << std::endl;
-        } else {
-          std::cout << "NO GEOMETRY" << std::endl;
-        }
-        edge_cnt++;
-      }
-      std::cout << "=============================================" << std::endl;
-    }  // end if(output_ctrl > 10)
-  }
+  // ======================================================================
+  // Step III: Group the occurrences of edges
+  //
+  // After sorting, the edges appear in the lexicographic order of their
+  // sorted endpoint indices, which fixes the numbering of the internally
+  // created edges. Occurrences of the same edge are contiguous, starting
+  // with the supplied edge, if any, followed by the adjacent cells in
+  // ascending order.
+  // edge_begin[k] is the position of the first occurrence of edge k
+  const std::vector<size_type> edge_begin =
+      utils::GroupEdgeOccurrences(occurrences);
+  // This is the length to be reserved for the edge vector
+  const size_type no_of_edges = edge_begin.size() - 1;
 
   // ======================================================================
   // NEXT STEP : Set up and fill array of nodes: points_
@@ -502,127 +319,54 @@ Mesh::Mesh(dim_t dim_world, NodeCoordList nodes, EdgeList edges, CellList cells,
     node_index++;
   }
 
-  // Run through the entire associative container for edges
-  // and build edge Entities
-  // This is the length to be reserved for the edge vector
-  size_type no_of_edges = edge_map.size();
-
   // Initialized vector of Edge entities here
   segments_.reserve(no_of_edges);
 
-  // if we check for mesh completeness, initialize a vector that stores for
-  // every node if he has a super entity.
-  std::vector<bool> nodeHasSuperEntity;
-  if (check_completeness) {
-    nodeHasSuperEntity.resize(nodes.size(), false);
-  }
-
-  // Note: the variable edge_index contains the number externally supplied
-  // edges, whose index must agree with their position in the
-  // 'edges' array.
-
-  // Note: iteration variable cannot be declared const, because
-  // moving the geometry pointer changes it!
-  for (EdgeMap::value_type &edge : edge_map) {
-    // Indices of the two endpoints of the current edge
-    // Use this to obtain pointers/references to nodes
-    // from the vector of nodes
-    size_type p0(edge.first.first_node());   // index of first endpoint
-    size_type p1(edge.first.second_node());  // index of second endpoint
-
-    // Swap the indices of the endpoints in case of a geometry mismatch
-    // that requires a reversal of orientation.
-    if (edge.second.reversed) {
-      std::swap(p0, p1);
-    }
-
-    const Point *p0_ptr = &points_[p0];  // pointer to first endpoint
-    const Point *p1_ptr = &points_[p1];  // pointer to second endpoint
-
-    // obtain geometry of the edge
-    GeometryPtr edge_geo_ptr(std::move(edge.second.geo_uptr));
-    if (!edge_geo_ptr) {
-      // If the edge does not have a geometry build a straight edge
-      Eigen::Matrix<double, 2, 2> straight_edge_coords;
-      straight_edge_coords.block<2, 1>(0, 0) =
-          p0_ptr->Geometry()->Global(zero_point);
-      straight_edge_coords.block<2, 1>(0, 1) =
-          p1_ptr->Geometry()->Global(zero_point);
-      edge_geo_ptr =
-          std::make_unique<geometry::SegmentO1>(straight_edge_coords);
-    }
-    // Determine index of current edge. Two cases have to be distinguished:
-    // (i) the edge geometry was specified in the `edges` argument. In this case
-    // the edge index must agree with its possition in that array. This position
-    /// is stored in the 'edge_global_index' field of the EdgeData structure.
-    // (ii) the edge has to be created internally. In this case assign an index
-    // larger than the index of any supplied edge.
-    if (edge.second.edge_global_index == idx_nil) {
-      // Internally created edge needs new index.
-      edge.second.edge_global_index = edge_index;
-      // Increment 'edge_index', which will give the index of the next
-      // internally created edge
-      edge_index++;
-    }
-
-    if (check_completeness) {
-      // record that the nodes of this edge have a super-entity (this edge):
-      nodeHasSuperEntity[p0] = true;
-      nodeHasSuperEntity[p1] = true;
+  const size_type no_of_cells = cells.size();
+  // Auxiliary data structure storing for every cell the positions of its
+  // edges in the edge array
+  std::vector<std::array<size_type, 4>> edge_indices(no_of_cells);
 
-      // make sure that the edge belongs to at least one cell:
-      LF_VERIFY_MSG(!edge.second.adj_cells_list.empty(),
-                    "Mesh is incomplete: Edge with global index "
-                        << edge.second.edge_global_index
-                        << " does not belong to a cell.");
-    }
+  // Numbering, orientation and geometry of the edges, which are stored in
+  // the sorted order
+  utils::BuildMeshEdges(
+      edges, cells, occurrences, edge_begin, no_of_nodes, check_completeness,
+      [&](utils::MeshEdge &edge) {
+        for (const EdgeOccurrence *adj = edge.adj_begin; adj != edge.adj_end;
+             ++adj) {
+          // Set edge index in auxiliary cell matrix
+          edge_indices[adj->owner][adj->local_idx] = edge.position;
+        }
+        const Point *p0_ptr = &points_[edge.nodes[0]];  // first endpoint
+        const Point *p1_ptr = &points_[edge.nodes[1]];  // second endpoint
+        if (!edge.geometry) {
+          // If the edge does not have a geometry build a straight edge
+          Eigen::Matrix<double, 2, 2> straight_edge_coords;
+          straight_edge_coords.block<2, 1>(0, 0) =
+              p0_ptr->Geometry()->Global(zero_point);
+          straight_edge_coords.block<2, 1>(0, 1) =
+              p1_ptr->Geometry()->Global(zero_point);
+          edge.geometry =
+              std::make_unique<geometry::SegmentO1>(straight_edge_coords);
+        }
+        // Diagnostics
+        if (output_ctrl_ > 10) {
+          std::cout << "Registering edge " << edge.index << ": "
+                    << edge.nodes[0] << " <-> " << edge.nodes[1] << ", cells ";
+          for (const EdgeOccurrence *adj = edge.adj_begin;
+               adj != edge.adj_end; ++adj) {
+            std::cout << "[" << adj->owner << "," << adj->local_idx << "] ";
+          }
+          std::cout << std::endl;
+        }
+        // Building edge by adding another element to the edge vector.
+        segments_.emplace_back(edge.index, std::move(edge.geometry), p0_ptr,
+                               p1_ptr);
+      });
 
-    // Diagnostics
-    if (output_ctrl_ > 10) {
-      std::cout << "Registering edge " << edge.second.edge_global_index << ": "
-                << p0 << " <-> " << p1 << std::endl;
-    }
-    // Building edge by adding another element to the edge vector.
-    segments_.emplace_back(edge.second.edge_global_index,
-                           std::move(edge_geo_ptr), p0_ptr, p1_ptr);
-  }  // end loop over all edges
-  LF_ASSERT_MSG(edge_index == no_of_edges, "Edge index mismatch");
-
-  if (check_completeness) {
-    // Check that all nodes have a super entity:
-    for (std::size_t i = 0; i < nodes.size(); ++i) {
-      LF_VERIFY_MSG(nodeHasSuperEntity[i],
-                    "Mesh is incomplete: Node with global index "
-                        << i << " is not part of any edge.");
-    }
-  }
   // ======================================================================
   // NEXT STEP: Create cells
 
-  const size_type no_of_cells = cells.size();
-
-  // Create an auxiliary data structure to store the edges for the cells
-  // For every cell and its edges the global edge index is extracted
-  // from the auxiliary associative array.
-  std::vector<std::array<size_type, 4>> edge_indices(no_of_cells);
-
-  size_type edge_array_position = 0;  // actual position in edge array
-  for (const EdgeMap::value_type &edge : edge_map) {
-    // Obtain array of indices of adjacent cells
-    AdjCellsList adjacent_cells(edge.second.adj_cells_list);
-    for (const auto &adj_cell : adjacent_cells) {
-      const size_type adj_cell_index = adj_cell.cell_idx;
-      // Local index of edge in adjacent cell
-      const size_type edge_local_index = adj_cell.edge_idx;
-      LF_ASSERT_MSG(adj_cell_index < no_of_cells, "adj_cell_idx out of bounds");
-      LF_ASSERT_MSG(edge_local_index < cells[adj_cell_index].first.size(),
-                    "local edge index out of bounds");
-      // Set edge index in auxiliary cell matrix
-      edge_indices[adj_cell_index][edge_local_index] = edge_array_position;
-    }
-    edge_array_position++;
-  }
-
   // Diagnostics
   if (output_ctrl_ > 10) {
     std::cout << "########################################" << std::endl;
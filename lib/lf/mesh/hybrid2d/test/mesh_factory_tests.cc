@@ -155,6 +155,72 @@ TEST(lf_hybrid2d, EdgeNumbering) {
   EXPECT_EQ(mesh->Index(**mesh->Entities(0).begin()), 0);
 }
 
+TEST(lf_hybrid2d, EdgeNumberingOrder) {
+  // Hybrid mesh built from cells only, large enough for a concurrent sort of
+  // the edges
+  const size_type nx = 200;
+  const size_type ny = 150;
+  MeshFactory mf(2);
+  for (size_type j = 0; j <= ny; ++j) {
+    for (size_type i = 0; i <= nx; ++i) {
+      mf.AddPoint(Eigen::Vector2d(i, j));
+    }
+  }
+  size_type num_trias = 0;
+  for (size_type j = 0; j < ny; ++j) {
+    for (size_type i = 0; i < nx; ++i) {
+      const size_type v = j * (nx + 1) + i;
+      const std::array<size_type, 4> c{{v, v + 1, v + nx + 2, v + nx + 1}};
+      if ((i + j) % 3 == 0) {
+        mf.AddEntity(base::RefEl::kQuad(), c, nullptr);
+      } else {
+        mf.AddEntity(base::RefEl::kTria(),
+                     std::array<size_type, 3>{{c[2], c[1], c[0]}}, nullptr);
+        mf.AddEntity(base::RefEl::kTria(),
+                     std::array<size_type, 3>{{c[0], c[3], c[2]}}, nullptr);
+        num_trias++;
+      }
+    }
+  }
+  auto mesh = mf.Build();
+  const size_type num_edges = mesh->NumEntities(1);
+  EXPECT_EQ(num_edges, (nx + 1) * ny + nx * (ny + 1) + num_trias);
+
+  // Internally created edges are sorted by their endpoint indices
+  std::pair<size_type, size_type> prev_key{0, 0};
+  for (size_type k = 0; k < num_edges; ++k) {
+    const Entity* edge = mesh->EntityByIndex(1, k);
+    const auto nodes = edge->SubEntities(1);
+    const size_type p0 = mesh->Index(*nodes[0]);
+    const size_type p1 = mesh->Index(*nodes[1]);
+    const std::pair<size_type, size_type> key{std::min(p0, p1),
+                                              std::max(p0, p1)};
+    if (k > 0) {
+      EXPECT_LT(prev_key, key) << "edge " << k;
+    }
+    prev_key = key;
+  }
+
+  // Edges of cells connect the right vertices and have at most two cells
+  std::vector<int> num_adj_cells(num_edges, 0);
+  for (const Entity* cell : mesh->Entities(0)) {
+    const base::RefEl ref_el = cell->RefEl();
+    const auto corners = cell->SubEntities(2);
+    const auto edges = cell->SubEntities(1);
+    for (sub_idx_t j = 0; j < ref_el.NumSubEntities(1); ++j) {
+      const Entity* c0 = corners[ref_el.SubSubEntity2SubEntity(1, j, 1, 0)];
+      const Entity* c1 = corners[ref_el.SubSubEntity2SubEntity(1, j, 1, 1)];
+      const auto edge_nodes = edges[j]->SubEntities(1);
+      EXPECT_TRUE((edge_nodes[0] == c0 && edge_nodes[1] == c1) ||
+                  (edge_nodes[0] == c1 && edge_nodes[1] == c0));
+      num_adj_cells[mesh->Index(*edges[j])]++;
+    }
+  }
+  for (const int n : num_adj_cells) {
+    EXPECT_TRUE(n == 1 || n == 2);
+  }
+}
+
 TEST(lf_hybrid2d, IncompleteMeshes) {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-result"
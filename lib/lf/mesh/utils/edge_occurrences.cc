@@ -0,0 +1,204 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Implementation of the grouping of edge occurrences
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#include "edge_occurrences.h"
+
+#include <algorithm>
+
+namespace lf::mesh::utils {
+
+std::vector<base::size_type> GroupEdgeOccurrences(
+    std::vector<EdgeOccurrence> &occ) {
+  using size_type = base::size_type;
+  const auto n = static_cast<size_type>(occ.size());
+  // Threads do not pay off for small meshes
+  const unsigned int num_threads =
+      (n < (1U << 16U)) ? 1 : lf::base::NumWorkerThreads();
+  // Same number of chunks as in every call of ParallelForChunks() below
+  const unsigned int num_chunks =
+      std::max(1U, std::min<unsigned int>(num_threads, n));
+
+  // Sorting by a key is equivalent to sorting by its endpoint indices packed
+  // into as few bits as possible. Digits in which all keys agree are skipped.
+  std::uint64_t key_or = 0;
+  for (const EdgeOccurrence &o : occ) {
+    key_or |= o.key;
+  }
+  unsigned int index_bits = 0;
+  while ((key_or & 0xFFFFFFFFU) >> index_bits != 0) {
+    ++index_bits;
+  }
+  auto packed = [index_bits](std::uint64_t key) -> std::uint64_t {
+    return ((key >> 32U) << index_bits) | (key & 0xFFFFFFFFU);
+  };
+  std::uint64_t packed_or = 0;
+  std::uint64_t packed_and = ~std::uint64_t{0};
+  for (const EdgeOccurrence &o : occ) {
+    packed_or |= packed(o.key);
+    packed_and &= packed(o.key);
+  }
+  const std::uint64_t varying_bits = packed_or ^ packed_and;
+
+  // Stable LSD radix sort. Every chunk counts its digits, then moves its
+  // occurrences behind those of the preceding chunks with the same digit.
+  constexpr unsigned int kDigitBits = 11;
+  constexpr size_type kNumBuckets = 1U << kDigitBits;
+  std::vector<EdgeOccurrence> buffer(n);
+  std::vector<size_type> offsets(num_chunks * kNumBuckets);
+  for (unsigned int shift = 0; shift < 2 * index_bits; shift += kDigitBits) {
+    if (((varying_bits >> shift) & (kNumBuckets - 1)) == 0) {
+      continue;
+    }
+    auto digit = [&packed, shift](const EdgeOccurrence &o) -> size_type {
+      return (packed(o.key) >> shift) & (kNumBuckets - 1);
+    };
+    std::fill(offsets.begin(), offsets.end(), 0);
+    lf::base::ParallelForChunks(
+        n, num_chunks,
+        [&](unsigned int chunk, size_type begin, size_type end) {
+          size_type *count = offsets.data() + chunk * kNumBuckets;
+          for (size_type k = begin; k < end; ++k) {
+            ++count[digit(occ[k])];
+          }
+        });
+    size_type pos = 0;
+    for (size_type d = 0; d < kNumBuckets; ++d) {
+      for (unsigned int chunk = 0; chunk < num_chunks; ++chunk) {
+        const size_type count = offsets[chunk * kNumBuckets + d];
+        offsets[chunk * kNumBuckets + d] = pos;
+        pos += count;
+      }
+    }
+    lf::base::ParallelForChunks(
+        n, num_chunks,
+        [&](unsigned int chunk, size_type begin, size_type end) {
+          size_type *next = offsets.data() + chunk * kNumBuckets;
+          for (size_type k = begin; k < end; ++k) {
+            buffer[next[digit(occ[k])]++] = occ[k];
+          }
+        });
+    occ.swap(buffer);
+  }
+
+  // Position of the first occurrence of every edge. The few occurrences of
+  // an edge are usually in scan order already, otherwise sort them.
+  std::vector<size_type> edge_begin;
+  edge_begin.reserve(n / 2 + 1);
+  for (size_type k = 0; k < n; ++k) {
+    if ((k == 0) || (occ[k].key != occ[k - 1].key)) {
+      edge_begin.push_back(k);
+    } else if (occ[k] < occ[k - 1]) {
+      std::sort(occ.begin() + edge_begin.back(), occ.begin() + k + 1);
+    }
+  }
+  edge_begin.push_back(n);
+  return edge_begin;
+}
+
+void BuildMeshEdges(
+    std::vector<std::pair<std::array<base::size_type, 2>,
+                          std::unique_ptr<geometry::Geometry>>> &edges,
+    const std::vector<std::pair<std::array<base::size_type, 4>,
+                                std::unique_ptr<geometry::Geometry>>> &cells,
+    const std::vector<EdgeOccurrence> &occ,
+    const std::vector<base::size_type> &edge_begin, base::size_type num_nodes,
+    bool check_completeness, const std::function<void(MeshEdge &)> &visitor) {
+  using size_type = base::size_type;
+  const size_type no_of_edges = edge_begin.size() - 1;
+  // if we check for mesh completeness, store for every node if it has a
+  // super entity.
+  std::vector<bool> node_has_super_entity;
+  if (check_completeness) {
+    node_has_super_entity.resize(num_nodes, false);
+  }
+  // Index of the first endpoint of an occurrence in its local orientation
+  auto first_node = [&edges, &cells](const EdgeOccurrence &o) -> size_type {
+    if (o.supplied()) {
+      return edges[o.owner].first[0];
+    }
+    const std::array<size_type, 4> &cell_node_list(cells[o.owner].first);
+    const base::RefEl ref_el = (cell_node_list[3] == base::kIdxNil)
+                                   ? base::RefEl::kTria()
+                                   : base::RefEl::kQuad();
+    return cell_node_list[ref_el.SubSubEntity2SubEntity(1, o.local_idx, 1, 0)];
+  };
+
+  // Internally created edges are numbered after the supplied edges, whose
+  // index must agree with their position in the 'edges' array.
+  auto edge_index = static_cast<base::glb_idx_t>(edges.size());
+  for (size_type pos = 0; pos < no_of_edges; ++pos) {
+    const EdgeOccurrence *occ_begin = occ.data() + edge_begin[pos];
+    const EdgeOccurrence *occ_end = occ.data() + edge_begin[pos + 1];
+    MeshEdge edge{pos, base::kIdxNil, {}, nullptr, occ_begin, occ_end};
+    // Indices of the two endpoints of the current edge, the orientation is
+    // that of the first occurrence
+    size_type &p0 = edge.nodes[0];
+    size_type &p1 = edge.nodes[1];
+    p0 = first_node(*occ_begin);
+    p1 = static_cast<size_type>(occ_begin->key >> 32U);
+    if (p1 == p0) {
+      p1 = static_cast<size_type>(occ_begin->key & 0xFFFFFFFFU);
+    }
+
+    // (i) the edge geometry was specified in the `edges` argument. In this
+    // case the edge index must agree with its position in that array.
+    // (ii) the edge has to be created internally. In this case assign an
+    // index larger than the index of any supplied edge and inherit the
+    // geometry from the first adjacent cell that has one.
+    if (occ_begin->supplied()) {
+      LF_VERIFY_MSG((occ_begin + 1 == occ_end) || !(occ_begin + 1)->supplied(),
+                    "Duplicate edge " << p0 << " <-> " << p1);
+      edge.geometry = std::move(edges[occ_begin->owner].second);
+      edge.index = occ_begin->owner;
+      ++edge.adj_begin;
+    } else {
+      edge.index = edge_index++;
+    }
+    for (const EdgeOccurrence *adj = edge.adj_begin; adj != occ_end; ++adj) {
+      LF_ASSERT_MSG(adj->owner < cells.size(), "adj_cell_idx out of bounds");
+      const std::unique_ptr<geometry::Geometry> &cell_geometry(
+          cells[adj->owner].second);
+      if (!edge.geometry && cell_geometry) {
+        edge.geometry = cell_geometry->SubGeometry(1, adj->local_idx);
+        // NOTE: the local orientation of the edge in the cell can differ
+        // from the orientation of the edge. In this case the endpoints of
+        // the edge have to be swapped.
+        if (first_node(*adj) != p0) {
+          std::swap(p0, p1);
+        }
+      }
+    }
+
+    if (check_completeness) {
+      // record that the nodes of this edge have a super-entity (this edge):
+      node_has_super_entity[p0] = true;
+      node_has_super_entity[p1] = true;
+      // make sure that the edge belongs to at least one cell:
+      LF_VERIFY_MSG(edge.adj_begin != occ_end,
+                    "Mesh is incomplete: Edge with global index "
+                        << edge.index << " does not belong to a cell.");
+    }
+    visitor(edge);
+  }
+  LF_ASSERT_MSG(edge_index == no_of_edges, "Edge index mismatch");
+
+  if (check_completeness) {
+    for (size_type i = 0; i < num_nodes; ++i) {
+      LF_VERIFY_MSG(node_has_super_entity[i],
+                    "Mesh is incomplete: Node with global index "
+                        << i << " is not part of any edge.");
+    }
+  }
+}
+
+}  // namespace lf::mesh::utils
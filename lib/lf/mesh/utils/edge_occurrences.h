@@ -0,0 +1,140 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Discovery of the edges of a 2D mesh by sorting packed endpoint keys
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#ifndef __47a0e3c61b5d4f9a92d8c6e1f3b07a58
+#define __47a0e3c61b5d4f9a92d8c6e1f3b07a58
+
+#include <lf/base/base.h>
+#include <lf/geometry/geometry.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace lf::mesh::utils {
+
+static_assert(sizeof(base::size_type) <= sizeof(std::uint32_t),
+              "Node indices must fit into 32 bits for packed edge keys");
+
+/**
+ * @brief Key identifying an edge irrespective of its orientation
+ *
+ * The smaller endpoint index occupies the upper, the larger one the lower 32
+ * bits. Comparing keys is equivalent to the lexicographic comparison of the
+ * sorted pairs of endpoint indices.
+ */
+inline std::uint64_t EdgeKey(base::size_type p0, base::size_type p1) {
+  LF_ASSERT_MSG(p0 != p1, "No loops allowed");
+  const std::uint64_t lo = std::min(p0, p1);
+  const std::uint64_t hi = std::max(p0, p1);
+  return (lo << 32U) | hi;
+}
+
+/**
+ * @brief Occurrence of an edge while building a 2D mesh
+ *
+ * An edge occurs once in the list of supplied edges, if it is given there,
+ * and once for every adjacent cell.
+ */
+struct EdgeOccurrence {
+  std::uint64_t key;          ///< packed endpoint indices, see EdgeKey()
+  base::size_type owner;      ///< index of supplied edge or of adjacent cell
+  base::size_type local_idx;  ///< local index in cell, kIdxNil if supplied
+  /** @brief Does the occurrence stem from the list of supplied edges? */
+  [[nodiscard]] bool supplied() const { return local_idx == base::kIdxNil; }
+};
+
+/**
+ * @brief Orders by key. Occurrences of the same edge are ordered like in a
+ * scan of the supplied edges followed by a scan of the cells and their edges.
+ */
+inline bool operator<(const EdgeOccurrence &a, const EdgeOccurrence &b) {
+  if (a.key != b.key) {
+    return a.key < b.key;
+  }
+  if (a.supplied() != b.supplied()) {
+    return a.supplied();
+  }
+  return (a.owner == b.owner) ? (a.local_idx < b.local_idx)
+                              : (a.owner < b.owner);
+}
+
+/**
+ * @brief Sorts edge occurrences and groups the occurrences of every edge
+ *
+ * @param occ occurrences of edges, sorted on return
+ * @return vector of length (number of edges)+1, the occurrences of edge `k`
+ * are `occ[result[k]], ..., occ[result[k+1]-1]`.
+ *
+ * The occurrences are ordered by a stable radix sort of their keys, which
+ * processes chunks of the array concurrently, and the few occurrences of
+ * every edge are sorted afterwards if they are not in scan order. No two
+ * occurrences compare equal, so the result does not depend on the number of
+ * threads. After sorting, the edges appear in the lexicographic order of
+ * their sorted endpoint indices.
+ */
+std::vector<base::size_type> GroupEdgeOccurrences(
+    std::vector<EdgeOccurrence> &occ);
+
+/**
+ * @brief An edge of a 2D mesh as determined by BuildMeshEdges()
+ */
+struct MeshEdge {
+  base::size_type position;  ///< position of the edge in the sorted order
+  base::glb_idx_t index;     ///< index of the edge in the mesh
+  /** @brief indices of the endpoints, in the orientation of the edge */
+  std::array<base::size_type, 2> nodes;
+  /** @brief supplied or inherited geometry, `nullptr` if there is none */
+  std::unique_ptr<geometry::Geometry> geometry;
+  const EdgeOccurrence *adj_begin;  ///< first occurrence in an adjacent cell
+  const EdgeOccurrence *adj_end;    ///< end of the occurrences in cells
+};
+
+/**
+ * @brief Numbers and orients the edges of a 2D mesh and determines their
+ * geometries
+ *
+ * @param edges supplied edges with their geometries as passed to a 2D mesh
+ * constructor, the geometries are moved out
+ * @param cells cells with their (optional) geometries, a triangle is marked
+ * by lf::base::kIdxNil in the last position
+ * @param occ occurrences of the edges of `edges` and `cells`, grouped by
+ * GroupEdgeOccurrences()
+ * @param edge_begin return value of GroupEdgeOccurrences()
+ * @param num_nodes number of nodes of the mesh
+ * @param check_completeness whether to verify that every edge belongs to a
+ * cell and that every node belongs to an edge
+ * @param visitor called once for every edge in the sorted order
+ *
+ * Supplied edges keep their position in `edges` as their index and their
+ * geometry and orientation. The other edges are numbered after them in the
+ * sorted order, inherit the geometry of the first adjacent cell having one
+ * and are oriented like in that cell, or like in the first adjacent cell, if
+ * no cell has a geometry.
+ */
+void BuildMeshEdges(
+    std::vector<std::pair<std::array<base::size_type, 2>,
+                          std::unique_ptr<geometry::Geometry>>> &edges,
+    const std::vector<std::pair<std::array<base::size_type, 4>,
+                                std::unique_ptr<geometry::Geometry>>> &cells,
+    const std::vector<EdgeOccurrence> &occ,
+    const std::vector<base::size_type> &edge_begin, base::size_type num_nodes,
+    bool check_completeness, const std::function<void(MeshEdge &)> &visitor);
+
+}  // namespace lf::mesh::utils
+
+#endif  // __47a0e3c61b5d4f9a92d8c6e1f3b07a58
@@ -51,6 +51,24 @@ constexpr bool IsMeshFunctionCallable(long /*unused*/) {
   return false;
 }
 
+// Eigen expression types are never mesh functions. They must be excluded
+// before attempting the call, because the generic `operator()(RowIndices,
+// ColIndices)` of Eigen >= 3.4 causes a hard error instead of a substitution
+// failure when invoked with an Entity.
+template <class DERIVED>
+std::true_type IsEigenType(const Eigen::EigenBase<DERIVED> * /*unused*/);
+std::false_type IsEigenType(const void * /*unused*/);
+
+template <class T, class RETURN_TYPE>
+constexpr bool IsMeshFunctionCallableNonEigen() {
+  if constexpr (decltype(IsEigenType(
+                    std::declval<std::remove_reference_t<T> *>()))::value) {
+    return false;
+  } else {
+    return IsMeshFunctionCallable<T, RETURN_TYPE>(0);
+  }
+}
+
 }  // namespace internal
 
 /**
@@ -64,7 +82,7 @@ template <class T, class R = void>
 constexpr bool isMeshFunction =
     !std::is_reference_v<T> && std::is_copy_constructible_v<T> &&
     std::is_move_constructible_v<T> &&
-    internal::IsMeshFunctionCallable<T, R>(0);
+    internal::IsMeshFunctionCallableNonEigen<T, R>();
 
 /**
  * @brief Determine the type of objects returned by a MeshFunction
@@ -0,0 +1,237 @@
+/**
+ * @file
+ * @brief Implementation of the bucket grid for point location
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#include "point_locator.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace lf::mesh::utils {
+
+namespace {
+// Tolerance for points on the boundary of a reference element
+constexpr double kRefElTol = 1e-10;
+// Relative enlargement of the bounding boxes of non-affine cells
+constexpr double kCurvedPadding = 0.05;
+// Lattice of reference points 0, 1/kNumSamples, ..., 1 in every direction
+// for sampling non-affine cells
+constexpr int kNumSamples = 4;
+
+bool InRefEl(base::RefEl ref_el, const Eigen::Vector2d &local) {
+  if (local[0] < -kRefElTol || local[1] < -kRefElTol) {
+    return false;
+  }
+  if (ref_el == base::RefEl::kTria()) {
+    return local[0] + local[1] <= 1.0 + kRefElTol;
+  }
+  return local[0] <= 1.0 + kRefElTol && local[1] <= 1.0 + kRefElTol;
+}
+
+// Reference points whose images determine the bounding box of a cell
+Eigen::MatrixXd SamplePoints(base::RefEl ref_el, bool affine) {
+  if (affine) {
+    return ref_el.NodeCoords();
+  }
+  const bool tria = (ref_el == base::RefEl::kTria());
+  std::vector<Eigen::Vector2d> samples;
+  for (int i = 0; i <= kNumSamples; ++i) {
+    for (int j = 0; j <= (tria ? kNumSamples - i : kNumSamples); ++j) {
+      samples.emplace_back(static_cast<double>(i) / kNumSamples,
+                           static_cast<double>(j) / kNumSamples);
+    }
+  }
+  Eigen::MatrixXd points(2, samples.size());
+  for (std::size_t k = 0; k < samples.size(); ++k) {
+    points.col(k) = samples[k];
+  }
+  return points;
+}
+
+// Index of the bucket along one axis, clamped to the grid
+base::size_type BucketIndex(double x, double lower, double inv_size,
+                            base::size_type num) {
+  const double pos = std::floor((x - lower) * inv_size);
+  if (std::isnan(pos)) {
+    return 0;
+  }
+  // Clamp before the conversion, which is undefined for values outside the
+  // range of base::size_type, e.g., for points far away from the mesh
+  return static_cast<base::size_type>(
+      std::clamp(pos, 0.0, static_cast<double>(num - 1)));
+}
+}  // namespace
+
+std::optional<Eigen::Vector2d> InverseMap(const geometry::Geometry &geo,
+                                          const Eigen::Vector2d &global) {
+  LF_ASSERT_MSG(geo.DimLocal() == 2 && geo.DimGlobal() == 2,
+                "Only for 2D geometries in the plane");
+  constexpr int kMaxIterations = 25;
+  constexpr double kStepTol = 1e-13;
+  Eigen::Vector2d local = (geo.RefEl() == base::RefEl::kTria())
+                              ? Eigen::Vector2d(1.0 / 3.0, 1.0 / 3.0)
+                              : Eigen::Vector2d(0.5, 0.5);
+  if (geo.isAffine()) {
+    // A single Newton step from any point solves the linear system
+    const Eigen::Matrix2d jacobian = geo.Jacobian(local);
+    if (jacobian.determinant() == 0.0) {
+      return std::nullopt;
+    }
+    local -= jacobian.inverse() * (geo.Global(local) - global);
+    return local;
+  }
+  // Newton's method from the center of the reference element. The
+  // parametrizations of higher-order geometries only accept points of the unit
+  // square, therefore the iterates are projected onto it.
+  for (int it = 0; it < kMaxIterations; ++it) {
+    const Eigen::Vector2d residual = geo.Global(local) - global;
+    const Eigen::Matrix2d jacobian = geo.Jacobian(local);
+    if (jacobian.determinant() == 0.0) {
+      return std::nullopt;
+    }
+    const Eigen::Vector2d step = jacobian.inverse() * residual;
+    if (!step.allFinite()) {
+      return std::nullopt;
+    }
+    local = (local - step).cwiseMax(0.0).cwiseMin(1.0);
+    if (step.norm() <= kStepTol) {
+      return local;
+    }
+  }
+  return std::nullopt;
+}
+
+PointLocator::PointLocator(std::shared_ptr<const Mesh> mesh_p,
+                           unsigned int num_threads)
+    : mesh_p_(std::move(mesh_p)) {
+  LF_VERIFY_MSG(mesh_p_ != nullptr, "No mesh given");
+  LF_VERIFY_MSG(mesh_p_->DimMesh() == 2 && mesh_p_->DimWorld() == 2,
+                "PointLocator requires a 2D mesh in the plane");
+  const Mesh &mesh{*mesh_p_};
+  const base::size_type num_cells = mesh.NumEntities(0);
+
+  // Bounding boxes of all cells
+  boxes_.resize(4, num_cells);
+  const std::array<Eigen::MatrixXd, 4> samples{
+      SamplePoints(base::RefEl::kTria(), true),
+      SamplePoints(base::RefEl::kTria(), false),
+      SamplePoints(base::RefEl::kQuad(), true),
+      SamplePoints(base::RefEl::kQuad(), false)};
+  base::ParallelForChunks(
+      num_cells, num_threads,
+      [&](unsigned int /*chunk*/, base::size_type begin, base::size_type end) {
+        for (base::glb_idx_t idx = begin; idx < end; ++idx) {
+          const geometry::Geometry &geo{
+              *mesh.EntityByIndex(0, idx)->Geometry()};
+          const bool affine = geo.isAffine();
+          const int which = ((geo.RefEl() == base::RefEl::kQuad()) ? 2 : 0) +
+                            (affine ? 0 : 1);
+          const Eigen::MatrixXd corners{geo.Global(samples[which])};
+          Eigen::Vector2d lo = corners.rowwise().minCoeff();
+          Eigen::Vector2d hi = corners.rowwise().maxCoeff();
+          if (!affine) {
+            const double pad = kCurvedPadding * (hi - lo).maxCoeff();
+            lo.array() -= pad;
+            hi.array() += pad;
+          }
+          boxes_.col(idx) << lo, hi;
+        }
+      });
+
+  // Grid with about one bucket per cell
+  lower_ = Eigen::Vector2d::Zero();
+  Eigen::Vector2d extent = Eigen::Vector2d::Ones();
+  if (num_cells > 0) {
+    lower_ = boxes_.topRows<2>().rowwise().minCoeff();
+    extent = (boxes_.bottomRows<2>().rowwise().maxCoeff() - lower_)
+                 .cwiseMax(1e-300);
+  }
+  const double max_buckets = std::max<base::size_type>(num_cells, 1);
+  const double bucket_size = std::sqrt(extent.prod() / max_buckets);
+  num_x_ = static_cast<base::size_type>(
+      std::clamp(std::ceil(extent[0] / bucket_size), 1.0, max_buckets));
+  num_y_ = static_cast<base::size_type>(
+      std::clamp(std::ceil(extent[1] / bucket_size), 1.0, max_buckets));
+  inv_bucket_size_ << num_x_ / extent[0], num_y_ / extent[1];
+
+  // Sort the cells into all buckets their boxes overlap, in two sweeps
+  auto for_each_bucket = [this](base::glb_idx_t idx, auto &&f) {
+    const base::size_type ix0 =
+        BucketIndex(boxes_(0, idx), lower_[0], inv_bucket_size_[0], num_x_);
+    const base::size_type ix1 =
+        BucketIndex(boxes_(2, idx), lower_[0], inv_bucket_size_[0], num_x_);
+    const base::size_type iy0 =
+        BucketIndex(boxes_(1, idx), lower_[1], inv_bucket_size_[1], num_y_);
+    const base::size_type iy1 =
+        BucketIndex(boxes_(3, idx), lower_[1], inv_bucket_size_[1], num_y_);
+    for (base::size_type iy = iy0; iy <= iy1; ++iy) {
+      for (base::size_type ix = ix0; ix <= ix1; ++ix) {
+        f(iy * num_x_ + ix);
+      }
+    }
+  };
+  bucket_offsets_.assign(num_x_ * num_y_ + 1, 0);
+  for (base::glb_idx_t idx = 0; idx < num_cells; ++idx) {
+    for_each_bucket(idx,
+                    [this](base::size_type b) { ++bucket_offsets_[b + 1]; });
+  }
+  for (base::size_type b = 0; b < num_x_ * num_y_; ++b) {
+    bucket_offsets_[b + 1] += bucket_offsets_[b];
+  }
+  bucket_cells_.resize(bucket_offsets_.back());
+  std::vector<base::size_type> fill(bucket_offsets_.begin(),
+                                    bucket_offsets_.end() - 1);
+  for (base::glb_idx_t idx = 0; idx < num_cells; ++idx) {
+    const mesh::Entity *cell = mesh.EntityByIndex(0, idx);
+    for_each_bucket(idx, [this, &fill, cell](base::size_type b) {
+      bucket_cells_[fill[b]++] = cell;
+    });
+  }
+}
+
+PointLocation PointLocator::Locate(const Eigen::Vector2d &global) const {
+  if (!global.allFinite()) {
+    return {};
+  }
+  const base::size_type ix =
+      BucketIndex(global[0], lower_[0], inv_bucket_size_[0], num_x_);
+  const base::size_type iy =
+      BucketIndex(global[1], lower_[1], inv_bucket_size_[1], num_y_);
+  const base::size_type b = iy * num_x_ + ix;
+  for (base::size_type k = bucket_offsets_[b]; k < bucket_offsets_[b + 1];
+       ++k) {
+    const mesh::Entity *cell = bucket_cells_[k];
+    const auto box = boxes_.col(mesh_p_->Index(*cell));
+    const double tol = kRefElTol * (box.tail<2>() - box.head<2>()).maxCoeff();
+    if ((global.array() < box.head<2>().array() - tol).any() ||
+        (global.array() > box.tail<2>().array() + tol).any()) {
+      continue;
+    }
+    const std::optional<Eigen::Vector2d> local =
+        InverseMap(*cell->Geometry(), global);
+    if (local && InRefEl(cell->RefEl(), *local)) {
+      return {cell, *local};
+    }
+  }
+  return {};
+}
+
+std::vector<PointLocation> PointLocator::LocateBatch(
+    const Eigen::MatrixXd &points, unsigned int num_threads) const {
+  LF_ASSERT_MSG(points.rows() == 2, "Points must have two coordinates");
+  std::vector<PointLocation> result(points.cols());
+  base::ParallelForChunks(
+      result.size(), num_threads,
+      [&](unsigned int /*chunk*/, base::size_type begin, base::size_type end) {
+        for (base::size_type i = begin; i < end; ++i) {
+          result[i] = Locate(points.col(i));
+        }
+      });
+  return result;
+}
+
+}  // namespace lf::mesh::utils
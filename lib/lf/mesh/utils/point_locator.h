@@ -0,0 +1,137 @@
+/**
+ * @file
+ * @brief Location of global points in the cells of a 2D mesh
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#ifndef __3a9d5e0b7c2f4e18a6b41d8f9c0e27b5
+#define __3a9d5e0b7c2f4e18a6b41d8f9c0e27b5
+
+#include <lf/mesh/mesh.h>
+
+#include <Eigen/Dense>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace lf::mesh::utils {
+
+/**
+ * @brief Inverse of the mapping of a 2D geometry onto the plane
+ *
+ * @param geo a geometry with `geo.DimLocal() == geo.DimGlobal() == 2`
+ * @param global a point in the plane
+ * @return the reference coordinates \f$\hat{x}\f$ with
+ * \f$\Phi(\hat{x}) = x\f$, where \f$\Phi\f$ is the map of `geo` and \f$x\f$
+ * the point `global`, or `std::nullopt` if they could not be found
+ *
+ * For affine geometries the result is obtained by solving a single linear
+ * system. Otherwise, e.g. for lf::geometry::QuadO1, lf::geometry::TriaO2 or
+ * lf::geometry::QuadO2, Newton's method is run from the center of the
+ * reference element.
+ *
+ * @note For an affine geometry the returned point lies outside the reference
+ * element if `global` lies outside the geometry. For other geometries all
+ * iterates are confined to the unit square, on which higher-order
+ * parametrizations are defined, and `std::nullopt` is returned if no preimage
+ * is found there.
+ */
+std::optional<Eigen::Vector2d> InverseMap(const geometry::Geometry &geo,
+                                          const Eigen::Vector2d &global);
+
+/** @brief A cell of a mesh and reference coordinates in it */
+struct PointLocation {
+  /** @brief the cell containing the point, `nullptr` if there is none */
+  const mesh::Entity *cell = nullptr;
+  /** @brief coordinates of the point in the reference element of `cell` */
+  Eigen::Vector2d local = Eigen::Vector2d::Zero();
+};
+
+/**
+ * @brief Finds the cells of a planar mesh containing given points
+ *
+ * The bounding boxes of all cells are sorted into a uniform grid of buckets
+ * covering the mesh, with about one bucket per cell. A point is located by
+ * inspecting only the cells whose bounding boxes overlap the bucket of the
+ * point and mapping it back to their reference elements with InverseMap().
+ * Hence, for meshes without extreme grading, a query costs \f$O(1)\f$ instead
+ * of a scan over all cells.
+ *
+ * The bounding boxes are computed from lf::geometry::Geometry::Global() at the
+ * corners of the cells. For non-affine cells the image of a small lattice of
+ * reference points is used instead and the box is enlarged a little, so that
+ * curved edges are covered.
+ *
+ * ### Example
+ *
+ * ~~~
+   lf::mesh::utils::PointLocator locator(mesh_p);
+   const lf::mesh::utils::PointLocation loc =
+       locator.Locate(Eigen::Vector2d(0.3, 0.4));
+   if (loc.cell != nullptr) {
+     // evaluate a mesh function on loc.cell at loc.local
+   }
+ * ~~~
+ *
+ * @note The mesh must be a 2D mesh in the plane and must not change while the
+ * PointLocator is in use.
+ */
+class PointLocator {
+ public:
+  /**
+   * @brief Builds the bucket grid for a mesh
+   * @param mesh_p a mesh with `DimMesh() == DimWorld() == 2`
+   * @param num_threads number of threads computing the bounding boxes, `0`
+   * selects lf::base::NumWorkerThreads()
+   */
+  explicit PointLocator(std::shared_ptr<const Mesh> mesh_p,
+                        unsigned int num_threads = 0);
+
+  /** @brief the mesh in which points are located */
+  [[nodiscard]] const std::shared_ptr<const Mesh> &getMesh() const {
+    return mesh_p_;
+  }
+
+  /**
+   * @brief Finds a cell containing a point
+   * @param global a point in the plane
+   * @return the cell and the reference coordinates of the point in it;
+   * `cell == nullptr` if the point lies outside the mesh or has non-finite
+   * coordinates
+   *
+   * Points on the boundary of cells are assigned to the adjacent cell with
+   * the smallest index. The test whether a point lies in a reference element
+   * uses a small tolerance.
+   */
+  [[nodiscard]] PointLocation Locate(const Eigen::Vector2d &global) const;
+
+  /**
+   * @brief Locates many points concurrently
+   * @param points matrix with two rows, each column is a point
+   * @param num_threads number of threads, `0` selects
+   * lf::base::NumWorkerThreads()
+   * @return vector whose entry `i` is `Locate(points.col(i))`
+   */
+  [[nodiscard]] std::vector<PointLocation> LocateBatch(
+      const Eigen::MatrixXd &points, unsigned int num_threads = 0) const;
+
+ private:
+  std::shared_ptr<const Mesh> mesh_p_;
+  // Lower left corner of the grid and the inverse bucket sizes
+  Eigen::Vector2d lower_;
+  Eigen::Vector2d inv_bucket_size_;
+  base::size_type num_x_ = 1;
+  base::size_type num_y_ = 1;
+  // Bounding boxes of the cells, (xmin, ymin, xmax, ymax) in column Index(c)
+  Eigen::Matrix<double, 4, Eigen::Dynamic> boxes_;
+  // Cells overlapping the bucket (ix, iy) are bucket_cells_[k] for
+  // bucket_offsets_[b] <= k < bucket_offsets_[b+1] with b = iy * num_x_ + ix,
+  // ordered by index
+  std::vector<base::size_type> bucket_offsets_;
+  std::vector<const mesh::Entity *> bucket_cells_;
+};
+
+}  // namespace lf::mesh::utils
+
+#endif  // __3a9d5e0b7c2f4e18a6b41d8f9c0e27b5
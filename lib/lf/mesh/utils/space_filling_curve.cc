@@ -0,0 +1,158 @@
+/**
+ * @file
+ * @brief Implementation of orderings along space-filling curves
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#include "space_filling_curve.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace lf::mesh::utils {
+
+std::ostream &operator<<(std::ostream &o, SpaceFillingCurve curve) {
+  switch (curve) {
+    case SpaceFillingCurve::kMorton:
+      return o << "Morton";
+    case SpaceFillingCurve::kHilbert:
+      return o << "Hilbert";
+  }
+  return o;
+}
+
+namespace {
+// Spread the 32 bits of x to the even bit positions of a 64 bit word
+std::uint64_t SpreadBits(std::uint32_t x) {
+  std::uint64_t v = x;
+  v = (v | (v << 16U)) & 0x0000FFFF0000FFFFULL;
+  v = (v | (v << 8U)) & 0x00FF00FF00FF00FFULL;
+  v = (v | (v << 4U)) & 0x0F0F0F0F0F0F0F0FULL;
+  v = (v | (v << 2U)) & 0x3333333333333333ULL;
+  v = (v | (v << 1U)) & 0x5555555555555555ULL;
+  return v;
+}
+}  // namespace
+
+std::uint64_t MortonIndex(std::uint32_t ix, std::uint32_t iy) {
+  return SpreadBits(ix) | (SpreadBits(iy) << 1U);
+}
+
+std::uint64_t HilbertIndex(std::uint32_t ix, std::uint32_t iy) {
+  std::uint64_t d = 0;
+  // Descend through the quadrants from the coarsest level. In every step the
+  // coordinates are mapped to the orientation of the sub-curve in the current
+  // quadrant.
+  for (std::uint32_t s = 1U << 31U; s > 0; s >>= 1U) {
+    const std::uint32_t rx = ((ix & s) != 0) ? 1 : 0;
+    const std::uint32_t ry = ((iy & s) != 0) ? 1 : 0;
+    d += static_cast<std::uint64_t>(s) * s * ((3 * rx) ^ ry);
+    if (ry == 0) {
+      if (rx == 1) {
+        ix = ~ix;
+        iy = ~iy;
+      }
+      std::swap(ix, iy);
+    }
+  }
+  return d;
+}
+
+std::vector<std::uint64_t> SpaceFillingCurveIndices(
+    const Eigen::MatrixXd &points, SpaceFillingCurve curve) {
+  LF_ASSERT_MSG(points.rows() >= 2, "Points must have two coordinates");
+  const Eigen::Index n = points.cols();
+  std::vector<std::uint64_t> indices(n);
+  if (n == 0) {
+    return indices;
+  }
+  const Eigen::Vector2d lower = points.topRows<2>().rowwise().minCoeff();
+  const Eigen::Vector2d upper = points.topRows<2>().rowwise().maxCoeff();
+  const double extent = (upper - lower).maxCoeff();
+  // Map the bounding box into [0, 2^32-1]^2, the same scaling in both
+  // directions preserves the shape of the point cloud
+  constexpr double kMaxGrid =
+      static_cast<double>(std::numeric_limits<std::uint32_t>::max());
+  const double scale = (extent > 0.0) ? kMaxGrid / extent : 0.0;
+  for (Eigen::Index i = 0; i < n; ++i) {
+    const auto ix = static_cast<std::uint32_t>(
+        std::min(kMaxGrid, std::floor(scale * (points(0, i) - lower[0]))));
+    const auto iy = static_cast<std::uint32_t>(
+        std::min(kMaxGrid, std::floor(scale * (points(1, i) - lower[1]))));
+    indices[i] = (curve == SpaceFillingCurve::kHilbert) ? HilbertIndex(ix, iy)
+                                                        : MortonIndex(ix, iy);
+  }
+  return indices;
+}
+
+std::vector<base::size_type> SpaceFillingCurveOrder(
+    const Eigen::MatrixXd &points, SpaceFillingCurve curve) {
+  const std::vector<std::uint64_t> keys =
+      SpaceFillingCurveIndices(points, curve);
+  std::vector<base::size_type> order(keys.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(),
+                   [&keys](base::size_type i, base::size_type j) {
+                     return keys[i] < keys[j];
+                   });
+  return order;
+}
+
+Eigen::MatrixXd EntityBarycenters(const lf::mesh::Mesh &mesh,
+                                  base::dim_t codim) {
+  Eigen::MatrixXd centers(mesh.DimWorld(), mesh.NumEntities(codim));
+  for (const lf::mesh::Entity *e : mesh.Entities(codim)) {
+    centers.col(mesh.Index(*e)) =
+        e->Geometry()->Global(e->RefEl().NodeCoords()).rowwise().mean();
+  }
+  return centers;
+}
+
+MeshReordering ReorderAlongSpaceFillingCurve(
+    const lf::mesh::Mesh &mesh,
+    std::unique_ptr<lf::mesh::MeshFactory> mesh_factory,
+    SpaceFillingCurve curve) {
+  LF_VERIFY_MSG(mesh.DimMesh() == 2, "Only 2D meshes can be reordered");
+  LF_VERIFY_MSG(mesh_factory->DimMesh() == 2 &&
+                    mesh_factory->DimWorld() == mesh.DimWorld(),
+                "Mesh factory does not match the mesh");
+  MeshReordering result;
+  for (base::dim_t codim = 0; codim <= 2; ++codim) {
+    result.new_to_old[codim] =
+        SpaceFillingCurveOrder(EntityBarycenters(mesh, codim), curve);
+    result.old_to_new[codim].resize(result.new_to_old[codim].size());
+    for (base::size_type k = 0; k < result.new_to_old[codim].size(); ++k) {
+      result.old_to_new[codim][result.new_to_old[codim][k]] = k;
+    }
+  }
+
+  // Pass all entities to the factory in the new order. SubGeometry(0, 0)
+  // yields a copy of a geometry object.
+  for (const base::size_type old_idx : result.new_to_old[2]) {
+    mesh_factory->AddPoint(
+        mesh.EntityByIndex(2, old_idx)->Geometry()->SubGeometry(0, 0));
+  }
+  for (const base::dim_t codim : {1U, 0U}) {
+    for (const base::size_type old_idx : result.new_to_old[codim]) {
+      const lf::mesh::Entity &e{*mesh.EntityByIndex(codim, old_idx)};
+      std::array<base::size_type, 4> nodes{};
+      const auto vertices = e.SubEntities(2 - codim);
+      const auto num_vertices = static_cast<std::size_t>(vertices.size());
+      for (std::size_t k = 0; k < num_vertices; ++k) {
+        nodes[k] = result.old_to_new[2][mesh.Index(*vertices[k])];
+      }
+      mesh_factory->AddEntity(
+          e.RefEl(),
+          nonstd::span<const base::size_type>(nodes.data(), num_vertices),
+          e.Geometry()->SubGeometry(0, 0));
+    }
+  }
+  result.mesh = mesh_factory->Build();
+  return result;
+}
+
+}  // namespace lf::mesh::utils
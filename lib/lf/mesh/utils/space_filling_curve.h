@@ -0,0 +1,159 @@
+/**
+ * @file
+ * @brief Orderings of points and mesh entities along space-filling curves
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#ifndef __6d1c0e94b3f2489a8c57a1e02f4d7b63
+#define __6d1c0e94b3f2489a8c57a1e02f4d7b63
+
+#include <lf/mesh/mesh.h>
+
+#include <Eigen/Dense>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace lf::mesh::utils {
+
+/**
+ * @brief Types of space-filling curves through the unit square
+ *
+ * Both curves visit the cells of a \f$ 2^{32}\times 2^{32} \f$ grid in a
+ * recursive quadrant-by-quadrant order, so that points close to each other on
+ * the curve are also close in space. The Hilbert curve has no jumps and
+ * therefore a better locality, the Morton (Z-order) curve is cheaper to
+ * evaluate.
+ */
+enum class SpaceFillingCurve {
+  kMorton = 0,  ///< Z-order curve, interleaving of coordinate bits
+  kHilbert = 1  ///< Hilbert curve
+};
+
+/** @brief Output of the name of a space-filling curve */
+std::ostream &operator<<(std::ostream &o, SpaceFillingCurve curve);
+
+/**
+ * @brief Position of a grid cell on the Morton curve
+ * @param ix x-index of the cell in a \f$ 2^{32}\times 2^{32} \f$ grid
+ * @param iy y-index of the cell
+ * @return the bits of `ix` and `iy` interleaved, the bits of `ix` occupying the
+ * even positions
+ */
+std::uint64_t MortonIndex(std::uint32_t ix, std::uint32_t iy);
+
+/**
+ * @brief Position of a grid cell on the Hilbert curve
+ * @param ix x-index of the cell in a \f$ 2^{32}\times 2^{32} \f$ grid
+ * @param iy y-index of the cell
+ * @return distance of the cell from the start of the Hilbert curve, which
+ * starts in cell (0,0) and ends in cell \f$ (2^{32}-1,0) \f$
+ */
+std::uint64_t HilbertIndex(std::uint32_t ix, std::uint32_t iy);
+
+/**
+ * @brief Positions of points on a space-filling curve
+ *
+ * @param points matrix whose columns contain the coordinates of the points;
+ * only the first two rows are taken into account
+ * @param curve the space-filling curve to use
+ * @return vector of curve indices, one for every point
+ *
+ * The bounding box of the points is mapped to the grid of the curve with the
+ * same scaling factor in both directions.
+ */
+std::vector<std::uint64_t> SpaceFillingCurveIndices(
+    const Eigen::MatrixXd &points, SpaceFillingCurve curve);
+
+/**
+ * @brief Sorts points along a space-filling curve
+ *
+ * @param points matrix whose columns contain the coordinates of the points,
+ * see SpaceFillingCurveIndices()
+ * @param curve the space-filling curve to use
+ * @return vector `order` of column indices such that the points
+ * `points.col(order[0])`, `points.col(order[1])`, ... are visited one after the
+ * other by the curve. Points with the same curve index stay in their original
+ * order.
+ */
+std::vector<base::size_type> SpaceFillingCurveOrder(
+    const Eigen::MatrixXd &points, SpaceFillingCurve curve);
+
+/**
+ * @brief Barycenters of the corners of all entities of a co-dimension
+ *
+ * @param mesh the mesh
+ * @param codim co-dimension of the entities
+ * @return matrix of size `mesh.DimWorld() x mesh.NumEntities(codim)`, whose
+ * column `mesh.Index(e)` is the mean of the corners of entity `e`
+ *
+ * For straight entities this is the center of mass, for curved entities an
+ * approximation which is good enough for sorting.
+ */
+Eigen::MatrixXd EntityBarycenters(const lf::mesh::Mesh &mesh,
+                                  base::dim_t codim);
+
+/**
+ * @brief A mesh whose entities have been renumbered together with the
+ * permutations relating old and new indices
+ *
+ * For every co-dimension `codim`, the entity with index `i` of `mesh` was the
+ * entity with index `new_to_old[codim][i]` of the original mesh, and
+ * `old_to_new[codim]` is the inverse permutation.
+ */
+struct MeshReordering {
+  /** @brief the renumbered mesh */
+  std::shared_ptr<lf::mesh::Mesh> mesh;
+  /** @brief original index of every entity, per co-dimension */
+  std::array<std::vector<base::size_type>, 3> new_to_old;
+  /** @brief new index of every entity of the original mesh, per co-dimension
+   */
+  std::array<std::vector<base::size_type>, 3> old_to_new;
+};
+
+/**
+ * @brief Renumbers cells, edges and nodes of a 2D mesh along a space-filling
+ * curve
+ *
+ * @param mesh a 2D mesh
+ * @param mesh_factory factory building the renumbered mesh, e.g. a
+ * lf::mesh::hybrid2d::MeshFactory
+ * @param curve the space-filling curve to use
+ * @return the renumbered mesh and the permutations of the indices
+ *
+ * The entities of every co-dimension are numbered in the order in which a
+ * space-filling curve visits their barycenters, see SpaceFillingCurveOrder()
+ * and EntityBarycenters(). Hence entities adjacent in space get
+ * close indices, so that a traversal of `Entities(codim)` of the new mesh
+ * touches neighbouring memory and d.o.f. numberings derived from the entity
+ * indices yield matrices of small bandwidth.
+ *
+ * The new mesh consists of the same entities with copies of their geometry
+ * objects. All edges are passed to the factory explicitly, which fixes their
+ * numbering for lf::mesh::hybrid2d::MeshFactory. The vertex order of every
+ * cell and edge is kept, so local numberings and relative orientations are
+ * unchanged.
+ *
+ * ### Example
+ *
+ * ~~~
+   lf::mesh::utils::MeshReordering reordering =
+       lf::mesh::utils::ReorderAlongSpaceFillingCurve(
+           *mesh_p, std::make_unique<lf::mesh::hybrid2d::MeshFactory>(2),
+           lf::mesh::utils::SpaceFillingCurve::kHilbert);
+   // Transfer a vector of nodal values to the new numbering
+   for (std::size_t i = 0; i < values.size(); ++i) {
+     new_values[reordering.old_to_new[2][i]] = values[i];
+   }
+ * ~~~
+ */
+MeshReordering ReorderAlongSpaceFillingCurve(
+    const lf::mesh::Mesh &mesh,
+    std::unique_ptr<lf::mesh::MeshFactory> mesh_factory,
+    SpaceFillingCurve curve);
+
+}  // namespace lf::mesh::utils
+
+#endif  // __6d1c0e94b3f2489a8c57a1e02f4d7b63
@@ -0,0 +1,95 @@
+/**
+ * @file
+ * @brief Construction of the upward adjacency tables
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#include "super_entity_adjacency.h"
+
+namespace lf::mesh::utils {
+
+namespace {
+// Two sweeps over the super-entities: the first counts the super-entities of
+// every sub-entity, the second fills the ranges. Visiting the super-entities
+// by ascending index leaves every range sorted.
+std::unique_ptr<const SuperEntityTable> BuildTable(const Mesh& mesh,
+                                                   base::dim_t codim_sub,
+                                                   base::dim_t rel_codim) {
+  const base::dim_t codim_super = codim_sub - rel_codim;
+  const base::size_type num_sub = mesh.NumEntities(codim_sub);
+  const base::size_type num_super = mesh.NumEntities(codim_super);
+
+  auto table = std::make_unique<SuperEntityTable>();
+  std::vector<base::size_type>& offsets{table->offsets};
+  offsets.assign(num_sub + 1, 0);
+  for (base::glb_idx_t idx = 0; idx < num_super; ++idx) {
+    for (const mesh::Entity* sub :
+         mesh.EntityByIndex(codim_super, idx)->SubEntities(rel_codim)) {
+      ++offsets[mesh.Index(*sub) + 1];
+    }
+  }
+  for (base::size_type i = 0; i < num_sub; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+
+  table->super_entities.resize(offsets.back());
+  table->local_indices.resize(offsets.back());
+  // Next free position in the range of every sub-entity
+  std::vector<base::size_type> fill(offsets.begin(), offsets.end() - 1);
+  for (base::glb_idx_t idx = 0; idx < num_super; ++idx) {
+    const mesh::Entity* super = mesh.EntityByIndex(codim_super, idx);
+    base::size_type k = 0;
+    for (const mesh::Entity* sub : super->SubEntities(rel_codim)) {
+      const base::size_type pos = fill[mesh.Index(*sub)]++;
+      table->super_entities[pos] = super;
+      table->local_indices[pos] = k++;
+    }
+  }
+  return table;
+}
+}  // namespace
+
+SuperEntityAdjacency::SuperEntityAdjacency(std::shared_ptr<const Mesh> mesh_p)
+    : mesh_p_(std::move(mesh_p)) {
+  LF_VERIFY_MSG(mesh_p_ != nullptr, "No mesh given");
+  LF_VERIFY_MSG(mesh_p_->DimMesh() < kMaxCodim,
+                "Mesh dimension " << mesh_p_->DimMesh() << " not supported");
+}
+
+const SuperEntityTable& SuperEntityAdjacency::Table(
+    base::dim_t codim_sub, base::dim_t rel_codim) const {
+  LF_VERIFY_MSG(codim_sub <= mesh_p_->DimMesh(),
+                "Illegal codim_sub = " << codim_sub);
+  LF_VERIFY_MSG(rel_codim <= codim_sub, "rel_codim " << rel_codim
+                                                     << " too large");
+  std::call_once(built_[codim_sub][rel_codim], [&]() {
+    tables_[codim_sub][rel_codim] = BuildTable(*mesh_p_, codim_sub, rel_codim);
+  });
+  return *tables_[codim_sub][rel_codim];
+}
+
+nonstd::span<const mesh::Entity* const> SuperEntityAdjacency::SuperEntities(
+    const mesh::Entity& e, base::dim_t rel_codim) const {
+  const SuperEntityTable& table{Table(e.Codim(), rel_codim)};
+  const base::glb_idx_t idx = mesh_p_->Index(e);
+  return {table.super_entities.data() + table.offsets[idx],
+          table.super_entities.data() + table.offsets[idx + 1]};
+}
+
+nonstd::span<const base::size_type> SuperEntityAdjacency::LocalIndices(
+    const mesh::Entity& e, base::dim_t rel_codim) const {
+  const SuperEntityTable& table{Table(e.Codim(), rel_codim)};
+  const base::glb_idx_t idx = mesh_p_->Index(e);
+  return {table.local_indices.data() + table.offsets[idx],
+          table.local_indices.data() + table.offsets[idx + 1]};
+}
+
+base::size_type SuperEntityAdjacency::NumSuperEntities(
+    const mesh::Entity& e, base::dim_t rel_codim) const {
+  const SuperEntityTable& table{Table(e.Codim(), rel_codim)};
+  const base::glb_idx_t idx = mesh_p_->Index(e);
+  return table.offsets[idx + 1] - table.offsets[idx];
+}
+
+}  // namespace lf::mesh::utils
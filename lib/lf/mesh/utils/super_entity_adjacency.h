@@ -0,0 +1,149 @@
+/**
+ * @file
+ * @brief Upward adjacency of mesh entities stored in compressed row format
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#ifndef __8e2b47d1c05a4f6e9d3a71b6c4f28e05
+#define __8e2b47d1c05a4f6e9d3a71b6c4f28e05
+
+#include <lf/mesh/mesh.h>
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace lf::mesh::utils {
+
+/**
+ * @brief Super-entities of all entities of one co-dimension in compressed
+ * row storage (CSR) format
+ *
+ * The super-entities of the entity with index `i` are
+ * `super_entities[offsets[i]]`, ..., `super_entities[offsets[i+1]-1]`, in
+ * ascending order of their indices. `local_indices[k]` is the position of
+ * entity `i` in the range `super_entities[k]->SubEntities(rel_codim)`.
+ */
+struct SuperEntityTable {
+  /** @brief start of the range of every entity, one extra entry at the end */
+  std::vector<base::size_type> offsets;
+  /** @brief super-entities of all entities, concatenated */
+  std::vector<const mesh::Entity*> super_entities;
+  /** @brief local index of the entity in each of its super-entities */
+  std::vector<base::size_type> local_indices;
+};
+
+/**
+ * @brief Cached upward adjacency information for a mesh
+ *
+ * The lf::mesh::Mesh interface only provides downward adjacency through
+ * lf::mesh::Entity::SubEntities(). This class offers the reverse relation,
+ * e.g., the cells sharing a node or an edge. The SuperEntityTable for a pair
+ * of co-dimensions is built the first time it is needed, with two sweeps over
+ * the super-entities, one counting and one filling, and then kept, so that
+ * all further queries are \f$O(1)\f$ lookups.
+ *
+ * Queries are safe to issue from several threads at the same time, also
+ * before the tables have been built.
+ *
+ * ### Example
+ *
+ * Loop over the cells of the patch of a node and the local index of the node
+ * in these cells:
+ * ~~~
+   lf::mesh::utils::SuperEntityAdjacency adjacency(mesh_p);
+   const auto cells = adjacency.SuperEntities(*node, 2);
+   const auto local_idx = adjacency.LocalIndices(*node, 2);
+   for (std::size_t k = 0; k < cells.size(); ++k) {
+     // node == *cells[k]->SubEntities(2)[local_idx[k]]
+   }
+ * ~~~
+ *
+ * @note The mesh must not change while this object is in use.
+ */
+class SuperEntityAdjacency {
+ public:
+  /**
+   * @brief Prepares upward adjacency queries for a mesh, no tables are built
+   * yet
+   * @param mesh_p the mesh
+   */
+  explicit SuperEntityAdjacency(std::shared_ptr<const Mesh> mesh_p);
+
+  /** @name The tables are built in place, hence no copying or moving
+   * @{ */
+  SuperEntityAdjacency(const SuperEntityAdjacency&) = delete;
+  SuperEntityAdjacency(SuperEntityAdjacency&&) = delete;
+  SuperEntityAdjacency& operator=(const SuperEntityAdjacency&) = delete;
+  SuperEntityAdjacency& operator=(SuperEntityAdjacency&&) = delete;
+  /** @} */
+  ~SuperEntityAdjacency() = default;
+
+  /** @brief the mesh the adjacency information refers to */
+  [[nodiscard]] const std::shared_ptr<const Mesh>& getMesh() const {
+    return mesh_p_;
+  }
+
+  /**
+   * @brief Upward adjacency of all entities of a co-dimension
+   * @param codim_sub co-dimension of the queried entities
+   * @param rel_codim co-dimension of the super-entities relative to
+   * `codim_sub`, must not exceed `codim_sub`
+   * @return table of the super-entities of co-dimension `codim_sub -
+   * rel_codim`, built on the first call
+   *
+   * As in lf::mesh::utils::CountNumSuperEntities(), the cells adjacent to the
+   * edges of a 2D mesh are obtained for `codim_sub = 1, rel_codim = 1`, the
+   * cells adjacent to the nodes for `codim_sub = 2, rel_codim = 2`.
+   */
+  [[nodiscard]] const SuperEntityTable& Table(base::dim_t codim_sub,
+                                              base::dim_t rel_codim) const;
+
+  /**
+   * @brief Super-entities of an entity
+   * @param e an entity of the mesh
+   * @param rel_codim co-dimension of the super-entities relative to `e`
+   * @return range of the super-entities of co-dimension `e.Codim() -
+   * rel_codim` having `e` as a sub-entity, ordered by index
+   *
+   * This is the counterpart of lf::mesh::Entity::SubEntities().
+   */
+  [[nodiscard]] nonstd::span<const mesh::Entity* const> SuperEntities(
+      const mesh::Entity& e, base::dim_t rel_codim) const;
+
+  /**
+   * @brief Positions of an entity in the sub-entity ranges of its
+   * super-entities
+   * @param e an entity of the mesh
+   * @param rel_codim co-dimension of the super-entities relative to `e`
+   * @return range of the same length as SuperEntities(e, rel_codim), entry `k`
+   * being the index of `e` in `SuperEntities(e, rel_codim)[k]->SubEntities(
+   * rel_codim)`
+   */
+  [[nodiscard]] nonstd::span<const base::size_type> LocalIndices(
+      const mesh::Entity& e, base::dim_t rel_codim) const;
+
+  /** @brief number of super-entities of co-dimension `e.Codim() - rel_codim`
+   * adjacent to `e` */
+  [[nodiscard]] base::size_type NumSuperEntities(const mesh::Entity& e,
+                                                 base::dim_t rel_codim) const;
+
+ private:
+  // Co-dimensions range from 0 to 3
+  static constexpr unsigned kMaxCodim = 4;
+
+  std::shared_ptr<const Mesh> mesh_p_;
+  // tables_[codim_sub][rel_codim], built by the first call of Table()
+  mutable std::array<std::array<std::unique_ptr<const SuperEntityTable>,
+                                kMaxCodim>,
+                     kMaxCodim>
+      tables_;
+  mutable std::array<std::array<std::once_flag, kMaxCodim>, kMaxCodim>
+      built_;
+};
+
+}  // namespace lf::mesh::utils
+
+#endif  // __8e2b47d1c05a4f6e9d3a71b6c4f28e05
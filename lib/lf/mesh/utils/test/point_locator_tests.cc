@@ -0,0 +1,125 @@
+/**
+ * @file
+ * @brief Tests for the location of global points in meshes
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <lf/io/io.h>
+#include <lf/io/test_utils/read_mesh.h>
+#include <lf/mesh/hybrid2d/hybrid2d.h>
+#include <lf/mesh/utils/utils.h>
+
+#include <limits>
+#include <random>
+
+#include "lf/mesh/test_utils/test_meshes.h"
+
+namespace lf::mesh::utils::test {
+
+// Random points in the cells of a mesh, the cell of point i is returned in
+// cells[i]
+Eigen::MatrixXd RandomPointsInCells(const Mesh &mesh,
+                                    std::vector<const Entity *> &cells) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  Eigen::MatrixXd points(2, 4 * mesh.NumEntities(0));
+  cells.clear();
+  for (const Entity *cell : mesh.Entities(0)) {
+    for (int k = 0; k < 4; ++k) {
+      Eigen::Vector2d local(dist(gen), dist(gen));
+      if (cell->RefEl() == base::RefEl::kTria() && local.sum() > 1.0) {
+        local = Eigen::Vector2d::Ones() - local;
+      }
+      points.col(cells.size()) = cell->Geometry()->Global(local);
+      cells.push_back(cell);
+    }
+  }
+  return points;
+}
+
+void CheckLocations(const PointLocator &locator, const Eigen::MatrixXd &points,
+                    const std::vector<const Entity *> &cells) {
+  const std::vector<PointLocation> locations = locator.LocateBatch(points, 3);
+  ASSERT_EQ(locations.size(), cells.size());
+  for (std::size_t i = 0; i < cells.size(); ++i) {
+    const PointLocation &loc{locations[i]};
+    ASSERT_NE(loc.cell, nullptr) << "Point " << points.col(i).transpose();
+    // The point may also lie on the boundary of a neighbouring cell
+    EXPECT_TRUE(loc.cell->Geometry()->Global(loc.local).isApprox(
+        points.col(i), 1e-10));
+    if (*loc.cell == *cells[i]) {
+      const Eigen::Vector2d x = points.col(i);
+      EXPECT_TRUE(InverseMap(*cells[i]->Geometry(), x).has_value());
+    }
+    const PointLocation single = locator.Locate(points.col(i));
+    EXPECT_EQ(single.cell, loc.cell);
+  }
+}
+
+TEST(test_mesh_utils, point_locator_hybrid) {
+  for (int selector = 0; selector <= 8; ++selector) {
+    auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(selector);
+    const PointLocator locator(mesh_p);
+    std::vector<const Entity *> cells;
+    const Eigen::MatrixXd points = RandomPointsInCells(*mesh_p, cells);
+    CheckLocations(locator, points, cells);
+    // Points far away from the test meshes
+    EXPECT_EQ(locator.Locate(Eigen::Vector2d(-100.0, 0.5)).cell, nullptr);
+    EXPECT_EQ(locator.Locate(Eigen::Vector2d(1.0, 100.0)).cell, nullptr);
+    // Points whose bucket coordinates exceed the range of base::size_type
+    EXPECT_EQ(locator.Locate(Eigen::Vector2d(1.0E300, -1.0E300)).cell,
+              nullptr);
+    EXPECT_EQ(locator.Locate(Eigen::Vector2d(0.5, 1.0E20)).cell, nullptr);
+    EXPECT_EQ(
+        locator
+            .Locate(Eigen::Vector2d(std::numeric_limits<double>::quiet_NaN(),
+                                    0.5))
+            .cell,
+        nullptr);
+  }
+}
+
+TEST(test_mesh_utils, point_locator_curved) {
+  // Meshes of second-order triangles and quadrilaterals
+  for (const std::string name :
+       {"circle_second_order.msh", "curved_square_quads_2nd_order.msh"}) {
+    lf::io::GmshReader reader(
+        std::make_unique<lf::mesh::hybrid2d::MeshFactory>(2),
+        lf::io::test_utils::getMeshPath(name));
+    const PointLocator locator(reader.mesh());
+    std::vector<const Entity *> cells;
+    const Eigen::MatrixXd points = RandomPointsInCells(*reader.mesh(), cells);
+    SCOPED_TRACE(name);
+    CheckLocations(locator, points, cells);
+    EXPECT_EQ(locator.Locate(Eigen::Vector2d(100.0, 100.0)).cell, nullptr);
+  }
+}
+
+TEST(test_mesh_utils, inverse_map) {
+  const lf::geometry::QuadO1 quad(
+      (Eigen::Matrix<double, 2, 4>() << 0, 2, 2.5, 0, 0, 0, 1, 1.5)
+          .finished());
+  const Eigen::Vector2d local(0.3, 0.8);
+  const Eigen::Vector2d global = quad.Global(local);
+  const std::optional<Eigen::Vector2d> result = InverseMap(quad, global);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result->isApprox(local, 1e-12));
+
+  // Triangle with one curved edge
+  const lf::geometry::TriaO2 tria(
+      (Eigen::Matrix<double, 2, 6>() << 0, 1, 0, 0.5, 0.6, 0, 0, 0, 1, -0.1,
+       0.6, 0.5)
+          .finished());
+  EXPECT_FALSE(tria.isAffine());
+  const Eigen::Vector2d tria_local(0.2, 0.7);
+  const std::optional<Eigen::Vector2d> tria_result =
+      InverseMap(tria, tria.Global(tria_local));
+  ASSERT_TRUE(tria_result.has_value());
+  EXPECT_TRUE(tria_result->isApprox(tria_local, 1e-12));
+  // A point outside of the triangle has no preimage in the unit square
+  EXPECT_FALSE(InverseMap(tria, Eigen::Vector2d(5.0, 5.0)).has_value());
+}
+
+}  // namespace lf::mesh::utils::test
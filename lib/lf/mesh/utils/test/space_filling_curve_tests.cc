@@ -0,0 +1,124 @@
+/**
+ * @file
+ * @brief Tests for the orderings along space-filling curves
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <lf/mesh/hybrid2d/hybrid2d.h>
+#include <lf/mesh/utils/utils.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <set>
+
+#include "lf/mesh/test_utils/test_meshes.h"
+
+namespace lf::mesh::utils::test {
+
+TEST(test_mesh_utils, space_filling_curve_indices) {
+  EXPECT_EQ(MortonIndex(0, 0), 0);
+  EXPECT_EQ(MortonIndex(1, 0), 1);
+  EXPECT_EQ(MortonIndex(0, 1), 2);
+  EXPECT_EQ(MortonIndex(3, 3), 15);
+  constexpr std::uint32_t kMax = std::numeric_limits<std::uint32_t>::max();
+  EXPECT_EQ(MortonIndex(kMax, kMax), std::numeric_limits<std::uint64_t>::max());
+  // Hilbert curve runs from the lower left to the lower right corner
+  EXPECT_EQ(HilbertIndex(0, 0), 0);
+  EXPECT_EQ(HilbertIndex(kMax, 0), std::numeric_limits<std::uint64_t>::max());
+
+  // Points of a 16x16 grid are visited by the Hilbert curve in steps of unit
+  // length
+  const int n = 16;
+  Eigen::MatrixXd points(2, n * n);
+  for (int i = 0; i < n * n; ++i) {
+    points.col(i) << (i * 7) % n, (i * 7) / n % n;
+  }
+  const std::vector<base::size_type> order =
+      SpaceFillingCurveOrder(points, SpaceFillingCurve::kHilbert);
+  ASSERT_EQ(order.size(), n * n);
+  EXPECT_EQ(std::set<base::size_type>(order.begin(), order.end()).size(),
+            n * n);
+  for (int k = 1; k < n * n; ++k) {
+    EXPECT_DOUBLE_EQ(
+        (points.col(order[k]) - points.col(order[k - 1])).lpNorm<1>(), 1.0)
+        << "step " << k;
+  }
+  // The Morton curve visits the four quadrants one after the other
+  const std::vector<base::size_type> z_order =
+      SpaceFillingCurveOrder(points, SpaceFillingCurve::kMorton);
+  for (int k = 0; k < n * n; ++k) {
+    const int quadrant =
+        (points(0, z_order[k]) >= n / 2 ? 1 : 0) +
+        (points(1, z_order[k]) >= n / 2 ? 2 : 0);
+    EXPECT_EQ(quadrant, k / (n * n / 4));
+  }
+}
+
+TEST(test_mesh_utils, entity_barycenters) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  for (base::dim_t codim = 0; codim <= 2; ++codim) {
+    const Eigen::MatrixXd centers{EntityBarycenters(*mesh_p, codim)};
+    ASSERT_EQ(centers.cols(), mesh_p->NumEntities(codim));
+    for (const lf::mesh::Entity *e : mesh_p->Entities(codim)) {
+      const Eigen::MatrixXd corners{
+          e->Geometry()->Global(e->RefEl().NodeCoords())};
+      EXPECT_NEAR((centers.col(mesh_p->Index(*e)) -
+                   corners.rowwise().sum() / corners.cols())
+                      .norm(),
+                  0.0, 1.0E-12);
+    }
+  }
+}
+
+TEST(test_mesh_utils, reorder_along_space_filling_curve) {
+  for (int selector = 0; selector <= 8; ++selector) {
+    auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(selector);
+    const MeshReordering reordering = ReorderAlongSpaceFillingCurve(
+        *mesh_p, std::make_unique<lf::mesh::hybrid2d::MeshFactory>(2),
+        SpaceFillingCurve::kHilbert);
+    const lf::mesh::Mesh &mesh{*reordering.mesh};
+    for (base::dim_t codim = 0; codim <= 2; ++codim) {
+      const std::vector<base::size_type> &new_to_old{
+          reordering.new_to_old[codim]};
+      ASSERT_EQ(mesh.NumEntities(codim), mesh_p->NumEntities(codim));
+      ASSERT_EQ(new_to_old.size(), mesh.NumEntities(codim));
+      const Eigen::MatrixXd centers{EntityBarycenters(mesh, codim)};
+      const Eigen::MatrixXd old_centers{EntityBarycenters(*mesh_p, codim)};
+      for (base::size_type i = 0; i < new_to_old.size(); ++i) {
+        EXPECT_EQ(reordering.old_to_new[codim][new_to_old[i]], i);
+        // Same entity with the same sub-entities in the same order
+        const lf::mesh::Entity &e{*mesh.EntityByIndex(codim, i)};
+        const lf::mesh::Entity &old_e{
+            *mesh_p->EntityByIndex(codim, new_to_old[i])};
+        ASSERT_EQ(e.RefEl(), old_e.RefEl());
+        EXPECT_TRUE(centers.col(i).isApprox(old_centers.col(new_to_old[i])));
+        for (base::dim_t rel_codim = 1; codim + rel_codim <= 2; ++rel_codim) {
+          const auto subs = e.SubEntities(rel_codim);
+          const auto old_subs = old_e.SubEntities(rel_codim);
+          const auto num_subs = static_cast<base::size_type>(subs.size());
+          for (base::size_type k = 0; k < num_subs; ++k) {
+            EXPECT_EQ(reordering.old_to_new[codim + rel_codim]
+                                           [mesh_p->Index(*old_subs[k])],
+                      mesh.Index(*subs[k]));
+          }
+        }
+        if (codim == 0) {
+          const auto ori = e.RelativeOrientations();
+          const auto old_ori = old_e.RelativeOrientations();
+          EXPECT_TRUE(std::equal(ori.begin(), ori.end(), old_ori.begin()));
+        }
+      }
+    }
+    // The entities are sorted along the curve
+    for (base::dim_t codim = 0; codim <= 2; ++codim) {
+      EXPECT_EQ(reordering.new_to_old[codim],
+                SpaceFillingCurveOrder(EntityBarycenters(*mesh_p, codim),
+                                       SpaceFillingCurve::kHilbert));
+    }
+  }
+}
+
+}  // namespace lf::mesh::utils::test
@@ -0,0 +1,73 @@
+/**
+ * @file
+ * @brief Tests for the cached upward adjacency tables
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <lf/mesh/utils/utils.h>
+
+#include <thread>
+
+#include "lf/mesh/test_utils/test_meshes.h"
+
+namespace lf::mesh::utils::test {
+
+// Compare with super-entities found by scanning all entities
+TEST(test_mesh_utils, super_entity_adjacency) {
+  for (int selector = 0; selector <= 8; ++selector) {
+    auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(selector);
+    const SuperEntityAdjacency adjacency(mesh_p);
+    for (base::dim_t codim_sub = 0; codim_sub <= 2; ++codim_sub) {
+      for (base::dim_t rel_codim = 0; rel_codim <= codim_sub; ++rel_codim) {
+        auto count{CountNumSuperEntities(mesh_p, codim_sub, rel_codim)};
+        for (const Entity* e : mesh_p->Entities(codim_sub)) {
+          const auto supers = adjacency.SuperEntities(*e, rel_codim);
+          const auto local_idx = adjacency.LocalIndices(*e, rel_codim);
+          ASSERT_EQ(supers.size(), count(*e));
+          ASSERT_EQ(local_idx.size(), count(*e));
+          EXPECT_EQ(adjacency.NumSuperEntities(*e, rel_codim), count(*e));
+          const auto num_supers = static_cast<base::size_type>(supers.size());
+          for (base::size_type k = 0; k < num_supers; ++k) {
+            EXPECT_EQ(supers[k]->Codim(), codim_sub - rel_codim);
+            EXPECT_EQ(*supers[k]->SubEntities(rel_codim)[local_idx[k]], *e);
+            if (k > 0) {
+              EXPECT_LT(mesh_p->Index(*supers[k - 1]),
+                        mesh_p->Index(*supers[k]));
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(test_mesh_utils, super_entity_adjacency_concurrent) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh(0);
+  const SuperEntityAdjacency adjacency(mesh_p);
+  // All threads query the same table before it exists
+  std::vector<base::size_type> num_cells(4, 0);
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < num_cells.size(); ++t) {
+    threads.emplace_back([&, t]() {
+      for (const Entity* node : mesh_p->Entities(2)) {
+        num_cells[t] += adjacency.NumSuperEntities(*node, 2);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  // Every cell is counted once per vertex
+  base::size_type num_vertices = 0;
+  for (const Entity* cell : mesh_p->Entities(0)) {
+    num_vertices += cell->RefEl().NumNodes();
+  }
+  for (const base::size_type n : num_cells) {
+    EXPECT_EQ(n, num_vertices);
+  }
+  EXPECT_EQ(&adjacency.Table(2, 2), &adjacency.Table(2, 2));
+}
+
+}  // namespace lf::mesh::utils::test
@@ -86,7 +86,7 @@ std::shared_ptr<mesh::Mesh> TPQuadMeshBuilder::Build() {
       // Straight edges will be created as needed
       t_idx[quad_cnt] = mesh_factory_->AddEntity(
           lf::base::RefEl::kQuad(), vertex_index_list,
-          std::make_unique<geometry::QuadO1>(quad_geo));
+          std::make_unique<geometry::Parallelogram>(quad_geo));
     }
   }
   return mesh_factory_->Build();
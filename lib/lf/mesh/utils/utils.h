@@ -17,6 +17,7 @@ namespace lf::mesh::utils {}
 
 #include "all_codim_mesh_data_set.h"
 #include "codim_mesh_data_set.h"
+#include "edge_occurrences.h"
 #include "lambda_mesh_data_set.h"
 #include "mesh_data_set.h"
 #include "mesh_function_binary.h"
@@ -24,9 +25,12 @@ namespace lf::mesh::utils {}
 #include "mesh_function_global.h"
 #include "mesh_function_traits.h"
 #include "mesh_function_unary.h"
+#include "point_locator.h"
 #include "print_info.h"
+#include "space_filling_curve.h"
 #include "special_entity_sets.h"
 #include "structured_mesh_builder.h"
+#include "super_entity_adjacency.h"
 #include "torus_mesh_builder.h"
 #include "tp_quad_mesh_builder.h"
 #include "tp_triag_mesh_builder.h"
@@ -29,6 +29,13 @@ class FeSpaceLagrangeO1 : public UniformScalarFESpace<SCALAR> {
  public:
   using Scalar = SCALAR;
 
+  /** @brief number of local shape functions on a triangle, known at compile
+   * time */
+  static constexpr int kNumRefShapeFunctionsTria = 3;
+  /** @brief number of local shape functions on a quadrilateral, known at
+   * compile time */
+  static constexpr int kNumRefShapeFunctionsQuad = 4;
+
   /** @brief no default constructors */
   FeSpaceLagrangeO1() = delete;
   FeSpaceLagrangeO1(const FeSpaceLagrangeO1 &) = delete;
@@ -28,6 +28,13 @@ class FeSpaceLagrangeO2 : public UniformScalarFESpace<SCALAR> {
  public:
   using Scalar = SCALAR;
 
+  /** @brief number of local shape functions on a triangle, known at compile
+   * time */
+  static constexpr int kNumRefShapeFunctionsTria = 6;
+  /** @brief number of local shape functions on a quadrilateral, known at
+   * compile time */
+  static constexpr int kNumRefShapeFunctionsQuad = 9;
+
   /** @brief no default constructors */
   FeSpaceLagrangeO2() = delete;
   FeSpaceLagrangeO2(const FeSpaceLagrangeO2 &) = delete;
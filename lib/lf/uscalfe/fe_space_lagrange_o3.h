@@ -27,6 +27,13 @@ class FeSpaceLagrangeO3 : public UniformScalarFESpace<SCALAR> {
  public:
   using Scalar = SCALAR;
 
+  /** @brief number of local shape functions on a triangle, known at compile
+   * time */
+  static constexpr int kNumRefShapeFunctionsTria = 10;
+  /** @brief number of local shape functions on a quadrilateral, known at
+   * compile time */
+  static constexpr int kNumRefShapeFunctionsQuad = 16;
+
   /** @brief no default constructors */
   FeSpaceLagrangeO3() = delete;
   FeSpaceLagrangeO3(const FeSpaceLagrangeO3 &) = delete;
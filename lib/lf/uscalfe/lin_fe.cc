@@ -15,6 +15,8 @@
 
 #include "lin_fe.h"
 
+#include "lin_fe_simd.h"
+
 namespace lf::uscalfe {
 // Implementation for LinearFELaplaceElementMatrix
 unsigned int LinearFELaplaceElementMatrix::dbg_ctrl{0};
@@ -168,6 +170,60 @@ LinearFELaplaceElementMatrix::ElemMat LinearFELaplaceElementMatrix::Eval(
   return elem_mat;
 }
 
+void LinearFELaplaceElementMatrix::EvalBatch(
+    nonstd::span<const lf::mesh::Entity *const> cells,
+    std::vector<ElemMat> &mats) const {
+  const Eigen::Index n = cells.size();
+  if (static_cast<Eigen::Index>(mats.size()) < n) {
+    mats.resize(n);
+  }
+  if (n == 0) {
+    return;
+  }
+  const lf::base::RefEl ref_el{cells[0]->RefEl()};
+  if (ref_el != lf::base::RefEl::kTria()) {
+    for (Eigen::Index k = 0; k < n; ++k) {
+      mats[k] = Eval(*cells[k]);
+    }
+    return;
+  }
+  // Vertex coordinates of all triangles in structure-of-arrays layout
+  // x0|x1|x2|y0|y1|y2, as expected by the SIMD kernel
+  std::vector<double> xy(6 * n);
+  for (Eigen::Index k = 0; k < n; ++k) {
+    LF_ASSERT_MSG(cells[k]->RefEl() == ref_el, "Mixed cell types in batch");
+    const lf::geometry::Geometry *geo_ptr = cells[k]->Geometry();
+    LF_ASSERT_MSG(geo_ptr != nullptr, "Invalid geometry!");
+    LF_ASSERT_MSG((geo_ptr->DimGlobal() == 2) && (geo_ptr->DimLocal() == 2),
+                  "Only 2D implementation available!");
+    const Eigen::MatrixXd vertices{geo_ptr->Global(ref_el.NodeCoords())};
+    for (int c = 0; c < 2; ++c) {
+      for (int v = 0; v < 3; ++v) {
+        xy[(3 * c + v) * n + k] = vertices(c, v);
+      }
+    }
+  }
+  // Entries a00, a01, a02, a11, a12, a22 of all element matrices, computed
+  // with the widest instruction set available on this CPU
+  std::vector<double> a(6 * n);
+  std::vector<double> area(n);
+  LinearFETriaKernel(DetectSimdLevel(), n, xy.data(), a.data(), area.data());
+  const double *a00 = a.data();
+  const double *a01 = a00 + n;
+  const double *a02 = a01 + n;
+  const double *a11 = a02 + n;
+  const double *a12 = a11 + n;
+  const double *a22 = a12 + n;
+  for (Eigen::Index k = 0; k < n; ++k) {
+    // clang-format off
+    mats[k] << a00[k], a01[k], a02[k], 0.0,
+               a01[k], a11[k], a12[k], 0.0,
+               a02[k], a12[k], a22[k], 0.0,
+               0.0,    0.0,    0.0,    0.0;
+    // clang-format on
+  }
+}
+
 // No implementation for TEMPLATE LinearFELocalLoadVector here
 
 }  // namespace lf::uscalfe
@@ -68,6 +68,25 @@ class LinearFELaplaceElementMatrix {
    */
   [[nodiscard]] ElemMat Eval(const lf::mesh::Entity &cell) const;
 
+  /**
+   * @brief computation of element matrices for a block of cells of the same
+   * type
+   *
+   * @param cells cells of the same reference element type
+   * @param mats `mats[k]` is set to the element matrix for `cells[k]`. The
+   * vector is enlarged if it has less than `cells.size()` elements.
+   *
+   * For triangles the computations are carried out simultaneously for all
+   * cells of the block, operating on arrays of vertex coordinates with the
+   * SIMD kernel LinearFETriaKernel(), which uses the widest instruction set
+   * reported by DetectSimdLevel(). Quadrilaterals are dealt with by calling
+   * Eval().
+   *
+   * @sa lf::assemble::isBatchEntityMatrixProvider
+   */
+  void EvalBatch(nonstd::span<const lf::mesh::Entity *const> cells,
+                 std::vector<ElemMat> &mats) const;
+
  private:
   /// quadrature points on reference quadrilateral
   const double kSqrt3 = 1.0 / std::sqrt(3.0);
@@ -0,0 +1,195 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Implementation of cross-cell SIMD kernels for linear finite elements
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#include "lin_fe_simd.h"
+
+#include <lf/base/base.h>
+
+#include <cmath>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define LF_USCALFE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace lf::uscalfe {
+
+std::ostream &operator<<(std::ostream &o, SimdLevel level) {
+  switch (level) {
+    case SimdLevel::kScalar:
+      return o << "scalar";
+    case SimdLevel::kAVX2:
+      return o << "AVX2";
+    case SimdLevel::kAVX512:
+      return o << "AVX-512";
+  }
+  return o;
+}
+
+namespace {
+
+// Triangles [begin, n) one by one
+void TriaKernelScalar(std::size_t begin, std::size_t n, const double *xy,
+                      double *lapl, double *area) {
+  const double *x0 = xy;
+  const double *x1 = xy + n;
+  const double *x2 = xy + 2 * n;
+  const double *y0 = xy + 3 * n;
+  const double *y1 = xy + 4 * n;
+  const double *y2 = xy + 5 * n;
+  for (std::size_t k = begin; k < n; ++k) {
+    // Scaled gradients of barycentric coordinate functions = rotated opposite
+    // edge vectors
+    const double g0x = y1[k] - y2[k];
+    const double g0y = x2[k] - x1[k];
+    const double g1x = y2[k] - y0[k];
+    const double g1y = x0[k] - x2[k];
+    const double g2x = y0[k] - y1[k];
+    const double g2y = x1[k] - x0[k];
+    const double absdet = std::abs(g1x * g2y - g1y * g2x);
+    // Factor 1/(4*area) = 1/(2*|det|)
+    const double fac = 0.5 / absdet;
+    lapl[k] = fac * (g0x * g0x + g0y * g0y);
+    lapl[n + k] = fac * (g0x * g1x + g0y * g1y);
+    lapl[2 * n + k] = fac * (g0x * g2x + g0y * g2y);
+    lapl[3 * n + k] = fac * (g1x * g1x + g1y * g1y);
+    lapl[4 * n + k] = fac * (g1x * g2x + g1y * g2y);
+    lapl[5 * n + k] = fac * (g2x * g2x + g2y * g2y);
+    area[k] = 0.5 * absdet;
+  }
+}
+
+#ifdef LF_USCALFE_X86_SIMD
+
+// fac * (a . b) for 4 pairs of 2-vectors
+__attribute__((target("avx2,fma"))) inline __m256d ScaledDot256(
+    __m256d fac, __m256d ax, __m256d ay, __m256d bx, __m256d by) {
+  return _mm256_mul_pd(fac, _mm256_fmadd_pd(ax, bx, _mm256_mul_pd(ay, by)));
+}
+
+// Full registers of 4 triangles, returns the number of triangles processed
+__attribute__((target("avx2,fma"))) std::size_t TriaKernelAVX2(
+    std::size_t n, const double *xy, double *lapl, double *area) {
+  const __m256d half = _mm256_set1_pd(0.5);
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  std::size_t k = 0;
+  for (; k + 4 <= n; k += 4) {
+    const __m256d x0 = _mm256_loadu_pd(xy + k);
+    const __m256d x1 = _mm256_loadu_pd(xy + n + k);
+    const __m256d x2 = _mm256_loadu_pd(xy + 2 * n + k);
+    const __m256d y0 = _mm256_loadu_pd(xy + 3 * n + k);
+    const __m256d y1 = _mm256_loadu_pd(xy + 4 * n + k);
+    const __m256d y2 = _mm256_loadu_pd(xy + 5 * n + k);
+    const __m256d g0x = _mm256_sub_pd(y1, y2);
+    const __m256d g0y = _mm256_sub_pd(x2, x1);
+    const __m256d g1x = _mm256_sub_pd(y2, y0);
+    const __m256d g1y = _mm256_sub_pd(x0, x2);
+    const __m256d g2x = _mm256_sub_pd(y0, y1);
+    const __m256d g2y = _mm256_sub_pd(x1, x0);
+    const __m256d absdet = _mm256_andnot_pd(
+        sign, _mm256_fmsub_pd(g1x, g2y, _mm256_mul_pd(g1y, g2x)));
+    const __m256d fac = _mm256_div_pd(half, absdet);
+    _mm256_storeu_pd(lapl + k, ScaledDot256(fac, g0x, g0y, g0x, g0y));
+    _mm256_storeu_pd(lapl + n + k, ScaledDot256(fac, g0x, g0y, g1x, g1y));
+    _mm256_storeu_pd(lapl + 2 * n + k, ScaledDot256(fac, g0x, g0y, g2x, g2y));
+    _mm256_storeu_pd(lapl + 3 * n + k, ScaledDot256(fac, g1x, g1y, g1x, g1y));
+    _mm256_storeu_pd(lapl + 4 * n + k, ScaledDot256(fac, g1x, g1y, g2x, g2y));
+    _mm256_storeu_pd(lapl + 5 * n + k, ScaledDot256(fac, g2x, g2y, g2x, g2y));
+    _mm256_storeu_pd(area + k, _mm256_mul_pd(half, absdet));
+  }
+  return k;
+}
+
+// fac * (a . b) for 8 pairs of 2-vectors
+__attribute__((target("avx512f"))) inline __m512d ScaledDot512(
+    __m512d fac, __m512d ax, __m512d ay, __m512d bx, __m512d by) {
+  return _mm512_mul_pd(fac, _mm512_fmadd_pd(ax, bx, _mm512_mul_pd(ay, by)));
+}
+
+// Full registers of 8 triangles, returns the number of triangles processed
+__attribute__((target("avx512f"))) std::size_t TriaKernelAVX512(
+    std::size_t n, const double *xy, double *lapl, double *area) {
+  const __m512d half = _mm512_set1_pd(0.5);
+  std::size_t k = 0;
+  for (; k + 8 <= n; k += 8) {
+    const __m512d x0 = _mm512_loadu_pd(xy + k);
+    const __m512d x1 = _mm512_loadu_pd(xy + n + k);
+    const __m512d x2 = _mm512_loadu_pd(xy + 2 * n + k);
+    const __m512d y0 = _mm512_loadu_pd(xy + 3 * n + k);
+    const __m512d y1 = _mm512_loadu_pd(xy + 4 * n + k);
+    const __m512d y2 = _mm512_loadu_pd(xy + 5 * n + k);
+    const __m512d g0x = _mm512_sub_pd(y1, y2);
+    const __m512d g0y = _mm512_sub_pd(x2, x1);
+    const __m512d g1x = _mm512_sub_pd(y2, y0);
+    const __m512d g1y = _mm512_sub_pd(x0, x2);
+    const __m512d g2x = _mm512_sub_pd(y0, y1);
+    const __m512d g2y = _mm512_sub_pd(x1, x0);
+    const __m512d absdet =
+        _mm512_abs_pd(_mm512_fmsub_pd(g1x, g2y, _mm512_mul_pd(g1y, g2x)));
+    const __m512d fac = _mm512_div_pd(half, absdet);
+    _mm512_storeu_pd(lapl + k, ScaledDot512(fac, g0x, g0y, g0x, g0y));
+    _mm512_storeu_pd(lapl + n + k, ScaledDot512(fac, g0x, g0y, g1x, g1y));
+    _mm512_storeu_pd(lapl + 2 * n + k, ScaledDot512(fac, g0x, g0y, g2x, g2y));
+    _mm512_storeu_pd(lapl + 3 * n + k, ScaledDot512(fac, g1x, g1y, g1x, g1y));
+    _mm512_storeu_pd(lapl + 4 * n + k, ScaledDot512(fac, g1x, g1y, g2x, g2y));
+    _mm512_storeu_pd(lapl + 5 * n + k, ScaledDot512(fac, g2x, g2y, g2x, g2y));
+    _mm512_storeu_pd(area + k, _mm512_mul_pd(half, absdet));
+  }
+  return k;
+}
+
+#endif
+
+}  // namespace
+
+SimdLevel DetectSimdLevel() {
+#ifdef LF_USCALFE_X86_SIMD
+  static const SimdLevel level = []() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") != 0) {
+      return SimdLevel::kAVX512;
+    }
+    if ((__builtin_cpu_supports("avx2") != 0) &&
+        (__builtin_cpu_supports("fma") != 0)) {
+      return SimdLevel::kAVX2;
+    }
+    return SimdLevel::kScalar;
+  }();
+  return level;
+#else
+  return SimdLevel::kScalar;
+#endif
+}
+
+void LinearFETriaKernel(SimdLevel level, std::size_t n, const double *xy,
+                        double *lapl, double *area) {
+  LF_ASSERT_MSG(static_cast<int>(level) <= static_cast<int>(DetectSimdLevel()),
+                "SIMD level " << level << " not supported on this CPU");
+  std::size_t done = 0;
+#ifdef LF_USCALFE_X86_SIMD
+  switch (level) {
+    case SimdLevel::kAVX512:
+      done = TriaKernelAVX512(n, xy, lapl, area);
+      break;
+    case SimdLevel::kAVX2:
+      done = TriaKernelAVX2(n, xy, lapl, area);
+      break;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif
+  TriaKernelScalar(done, n, xy, lapl, area);
+}
+
+}  // namespace lf::uscalfe
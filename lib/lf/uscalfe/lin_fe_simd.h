@@ -0,0 +1,73 @@
+/***************************************************************************
+ * LehrFEM++ - A simple C++ finite element libray for teaching
+ * Developed from 2018 at the Seminar of Applied Mathematics of ETH Zurich,
+ * lead developers Dr. R. Casagrande and Prof. R. Hiptmair
+ ***************************************************************************/
+
+/**
+ * @file
+ * @brief Cross-cell SIMD kernels for element matrices of linear finite
+ * elements on triangles
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#ifndef __4b2974b1720a422c8e0c6e6b7eb209ff
+#define __4b2974b1720a422c8e0c6e6b7eb209ff
+
+#include <cstddef>
+#include <iostream>
+
+namespace lf::uscalfe {
+
+/**
+ * @brief Instruction set used by the SIMD kernels for linear finite elements
+ */
+enum class SimdLevel {
+  kScalar = 0,  ///< plain C++, one triangle after another
+  kAVX2 = 1,    ///< AVX2 + FMA, 4 triangles per register
+  kAVX512 = 2   ///< AVX-512F, 8 triangles per register
+};
+
+/** @brief Output of a SimdLevel, e.g., for logging */
+std::ostream &operator<<(std::ostream &o, SimdLevel level);
+
+/**
+ * @brief Most powerful SimdLevel supported by both the compiler and the CPU
+ * the program is running on
+ *
+ * The CPU is queried once, on the first call. Only x86-64 builds with GCC or
+ * Clang can use the vector kernels; all other builds report
+ * SimdLevel::kScalar.
+ */
+SimdLevel DetectSimdLevel();
+
+/**
+ * @brief Element matrices of the (negative) Laplacian and areas for a batch
+ * of triangles, computed lane-wise across triangles
+ *
+ * @param level instruction set to use, must not exceed DetectSimdLevel()
+ * @param n number of triangles
+ * @param xy vertex coordinates in structure-of-arrays layout: six
+ * consecutive arrays of length `n` holding \f$ x_0, x_1, x_2, y_0, y_1, y_2
+ * \f$ of all triangles
+ * @param lapl output, six consecutive arrays of length `n` holding the
+ * entries \f$ a_{00}, a_{01}, a_{02}, a_{11}, a_{12}, a_{22} \f$ of the
+ * symmetric 3x3 element matrices
+ * @param area output, array of length `n` receiving the areas of the
+ * triangles. The element mass matrix of triangle `k` is `area[k]/12` times
+ * the matrix with 2 on the diagonal and 1 off the diagonal.
+ *
+ * Gradients of barycentric coordinate functions are obtained from rotated
+ * edge vectors, so that all operations are additions, multiplications and a
+ * single division per triangle. Triangles not filling a full register are
+ * dealt with by the scalar code.
+ *
+ * @sa LinearFELaplaceElementMatrix::EvalBatch()
+ */
+void LinearFETriaKernel(SimdLevel level, std::size_t n, const double *xy,
+                        double *lapl, double *area);
+
+}  // namespace lf::uscalfe
+
+#endif  // __4b2974b1720a422c8e0c6e6b7eb209ff
@@ -86,10 +86,16 @@ class ReactionDiffusionElementMatrixProvider {
    */
   using ElemMat = Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>;
 
-  /** @brief standard constructors */
+  /** @brief standard constructors
+   *
+   * Copies share the coefficient functions and the finite element
+   * specification with the original object. Copying is used to obtain private
+   * provider objects for the worker threads of
+   * lf::assemble::ParallelAssembleMatrixLocally().
+   */
   /** @{ */
   ReactionDiffusionElementMatrixProvider(
-      const ReactionDiffusionElementMatrixProvider &) = delete;
+      const ReactionDiffusionElementMatrixProvider &) = default;
   ReactionDiffusionElementMatrixProvider(
       ReactionDiffusionElementMatrixProvider &&) noexcept = default;
   ReactionDiffusionElementMatrixProvider &operator=(
@@ -158,10 +164,59 @@ class ReactionDiffusionElementMatrixProvider {
    */
   ElemMat Eval(const lf::mesh::Entity &cell);
 
+  /**
+   * @brief computation of element matrices for a block of cells of the same
+   * type
+   *
+   * @param cells cells of the same reference element type
+   * @param mats `mats[k]` is set to the element matrix for `cells[k]`. The
+   * vector is enlarged if it has less than `cells.size()` elements.
+   *
+   * Same as calling Eval() for every cell, but the precomputed reference
+   * finite element is looked up only once per block, and the storage of the
+   * element matrices in `mats` is reused.
+   *
+   * @sa lf::assemble::isBatchEntityMatrixProvider
+   */
+  void EvalBatch(nonstd::span<const lf::mesh::Entity *const> cells,
+                 std::vector<ElemMat> &mats);
+
+  /**
+   * @brief Cell-dependent factors of the local bilinear form at the
+   * quadrature points, pulled back to the reference element
+   *
+   * @param cell the cell for which the factors are requested
+   * @param diff_fac a 2 x (2*nqp) matrix, the 2x2 block `k` is set to
+   * @f$ w_k |\det D\Phi| (D\Phi^{-T})^T \mathbf{\alpha}^T D\Phi^{-T} @f$
+   * at quadrature point `k`
+   * @param react_fac vector of length nqp, entry `k` is set to
+   * @f$ w_k |\det D\Phi| \gamma @f$ at quadrature point `k`
+   * @return precomputed reference finite element for the type of `cell`
+   *
+   * Together with the values and gradients of the reference shape functions
+   * these factors completely determine the element matrix: with the matrix
+   * @f$\mathbf{G}_k@f$ of reference gradients at quadrature point `k` and the
+   * vector @f$\mathbf{\phi}_k@f$ of reference shape function values, the
+   * element matrix equals
+   * @f$\sum_k \mathbf{G}_k\,\mathrm{diff\_fac}_k\,\mathbf{G}_k^T +
+   * \mathrm{react\_fac}_k\,\mathbf{\phi}_k\mathbf{\phi}_k^T@f$. They are
+   * cached by MatrixFreeOperator.
+   */
+  const PrecomputedScalarReferenceFiniteElement<SCALAR> &QuadratureFactors(
+      const lf::mesh::Entity &cell,
+      Eigen::Matrix<SCALAR, 2, Eigen::Dynamic> &diff_fac,
+      Eigen::Matrix<SCALAR, Eigen::Dynamic, 1> &react_fac);
+
   /** Virtual destructor */
   virtual ~ReactionDiffusionElementMatrixProvider() = default;
 
  private:
+  /** Compute element matrix for a cell into a given (resized) matrix */
+  void ComputeElemMat(
+      const lf::mesh::Entity &cell,
+      const PrecomputedScalarReferenceFiniteElement<SCALAR> &pfe,
+      ElemMat &mat);
+
   /** @name functors providing coefficient functions
    * @{ */
   /** Diffusion coefficient */
@@ -266,7 +321,43 @@ ReactionDiffusionElementMatrixProvider<
   LF_ASSERT_MSG(
       pfe.isInitialized(),
       "No local shape function information for entity type " << ref_el);
+  ElemMat mat;
+  ComputeElemMat(cell, pfe, mat);
+  return mat;
+}
+
+template <typename SCALAR, typename DIFF_COEFF, typename REACTION_COEFF>
+void ReactionDiffusionElementMatrixProvider<SCALAR, DIFF_COEFF,
+                                            REACTION_COEFF>::
+    EvalBatch(nonstd::span<const lf::mesh::Entity *const> cells,
+              std::vector<ElemMat> &mats) {
+  const auto num_cells = static_cast<std::size_t>(cells.size());
+  if (mats.size() < num_cells) {
+    mats.resize(num_cells);
+  }
+  if (num_cells == 0) {
+    return;
+  }
+  // All cells share the same type and, thus, the same precomputed data
+  const lf::base::RefEl ref_el{cells[0]->RefEl()};
+  const PrecomputedScalarReferenceFiniteElement<SCALAR> &pfe =
+      fe_precomp_[ref_el.Id()];
+  LF_ASSERT_MSG(
+      pfe.isInitialized(),
+      "No local shape function information for entity type " << ref_el);
+  for (std::size_t k = 0; k < num_cells; ++k) {
+    LF_ASSERT_MSG(cells[k]->RefEl() == ref_el, "Mixed cell types in batch");
+    ComputeElemMat(*cells[k], pfe, mats[k]);
+  }
+}
 
+template <typename SCALAR, typename DIFF_COEFF, typename REACTION_COEFF>
+void ReactionDiffusionElementMatrixProvider<SCALAR, DIFF_COEFF,
+                                            REACTION_COEFF>::
+    ComputeElemMat(const lf::mesh::Entity &cell,
+                   const PrecomputedScalarReferenceFiniteElement<SCALAR> &pfe,
+                   ElemMat &mat) {
+  const lf::base::RefEl ref_el{cell.RefEl()};
   // Query the shape of the cell
   const lf::geometry::Geometry *geo_ptr = cell.Geometry();
   LF_ASSERT_MSG(geo_ptr != nullptr, "Invalid geometry!");
@@ -297,8 +388,8 @@ ReactionDiffusionElementMatrixProvider<
   auto alphaval = alpha_(cell, pfe.Qr().Points());
   auto gammaval = gamma_(cell, pfe.Qr().Points());
 
-  // Element matrix
-  ElemMat mat(pfe.NumRefShapeFunctions(), pfe.NumRefShapeFunctions());
+  // Element matrix, no reallocation if the size does not change
+  mat.resize(pfe.NumRefShapeFunctions(), pfe.NumRefShapeFunctions());
   mat.setZero();
 
   // Loop over quadrature points
@@ -315,7 +406,231 @@ ReactionDiffusionElementMatrixProvider<
                 (gammaval[k] * pfe.PrecompReferenceShapeFunctions().col(k)) *
                     (pfe.PrecompReferenceShapeFunctions().col(k).transpose()));
   }
-  return mat;
+}
+
+template <typename SCALAR, typename DIFF_COEFF, typename REACTION_COEFF>
+const PrecomputedScalarReferenceFiniteElement<SCALAR>
+    &ReactionDiffusionElementMatrixProvider<SCALAR, DIFF_COEFF,
+                                            REACTION_COEFF>::
+        QuadratureFactors(const lf::mesh::Entity &cell,
+                          Eigen::Matrix<SCALAR, 2, Eigen::Dynamic> &diff_fac,
+                          Eigen::Matrix<SCALAR, Eigen::Dynamic, 1> &react_fac) {
+  const lf::base::RefEl ref_el{cell.RefEl()};
+  const PrecomputedScalarReferenceFiniteElement<SCALAR> &pfe =
+      fe_precomp_[ref_el.Id()];
+  LF_ASSERT_MSG(
+      pfe.isInitialized(),
+      "No local shape function information for entity type " << ref_el);
+  const lf::geometry::Geometry *geo_ptr = cell.Geometry();
+  LF_ASSERT_MSG(geo_ptr != nullptr, "Invalid geometry!");
+  LF_ASSERT_MSG((geo_ptr->DimLocal() == 2),
+                "Only 2D implementation available!");
+  const dim_t world_dim = geo_ptr->DimGlobal();
+  const base::size_type num_qp = pfe.Qr().NumPoints();
+  const Eigen::VectorXd determinants(
+      geo_ptr->IntegrationElement(pfe.Qr().Points()));
+  const Eigen::MatrixXd JinvT(
+      geo_ptr->JacobianInverseGramian(pfe.Qr().Points()));
+  auto alphaval = alpha_(cell, pfe.Qr().Points());
+  auto gammaval = gamma_(cell, pfe.Qr().Points());
+
+  diff_fac.resize(2, 2 * num_qp);
+  react_fac.resize(num_qp);
+  for (base::size_type k = 0; k < num_qp; ++k) {
+    const double w = pfe.Qr().Weights()[k] * determinants[k];
+    const auto JinvT_k(JinvT.block(0, 2 * k, world_dim, 2));
+    // Same factorization as in Eval(): (alpha*J)^T * J
+    diff_fac.block(0, 2 * k, 2, 2) =
+        w * ((alphaval[k] * JinvT_k).transpose() * JinvT_k);
+    react_fac[k] = w * gammaval[k];
+  }
+  return pfe;
+}
+
+/**
+ * @ingroup entity_matrix_provider
+ * @headerfile lf/uscalfe/uscalfe.h
+ * @brief Variant of ReactionDiffusionElementMatrixProvider for Lagrangian
+ * finite element spaces whose number of local shape functions is known at
+ * compile time
+ *
+ * @tparam FE_SPACE one of FeSpaceLagrangeO1, FeSpaceLagrangeO2 or
+ * FeSpaceLagrangeO3, or any type providing `Scalar` and the compile-time
+ * constants `kNumRefShapeFunctionsTria` and `kNumRefShapeFunctionsQuad`
+ * @tparam DIFF_COEFF a \ref mesh_function "MeshFunction" that defines the
+ *                    diffusion coefficient, either scalar- or matrix-valued
+ * @tparam REACTION_COEFF a \ref mesh_function "MeshFunction" that defines the
+ *                        reaction coefficient
+ *
+ * Computes the same element matrices as
+ * ReactionDiffusionElementMatrixProvider. However, the summation over the
+ * quadrature points is carried out with fixed-size Eigen matrices, whose
+ * dimensions are taken from `FE_SPACE`. Element matrices are returned as
+ * matrices with dynamic size but fixed maximal size, so they live on the
+ * stack.
+ *
+ * @note The lf::geometry::Geometry and \ref mesh_function "MeshFunction"
+ * interfaces return the integration elements, Jacobians and coefficient
+ * values at the quadrature points in dynamically allocated containers. These
+ * few allocations per cell remain.
+ *
+ * Restrictions: only meshes of dimension 2 embedded in 2D are supported, and
+ * quadrature rules of degree twice the polynomial degree are always used.
+ *
+ * @note This class complies with the type requirements for the template
+ * argument ENTITY_MATRIX_PROVIDER of the function
+ * lf::assemble::AssembleMatrixLocally().
+ */
+template <class FE_SPACE, typename DIFF_COEFF, typename REACTION_COEFF>
+class FixedSizeReactionDiffusionElementMatrixProvider {
+  static_assert(mesh::utils::isMeshFunction<DIFF_COEFF>);
+  static_assert(mesh::utils::isMeshFunction<REACTION_COEFF>);
+
+ public:
+  /** @brief scalar type of the element matrices */
+  using Scalar = typename FE_SPACE::Scalar;
+  /** @brief number of local shape functions on triangles */
+  static constexpr int kNumTria = FE_SPACE::kNumRefShapeFunctionsTria;
+  /** @brief number of local shape functions on quadrilaterals */
+  static constexpr int kNumQuad = FE_SPACE::kNumRefShapeFunctionsQuad;
+  /** @brief maximal size of element matrices */
+  static constexpr int kMaxNum = (kNumTria > kNumQuad) ? kNumTria : kNumQuad;
+  /**
+   * @brief type of returned element matrix: dynamic size, but storage of
+   * fixed maximal size
+   */
+  using ElemMat = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic,
+                                Eigen::ColMajor, kMaxNum, kMaxNum>;
+
+  /** @name standard constructors
+   * @{ */
+  FixedSizeReactionDiffusionElementMatrixProvider(
+      const FixedSizeReactionDiffusionElementMatrixProvider &) = default;
+  FixedSizeReactionDiffusionElementMatrixProvider(
+      FixedSizeReactionDiffusionElementMatrixProvider &&) noexcept = default;
+  FixedSizeReactionDiffusionElementMatrixProvider &operator=(
+      const FixedSizeReactionDiffusionElementMatrixProvider &) = delete;
+  FixedSizeReactionDiffusionElementMatrixProvider &operator=(
+      FixedSizeReactionDiffusionElementMatrixProvider &&) = delete;
+  /** @} */
+
+  /**
+   * @brief Constructor: cell-independent precomputations
+   *
+   * @param fe_space Lagrangian finite element space
+   * @param alpha mesh function for the (possibly matrix-valued) diffusion
+   * coefficient
+   * @param gamma mesh function providing scalar-valued reaction coefficient
+   */
+  FixedSizeReactionDiffusionElementMatrixProvider(
+      const std::shared_ptr<const FE_SPACE> &fe_space, DIFF_COEFF alpha,
+      REACTION_COEFF gamma)
+      : alpha_(std::move(alpha)),
+        gamma_(std::move(gamma)),
+        pfe_tria_(fe_space->ShapeFunctionLayout(base::RefEl::kTria()),
+                  quad::make_QuadRule(
+                      base::RefEl::kTria(),
+                      2 * fe_space->ShapeFunctionLayout(base::RefEl::kTria())
+                              ->Degree())),
+        pfe_quad_(fe_space->ShapeFunctionLayout(base::RefEl::kQuad()),
+                  quad::make_QuadRule(
+                      base::RefEl::kQuad(),
+                      2 * fe_space->ShapeFunctionLayout(base::RefEl::kQuad())
+                              ->Degree())) {}
+
+  /**
+   * @brief All cells are considered active in the default implementation
+   */
+  virtual bool isActive(const lf::mesh::Entity & /*cell*/) { return true; }
+
+  /**
+   * @brief main routine for the computation of element matrices
+   *
+   * @param cell reference to the (triangular or quadrilateral) cell
+   * @return element matrix of size `kNumTria` x `kNumTria` or `kNumQuad` x
+   * `kNumQuad`
+   */
+  ElemMat Eval(const lf::mesh::Entity &cell) {
+    ElemMat mat;
+    switch (cell.RefEl()) {
+      case lf::base::RefEl::kTria(): {
+        ComputeElemMat(cell, pfe_tria_, mat);
+        break;
+      }
+      case lf::base::RefEl::kQuad(): {
+        ComputeElemMat(cell, pfe_quad_, mat);
+        break;
+      }
+      default: {
+        LF_VERIFY_MSG(false, "Illegal cell type " << cell.RefEl());
+      }
+    }
+    return mat;
+  }
+
+  /** Virtual destructor */
+  virtual ~FixedSizeReactionDiffusionElementMatrixProvider() = default;
+
+ private:
+  /** Element matrix computations with compile-time sizes */
+  template <int NUM_RSF>
+  void ComputeElemMat(
+      const lf::mesh::Entity &cell,
+      const FixedSizePrecomputedScalarReferenceFiniteElement<Scalar, NUM_RSF>
+          &pfe,
+      ElemMat &result);
+
+  /** Diffusion coefficient */
+  DIFF_COEFF alpha_;
+  /** Reaction coefficient */
+  REACTION_COEFF gamma_;
+  /** precomputed reference finite elements for triangles and quadrilaterals */
+  FixedSizePrecomputedScalarReferenceFiniteElement<Scalar, kNumTria> pfe_tria_;
+  FixedSizePrecomputedScalarReferenceFiniteElement<Scalar, kNumQuad> pfe_quad_;
+};
+
+template <class PTR, class DIFF_COEFF, class REACTION_COEFF>
+FixedSizeReactionDiffusionElementMatrixProvider(PTR fe_space, DIFF_COEFF alpha,
+                                                REACTION_COEFF gamma)
+    ->FixedSizeReactionDiffusionElementMatrixProvider<
+        std::remove_const_t<typename PTR::element_type>, DIFF_COEFF,
+        REACTION_COEFF>;
+
+template <class FE_SPACE, typename DIFF_COEFF, typename REACTION_COEFF>
+template <int NUM_RSF>
+void FixedSizeReactionDiffusionElementMatrixProvider<FE_SPACE, DIFF_COEFF,
+                                                     REACTION_COEFF>::
+    ComputeElemMat(
+        const lf::mesh::Entity &cell,
+        const FixedSizePrecomputedScalarReferenceFiniteElement<Scalar, NUM_RSF>
+            &pfe,
+        ElemMat &result) {
+  const lf::geometry::Geometry *geo_ptr = cell.Geometry();
+  LF_ASSERT_MSG(geo_ptr != nullptr, "Invalid geometry!");
+  LF_ASSERT_MSG((geo_ptr->DimLocal() == 2) && (geo_ptr->DimGlobal() == 2),
+                "Only 2D implementation available!");
+  const quad::QuadRule &qr{pfe.Qr()};
+  const Eigen::VectorXd determinants(geo_ptr->IntegrationElement(qr.Points()));
+  const Eigen::MatrixXd JinvT(geo_ptr->JacobianInverseGramian(qr.Points()));
+  // compute values of alpha, gamma at quadrature points:
+  auto alphaval = alpha_(cell, qr.Points());
+  auto gammaval = gamma_(cell, qr.Points());
+
+  Eigen::Matrix<Scalar, NUM_RSF, NUM_RSF> mat;
+  mat.setZero();
+  for (base::size_type k = 0; k < qr.NumPoints(); ++k) {
+    const double w = qr.Weights()[k] * determinants[k];
+    // Transformed gradients, one per column
+    const Eigen::Matrix<Scalar, 2, NUM_RSF> trf_grad(
+        JinvT.template block<2, 2>(0, 2 * k).template cast<Scalar>() *
+        pfe.FixedGradientsReferenceShapeFunctions(k).transpose());
+    const typename FixedSizePrecomputedScalarReferenceFiniteElement<
+        Scalar, NUM_RSF>::ShapeValues &shap{
+        pfe.FixedReferenceShapeFunctions(k)};
+    mat += w * ((alphaval[k] * trf_grad).transpose() * trf_grad +
+                (gammaval[k] * shap) * shap.transpose());
+  }
+  result = mat;
 }
 
 /**
@@ -346,7 +661,7 @@ class MassEdgeMatrixProvider {
 
   /** @name standard constructors
    * @{ */
-  MassEdgeMatrixProvider(const MassEdgeMatrixProvider &) = delete;
+  MassEdgeMatrixProvider(const MassEdgeMatrixProvider &) = default;
   MassEdgeMatrixProvider(MassEdgeMatrixProvider &&) noexcept = default;
   MassEdgeMatrixProvider &operator=(const MassEdgeMatrixProvider &) = delete;
   MassEdgeMatrixProvider &operator=(MassEdgeMatrixProvider &&) = delete;
@@ -710,6 +1025,138 @@ ScalarLoadElementVectorProvider<SCALAR, MESH_FUNCTION>::Eval(
   return vec;
 }
 
+/**
+ * @headerfile lf/uscalfe/uscalfe.h
+ * @brief Local computation of several element (load) vectors for scalar
+ * finite elements at once; volume contributions only
+ *
+ * @tparam SCALAR underlying scalar type, usually double or complex<double>
+ * @tparam MESH_FUNCTION \ref mesh_function "MeshFunction" with values of type
+ * `Eigen::Matrix<SCALAR, K, 1>`; component `j` defines the source function
+ * \f$ f_j \f$
+ *
+ * Computes the element vectors of the local linear forms
+ * @f[
+      v \mapsto \int_K f_j(\mathbf{x})\,v(\mathbf{x})\,\mathrm{d}\mathbf{x}
+ * @f]
+ * for all components \f$ j \f$ of the source function and returns them as the
+ * columns of a matrix. Metric factors, quadrature points and, if the source
+ * functions share them, evaluations of the geometry are computed only once
+ * for all load vectors, and the element vectors are obtained by a single
+ * dense matrix product.
+ *
+ * This class complies with the requirements for the provider argument
+ * of lf::assemble::AssembleMultiVectorLocally().
+ */
+template <typename SCALAR, typename MESH_FUNCTION>
+class ScalarLoadElementMultiVectorProvider {
+  static_assert(mesh::utils::isMeshFunction<MESH_FUNCTION>);
+
+ public:
+  using ElemMat = Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>;
+
+  /** @name standard constructors
+   *@{*/
+  ScalarLoadElementMultiVectorProvider(
+      const ScalarLoadElementMultiVectorProvider &) = delete;
+  ScalarLoadElementMultiVectorProvider(
+      ScalarLoadElementMultiVectorProvider &&) noexcept = default;
+  ScalarLoadElementMultiVectorProvider &operator=(
+      const ScalarLoadElementMultiVectorProvider &) = delete;
+  ScalarLoadElementMultiVectorProvider &operator=(
+      ScalarLoadElementMultiVectorProvider &&) = delete;
+  /**@}*/
+
+  /** @brief Constructor, performs precomputations
+   *
+   * @param fe_space specification of local shape functions
+   * @param f vector-valued mesh function bundling all source functions
+   *
+   * Uses quadrature rule of double the degree of exactness compared to the
+   * degree of the finite element space.
+   */
+  ScalarLoadElementMultiVectorProvider(
+      std::shared_ptr<const UniformScalarFESpace<SCALAR>> fe_space,
+      MESH_FUNCTION f);
+
+  /** @brief Default implement: all cells are active */
+  virtual bool isActive(const lf::mesh::Entity & /*cell*/) { return true; }
+  /**
+   * @brief Main method for computing the element vectors
+   *
+   * @param cell current cell for which the element vectors are desired
+   * @return matrix whose column `j` is the local load vector for the source
+   * function \f$ f_j \f$
+   */
+  ElemMat Eval(const lf::mesh::Entity &cell);
+
+  virtual ~ScalarLoadElementMultiVectorProvider() = default;
+
+ private:
+  /** @brief An object providing the source functions */
+  MESH_FUNCTION f_;
+
+  std::array<PrecomputedScalarReferenceFiniteElement<SCALAR>, 5> fe_precomp_;
+};
+
+// Deduction guide
+template <class PTR, class MESH_FUNCTION>
+ScalarLoadElementMultiVectorProvider(PTR fe_space, MESH_FUNCTION mf)
+    ->ScalarLoadElementMultiVectorProvider<typename PTR::element_type::Scalar,
+                                           MESH_FUNCTION>;
+
+template <typename SCALAR, typename MESH_FUNCTION>
+ScalarLoadElementMultiVectorProvider<SCALAR, MESH_FUNCTION>::
+    ScalarLoadElementMultiVectorProvider(
+        std::shared_ptr<const UniformScalarFESpace<SCALAR>> fe_space,
+        MESH_FUNCTION f)
+    : f_(std::move(f)) {
+  for (auto ref_el : {base::RefEl::kTria(), base::RefEl::kQuad()}) {
+    auto fe = fe_space->ShapeFunctionLayout(ref_el);
+    if (fe != nullptr) {
+      fe_precomp_[ref_el.Id()] =
+          PrecomputedScalarReferenceFiniteElement<SCALAR>(
+              fe, quad::make_QuadRule(ref_el, 2 * fe->Degree()));
+    }
+  }
+}
+
+template <typename SCALAR, typename MESH_FUNCTION>
+typename ScalarLoadElementMultiVectorProvider<SCALAR, MESH_FUNCTION>::ElemMat
+ScalarLoadElementMultiVectorProvider<SCALAR, MESH_FUNCTION>::Eval(
+    const lf::mesh::Entity &cell) {
+  const lf::base::RefEl ref_el{cell.RefEl()};
+  auto &pfe = fe_precomp_[ref_el.Id()];
+  LF_ASSERT_MSG(
+      pfe.isInitialized(),
+      "No local shape function information for entity type " << ref_el);
+  const lf::geometry::Geometry *geo_ptr = cell.Geometry();
+  LF_ASSERT_MSG(geo_ptr != nullptr, "Invalid geometry!");
+  LF_ASSERT_MSG((geo_ptr->DimLocal() == 2),
+                "Only 2D implementation available!");
+
+  // Metric factors and source function values, computed once for all
+  // load vectors
+  const Eigen::VectorXd determinants(
+      geo_ptr->IntegrationElement(pfe.Qr().Points()));
+  const auto fval = f_(cell, pfe.Qr().Points());
+  const Eigen::Index num_qp = determinants.size();
+  LF_ASSERT_MSG(num_qp > 0, "No quadrature points");
+  const Eigen::Index num_vec = fval[0].size();
+  // Weighted source function values, one row per quadrature point
+  ElemMat weighted(num_qp, num_vec);
+  for (Eigen::Index k = 0; k < num_qp; ++k) {
+    LF_ASSERT_MSG(fval[k].size() == num_vec,
+                  "Varying number of source functions");
+    const double w = pfe.Qr().Weights()[k] * determinants[k];
+    for (Eigen::Index j = 0; j < num_vec; ++j) {
+      weighted(k, j) = w * fval[k][j];
+    }
+  }
+  return pfe.PrecompReferenceShapeFunctions().template cast<SCALAR>() *
+         weighted;
+}
+
 /**
  * @ingroup entity_vector_provider
  * @headerfile lf/uscalfe/uscalfe.h
@@ -0,0 +1,279 @@
+/**
+ * @file
+ * @brief Matrix-free application of finite element Galerkin matrices for
+ * second-order scalar elliptic BVPs
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#ifndef __5438cea5dbf44f01933177554ba21590
+#define __5438cea5dbf44f01933177554ba21590
+
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+#include <array>
+#include <vector>
+
+#include "precomputed_scalar_reference_finite_element.h"
+
+namespace lf::uscalfe {
+
+template <typename SCALAR, typename DIFF_COEFF, typename REACTION_COEFF>
+class ReactionDiffusionElementMatrixProvider;
+
+template <typename SCALAR>
+class MatrixFreeOperator;
+
+}  // namespace lf::uscalfe
+
+namespace Eigen::internal {
+// MatrixFreeOperator looks like a sparse matrix to Eigen
+template <typename SCALAR>
+struct traits<lf::uscalfe::MatrixFreeOperator<SCALAR>>
+    : public Eigen::internal::traits<Eigen::SparseMatrix<SCALAR>> {};
+}  // namespace Eigen::internal
+
+namespace lf::uscalfe {
+
+/**
+ * @headerfile lf/uscalfe/uscalfe.h
+ * @brief Galerkin matrix of a second-order scalar elliptic BVP that is never
+ * stored, but only applied to vectors
+ *
+ * @tparam SCALAR scalar type of the matrix
+ *
+ * An object of this type represents the Galerkin matrix that
+ * lf::assemble::AssembleMatrixLocally() would build from a DofHandler and a
+ * ReactionDiffusionElementMatrixProvider. The product @f$\mathbf{y} =
+ * \mathbf{A}\mathbf{x}@f$ is computed by a loop over all active cells:
+ * gather the local coefficients of @f$\mathbf{x}@f$, apply the local operator,
+ * scatter-add the result to @f$\mathbf{y}@f$.
+ *
+ * The constructor caches, for every cell and quadrature point, the factors
+ * returned by ReactionDiffusionElementMatrixProvider::QuadratureFactors().
+ * Hence, neither geometry objects nor coefficient functions are queried when
+ * the operator is applied. Memory consumption is `5*nqp` scalars per cell,
+ * which for low polynomial degrees is less than that of the sparse matrix.
+ *
+ * The class models an Eigen "matrix-free" sparse matrix type, which means that
+ * products `A * x` with dense vectors can be formed and that it can be used
+ * with Eigen's iterative solvers:
+ * ~~~
+ * lf::uscalfe::MatrixFreeOperator<double> A(dofh, elmat_builder);
+ * Eigen::ConjugateGradient<lf::uscalfe::MatrixFreeOperator<double>,
+ *                          Eigen::Lower | Eigen::Upper,
+ *                          Eigen::IdentityPreconditioner>
+ *     cg;
+ * cg.compute(A);
+ * Eigen::VectorXd x = cg.solve(b);
+ * ~~~
+ *
+ * @note The DofHandler passed to the constructor must be alive as long as the
+ * operator is used.
+ */
+template <typename SCALAR>
+class MatrixFreeOperator : public Eigen::EigenBase<MatrixFreeOperator<SCALAR>> {
+ public:
+  /** @name Type information required by Eigen
+   * @{ */
+  using Scalar = SCALAR;
+  using RealScalar = typename Eigen::NumTraits<SCALAR>::Real;
+  using StorageIndex = int;
+  enum {
+    ColsAtCompileTime = Eigen::Dynamic,
+    MaxColsAtCompileTime = Eigen::Dynamic,
+    IsRowMajor = false
+  };
+  /** @} */
+  /** @brief type of vectors the operator acts on */
+  using Vector = Eigen::Matrix<SCALAR, Eigen::Dynamic, 1>;
+
+  MatrixFreeOperator(const MatrixFreeOperator &) = default;
+  MatrixFreeOperator(MatrixFreeOperator &&) noexcept = default;
+  MatrixFreeOperator &operator=(const MatrixFreeOperator &) = delete;
+  MatrixFreeOperator &operator=(MatrixFreeOperator &&) = delete;
+  ~MatrixFreeOperator() = default;
+
+  /**
+   * @brief Set up the operator: precompute and cache cell-dependent factors
+   *
+   * @param dofh local-to-global index map for the finite element space
+   * @param elmat_builder entity matrix provider, whose `isActive()` method
+   * selects the cells taken into account
+   */
+  template <typename DIFF_COEFF, typename REACTION_COEFF>
+  MatrixFreeOperator(const lf::assemble::DofHandler &dofh,
+                     ReactionDiffusionElementMatrixProvider<
+                         SCALAR, DIFF_COEFF, REACTION_COEFF> &elmat_builder);
+
+  /** @brief number of rows = number of global shape functions */
+  [[nodiscard]] Eigen::Index rows() const { return dofh_.NumDofs(); }
+  /** @brief number of columns = number of global shape functions */
+  [[nodiscard]] Eigen::Index cols() const { return dofh_.NumDofs(); }
+
+  /** @brief lazy product with a dense vector, evaluated by Eigen */
+  template <typename RHS>
+  Eigen::Product<MatrixFreeOperator, RHS, Eigen::AliasFreeProduct> operator*(
+      const Eigen::MatrixBase<RHS> &x) const {
+    return Eigen::Product<MatrixFreeOperator, RHS, Eigen::AliasFreeProduct>(
+        *this, x.derived());
+  }
+
+  /**
+   * @brief Update @f$\mathbf{y} \leftarrow \mathbf{y} + s\,\mathbf{A}\mathbf{x}
+   * @f$
+   */
+  void MultiplyAdd(const Eigen::Ref<const Vector> &x, Eigen::Ref<Vector> y,
+                   SCALAR s = SCALAR(1)) const;
+
+  /** @brief Diagonal of the matrix, e.g., for Jacobi preconditioning */
+  [[nodiscard]] Vector Diagonal() const;
+
+  /** @brief number of active cells taken into account */
+  [[nodiscard]] size_type NumCells() const {
+    return static_cast<size_type>(cells_.size());
+  }
+
+ private:
+  /** Shape function data for one type of reference element */
+  struct RefElData {
+    /** Reference gradients, columns `2k` and `2k+1` for quadrature point `k`
+     */
+    Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic> grads;
+    /** Reference shape function values, column `k` for quadrature point `k`
+     */
+    Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic> vals;
+  };
+  /** Cached information about a cell */
+  struct CellData {
+    const lf::mesh::Entity *cell; /**< the cell itself */
+    unsigned int ref_el_id;       /**< index into ref_el_data_ */
+    size_type offset;             /**< offset into react_fac_ */
+  };
+
+  const lf::assemble::DofHandler &dofh_;
+  std::array<RefElData, 5> ref_el_data_;
+  std::vector<CellData> cells_;
+  /** concatenated 2x2 diffusion factors, 4 per quadrature point */
+  std::vector<SCALAR> diff_fac_;
+  /** concatenated reaction factors, 1 per quadrature point */
+  std::vector<SCALAR> react_fac_;
+};
+
+template <typename SCALAR>
+template <typename DIFF_COEFF, typename REACTION_COEFF>
+MatrixFreeOperator<SCALAR>::MatrixFreeOperator(
+    const lf::assemble::DofHandler &dofh,
+    ReactionDiffusionElementMatrixProvider<SCALAR, DIFF_COEFF, REACTION_COEFF>
+        &elmat_builder)
+    : dofh_(dofh) {
+  Eigen::Matrix<SCALAR, 2, Eigen::Dynamic> diff_fac;
+  Eigen::Matrix<SCALAR, Eigen::Dynamic, 1> react_fac;
+  for (const lf::mesh::Entity *cell : dofh.Mesh()->Entities(0)) {
+    if (!elmat_builder.isActive(*cell)) {
+      continue;
+    }
+    const PrecomputedScalarReferenceFiniteElement<SCALAR> &pfe =
+        elmat_builder.QuadratureFactors(*cell, diff_fac, react_fac);
+    LF_ASSERT_MSG(pfe.NumRefShapeFunctions() == dofh.NumLocalDofs(*cell),
+                  "Mismatch of number of local shape functions");
+    const unsigned int id = cell->RefEl().Id();
+    RefElData &red{ref_el_data_[id]};
+    if (red.vals.size() == 0) {
+      red.grads = pfe.PrecompGradientsReferenceShapeFunctions()
+                      .template cast<SCALAR>();
+      red.vals = pfe.PrecompReferenceShapeFunctions().template cast<SCALAR>();
+    }
+    cells_.push_back({cell, id, static_cast<size_type>(react_fac_.size())});
+    diff_fac_.insert(diff_fac_.end(), diff_fac.data(),
+                     diff_fac.data() + diff_fac.size());
+    react_fac_.insert(react_fac_.end(), react_fac.data(),
+                      react_fac.data() + react_fac.size());
+  }
+}
+
+template <typename SCALAR>
+void MatrixFreeOperator<SCALAR>::MultiplyAdd(const Eigen::Ref<const Vector> &x,
+                                             Eigen::Ref<Vector> y,
+                                             SCALAR s) const {
+  LF_ASSERT_MSG((x.size() == cols()) && (y.size() == rows()),
+                "Size mismatch");
+  // Local vectors, reused for all cells
+  Vector x_loc;
+  Vector y_loc;
+  for (const CellData &cd : cells_) {
+    const RefElData &red{ref_el_data_[cd.ref_el_id]};
+    const Eigen::Index nsf = red.vals.rows();
+    const Eigen::Index nqp = red.vals.cols();
+    const nonstd::span<const lf::assemble::gdof_idx_t> dofs{
+        dofh_.GlobalDofIndices(*cd.cell)};
+    // Gather
+    x_loc.resize(nsf);
+    for (Eigen::Index i = 0; i < nsf; ++i) {
+      x_loc[i] = x[dofs[i]];
+    }
+    // Apply local operator
+    y_loc.setZero(nsf);
+    const SCALAR *diff = diff_fac_.data() + 4 * cd.offset;
+    const SCALAR *react = react_fac_.data() + cd.offset;
+    for (Eigen::Index k = 0; k < nqp; ++k) {
+      const auto grads_k{red.grads.block(0, 2 * k, nsf, 2)};
+      const Eigen::Map<const Eigen::Matrix<SCALAR, 2, 2>> diff_k(diff + 4 * k);
+      const Eigen::Matrix<SCALAR, 2, 1> grad_x{grads_k.transpose() * x_loc};
+      y_loc += grads_k * (diff_k * grad_x);
+      const auto vals_k{red.vals.col(k)};
+      y_loc += (react[k] * vals_k.dot(x_loc)) * vals_k;
+    }
+    // Scatter
+    for (Eigen::Index i = 0; i < nsf; ++i) {
+      y[dofs[i]] += s * y_loc[i];
+    }
+  }
+}
+
+template <typename SCALAR>
+typename MatrixFreeOperator<SCALAR>::Vector
+MatrixFreeOperator<SCALAR>::Diagonal() const {
+  Vector diag = Vector::Zero(rows());
+  for (const CellData &cd : cells_) {
+    const RefElData &red{ref_el_data_[cd.ref_el_id]};
+    const Eigen::Index nsf = red.vals.rows();
+    const nonstd::span<const lf::assemble::gdof_idx_t> dofs{
+        dofh_.GlobalDofIndices(*cd.cell)};
+    const SCALAR *diff = diff_fac_.data() + 4 * cd.offset;
+    const SCALAR *react = react_fac_.data() + cd.offset;
+    for (Eigen::Index k = 0; k < red.vals.cols(); ++k) {
+      const Eigen::Map<const Eigen::Matrix<SCALAR, 2, 2>> diff_k(diff + 4 * k);
+      for (Eigen::Index i = 0; i < nsf; ++i) {
+        const Eigen::Matrix<SCALAR, 1, 2> g{red.grads.block(i, 2 * k, 1, 2)};
+        diag[dofs[i]] += (g * diff_k * g.transpose())(0, 0) +
+                         react[k] * red.vals(i, k) * red.vals(i, k);
+      }
+    }
+  }
+  return diag;
+}
+
+}  // namespace lf::uscalfe
+
+namespace Eigen::internal {
+// Evaluation of products of a MatrixFreeOperator with dense vectors
+template <typename SCALAR, typename RHS>
+struct generic_product_impl<lf::uscalfe::MatrixFreeOperator<SCALAR>, RHS,
+                            SparseShape, DenseShape, GemvProduct>
+    : generic_product_impl_base<
+          lf::uscalfe::MatrixFreeOperator<SCALAR>, RHS,
+          generic_product_impl<lf::uscalfe::MatrixFreeOperator<SCALAR>, RHS>> {
+  using Scalar =
+      typename Product<lf::uscalfe::MatrixFreeOperator<SCALAR>, RHS>::Scalar;
+
+  template <typename DEST>
+  static void scaleAndAddTo(DEST &dst,
+                            const lf::uscalfe::MatrixFreeOperator<SCALAR> &lhs,
+                            const RHS &rhs, const Scalar &alpha) {
+    lhs.MultiplyAdd(rhs, dst, alpha);
+  }
+};
+}  // namespace Eigen::internal
+
+#endif  // __5438cea5dbf44f01933177554ba21590
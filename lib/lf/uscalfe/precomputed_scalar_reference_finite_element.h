@@ -13,6 +13,7 @@
 #include <Eigen/src/Core/util/ForwardDeclarations.h>
 #include <lf/quad/quad.h>
 #include <memory>
+#include <vector>
 #include "uniform_scalar_fe_space.h"
 
 namespace lf::uscalfe {
@@ -46,13 +47,13 @@ class PrecomputedScalarReferenceFiniteElement
   PrecomputedScalarReferenceFiniteElement() = default;
 
   PrecomputedScalarReferenceFiniteElement(
-      const PrecomputedScalarReferenceFiniteElement&) = delete;
+      const PrecomputedScalarReferenceFiniteElement&) = default;
 
   PrecomputedScalarReferenceFiniteElement(
       PrecomputedScalarReferenceFiniteElement&&) noexcept = default;
 
   PrecomputedScalarReferenceFiniteElement& operator=(
-      const PrecomputedScalarReferenceFiniteElement&) = delete;
+      const PrecomputedScalarReferenceFiniteElement&) = default;
 
   PrecomputedScalarReferenceFiniteElement& operator=(
       PrecomputedScalarReferenceFiniteElement&&) noexcept = default;
@@ -63,8 +64,9 @@ class PrecomputedScalarReferenceFiniteElement
       : ScalarReferenceFiniteElement<SCALAR>(),
         fe_(std::move(fe)),
         qr_(std::move(qr)),
-        shap_fun_(fe_->EvalReferenceShapeFunctions(qr_.Points())),
-        grad_shape_fun_(fe_->GradientsReferenceShapeFunctions(qr_.Points())) {}
+        shap_fun_(fe_->EvalReferenceShapeFunctions(qr_.Points()).real()),
+        grad_shape_fun_(
+            fe_->GradientsReferenceShapeFunctions(qr_.Points()).real()) {}
 
   /**
    * @brief Tells initialization status of object
@@ -99,12 +101,13 @@ class PrecomputedScalarReferenceFiniteElement
     return fe_->NumRefShapeFunctions(codim, subidx);
   }
 
-  [[nodiscard]] Eigen::MatrixXd EvalReferenceShapeFunctions(
-      const Eigen::MatrixXd& local) const override {
+  [[nodiscard]] Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>
+  EvalReferenceShapeFunctions(const Eigen::MatrixXd& local) const override {
     LF_ASSERT_MSG(fe_ != nullptr, "Not initialized.");
     return fe_->EvalReferenceShapeFunctions(local);
   }
-  [[nodiscard]] Eigen::MatrixXd GradientsReferenceShapeFunctions(
+  [[nodiscard]] Eigen::Matrix<SCALAR, Eigen::Dynamic, Eigen::Dynamic>
+  GradientsReferenceShapeFunctions(
       const Eigen::MatrixXd& local) const override {
     LF_ASSERT_MSG(fe_ != nullptr, "Not initialized.");
     return fe_->GradientsReferenceShapeFunctions(local);
@@ -173,6 +176,88 @@ class PrecomputedScalarReferenceFiniteElement
   Eigen::MatrixXd grad_shape_fun_;
 };
 
+/**
+ * @headerfile lf/uscalfe/uscalfe.h
+ * @brief Variant of PrecomputedScalarReferenceFiniteElement, which knows the
+ * number of reference shape functions at compile time
+ *
+ * @tparam SCALAR The scalar type of the shape functions, e.g. `double`
+ * @tparam NUM_RSF number of reference shape functions
+ *
+ * In addition to the functionality of the base class, the values and
+ * gradients of the reference shape functions at every quadrature point are
+ * available as fixed-size Eigen vectors/matrices. Computations based on them
+ * need no dynamic memory and their loops can be fully unrolled by the
+ * compiler.
+ */
+template <class SCALAR, int NUM_RSF>
+class FixedSizePrecomputedScalarReferenceFiniteElement
+    : public PrecomputedScalarReferenceFiniteElement<SCALAR> {
+ public:
+  /** @brief values of all reference shape functions at one point */
+  using ShapeValues = Eigen::Matrix<SCALAR, NUM_RSF, 1>;
+  /** @brief gradients of all reference shape functions at one point, one
+   * gradient per row */
+  using ShapeGradients = Eigen::Matrix<SCALAR, NUM_RSF, 2>;
+
+  /** @brief number of reference shape functions */
+  static constexpr int kNumRefShapeFunctions = NUM_RSF;
+
+  /**
+   * @brief Default constructor which does not initialize this class at all
+   * (invalid state).
+   */
+  FixedSizePrecomputedScalarReferenceFiniteElement() = default;
+
+  /**
+   * @brief Precomputation of shape function values and gradients
+   *
+   * @param fe description of reference shape functions, must provide exactly
+   * `NUM_RSF` of them
+   * @param qr quadrature rule for the reference element of `fe`
+   */
+  FixedSizePrecomputedScalarReferenceFiniteElement(
+      std::shared_ptr<const ScalarReferenceFiniteElement<SCALAR>> fe,
+      quad::QuadRule qr)
+      : PrecomputedScalarReferenceFiniteElement<SCALAR>(std::move(fe),
+                                                        std::move(qr)) {
+    LF_VERIFY_MSG(this->NumRefShapeFunctions() == NUM_RSF,
+                  "Expected " << NUM_RSF << " reference shape functions, got "
+                              << this->NumRefShapeFunctions());
+    const size_type num_qp = this->Qr().NumPoints();
+    fixed_shap_fun_.resize(num_qp);
+    fixed_grad_shape_fun_.resize(num_qp);
+    for (size_type k = 0; k < num_qp; ++k) {
+      fixed_shap_fun_[k] = this->PrecompReferenceShapeFunctions()
+                               .col(k)
+                               .template cast<SCALAR>();
+      fixed_grad_shape_fun_[k] = this->PrecompGradientsReferenceShapeFunctions()
+                                     .template block<NUM_RSF, 2>(0, 2 * k)
+                                     .template cast<SCALAR>();
+    }
+  }
+
+  /** @brief Values of reference shape functions at quadrature point `k` */
+  [[nodiscard]] const ShapeValues& FixedReferenceShapeFunctions(
+      size_type k) const {
+    LF_ASSERT_MSG(k < fixed_shap_fun_.size(), "Illegal index " << k);
+    return fixed_shap_fun_[k];
+  }
+
+  /** @brief Gradients of reference shape functions at quadrature point `k` */
+  [[nodiscard]] const ShapeGradients& FixedGradientsReferenceShapeFunctions(
+      size_type k) const {
+    LF_ASSERT_MSG(k < fixed_grad_shape_fun_.size(), "Illegal index " << k);
+    return fixed_grad_shape_fun_[k];
+  }
+
+ private:
+  /** shape function values, one entry per quadrature point */
+  std::vector<ShapeValues> fixed_shap_fun_;
+  /** shape function gradients, one entry per quadrature point */
+  std::vector<ShapeGradients> fixed_grad_shape_fun_;
+};
+
 }  // namespace lf::uscalfe
 
 #endif  // __e281cd0ab7fb476e9315a3dda7f45ffe
@@ -129,4 +129,432 @@ TEST(lf_uscalfe, cross_val) {
   }
 }
 
+TEST(lf_uscalfe, parallel_reaction_diffusion_assembly) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  auto fe_space = std::make_shared<FeSpaceLagrangeO2<double>>(mesh_p);
+  const lf::assemble::DofHandler &dofh{fe_space->LocGlobMap()};
+  const lf::assemble::size_type N_dofs(dofh.NumDofs());
+
+  auto alpha = mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> double { return 1.0 + x[0] * x[1]; });
+  auto gamma = mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> double { return x[0] - x[1]; });
+  ReactionDiffusionElementMatrixProvider elmat_builder(fe_space, alpha, gamma);
+
+  // Serial reference assembly
+  lf::assemble::COOMatrix<double> A_serial(N_dofs, N_dofs);
+  lf::assemble::AssembleMatrixLocally(0, dofh, dofh, elmat_builder, A_serial);
+  // Multithreaded assembly relying on copies of the provider
+  lf::assemble::COOMatrix<double> A_parallel(N_dofs, N_dofs);
+  lf::assemble::ParallelAssembleMatrixLocally(0, dofh, dofh, elmat_builder,
+                                              A_parallel, 4);
+  EXPECT_EQ(A_serial.triplets().size(), A_parallel.triplets().size());
+  EXPECT_NEAR((A_serial.makeDense() - A_parallel.makeDense()).norm(), 0.0,
+              1.0E-12);
+}
+
+TEST(lf_uscalfe, eval_batch) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  auto fe_space = std::make_shared<FeSpaceLagrangeO2<double>>(mesh_p);
+  auto alpha = mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> double { return 1.0 + x[0] * x[1]; });
+  auto gamma = mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> double { return x[0] - x[1]; });
+  ReactionDiffusionElementMatrixProvider rd_builder(fe_space, alpha, gamma);
+  LinearFELaplaceElementMatrix lin_builder;
+  static_assert(
+      lf::assemble::isBatchEntityMatrixProvider<decltype(rd_builder)>);
+  static_assert(
+      lf::assemble::isBatchEntityMatrixProvider<decltype(lin_builder)>);
+
+  // Batches of cells of the same type, buffers reused across batches
+  std::vector<decltype(rd_builder)::ElemMat> rd_mats;
+  std::vector<LinearFELaplaceElementMatrix::ElemMat> lin_mats;
+  for (auto ref_el : {lf::base::RefEl::kTria(), lf::base::RefEl::kQuad()}) {
+    std::vector<const lf::mesh::Entity *> cells;
+    for (const lf::mesh::Entity *cell : mesh_p->Entities(0)) {
+      if (cell->RefEl() == ref_el) {
+        cells.push_back(cell);
+      }
+    }
+    rd_builder.EvalBatch(cells, rd_mats);
+    lin_builder.EvalBatch(cells, lin_mats);
+    for (std::size_t k = 0; k < cells.size(); ++k) {
+      EXPECT_NEAR((rd_mats[k] - rd_builder.Eval(*cells[k])).norm(), 0.0,
+                  1.0E-12);
+      EXPECT_NEAR((lin_mats[k] - lin_builder.Eval(*cells[k])).norm(), 0.0,
+                  1.0E-12)
+          << "cell " << mesh_p->Index(*cells[k]);
+    }
+  }
+
+  // Batched assembly agrees with cell-by-cell assembly through Eval()
+  struct NoBatch {
+    LinearFELaplaceElementMatrix &builder;
+    bool isActive(const lf::mesh::Entity &cell) {
+      return builder.isActive(cell);
+    }
+    LinearFELaplaceElementMatrix::ElemMat Eval(const lf::mesh::Entity &cell) {
+      return builder.Eval(cell);
+    }
+  } no_batch{lin_builder};
+  static_assert(!lf::assemble::isBatchEntityMatrixProvider<NoBatch>);
+  lf::assemble::UniformFEDofHandler dofh(mesh_p,
+                                         {{lf::base::RefEl::kPoint(), 1}});
+  const auto A_batch{lf::assemble::AssembleMatrixLocally<
+      lf::assemble::COOMatrix<double>>(0, dofh, dofh, lin_builder)};
+  const auto A_cell{lf::assemble::AssembleMatrixLocally<
+      lf::assemble::COOMatrix<double>>(0, dofh, dofh, no_batch)};
+  ASSERT_EQ(A_batch.triplets().size(), A_cell.triplets().size());
+  EXPECT_NEAR((A_batch.makeDense() - A_cell.makeDense()).norm(), 0.0,
+              1.0E-12);
+
+  // Both variants print the same debugging output
+  auto debug_output = [&](auto &provider) -> std::string {
+    lf::assemble::COOMatrix<double> A(dofh.NumDofs(), dofh.NumDofs());
+    testing::internal::CaptureStdout();
+    lf::assemble::AssembleMatrixLocally(0, dofh, dofh, provider, A);
+    return testing::internal::GetCapturedStdout();
+  };
+  const unsigned int dbg_ctrl = lf::assemble::ass_mat_dbg_ctrl;
+  lf::assemble::ass_mat_dbg_ctrl = 31;
+  const std::string out_batch = debug_output(lin_builder);
+  const std::string out_cell = debug_output(no_batch);
+  lf::assemble::ass_mat_dbg_ctrl = dbg_ctrl;
+  EXPECT_FALSE(out_cell.empty());
+  EXPECT_EQ(out_batch, out_cell);
+}
+
+TEST(lf_uscalfe, simd_tria_kernel) {
+  // 29 triangles: full registers and a remainder for every SIMD level
+  const std::size_t n = 29;
+  std::vector<double> xy(6 * n);
+  for (std::size_t k = 0; k < n; ++k) {
+    for (std::size_t v = 0; v < 3; ++v) {
+      xy[v * n + k] = std::cos(1.0 + k + 2.1 * v) + 0.1 * k;
+      xy[(3 + v) * n + k] = std::sin(0.3 * k + 2.1 * v);
+    }
+  }
+  std::vector<double> lapl_ref(6 * n);
+  std::vector<double> area_ref(n);
+  LinearFETriaKernel(SimdLevel::kScalar, n, xy.data(), lapl_ref.data(),
+                     area_ref.data());
+  // Compare scalar kernel with cell-oriented computation
+  for (std::size_t k = 0; k < n; ++k) {
+    Eigen::Matrix<double, 2, 3> vertices;
+    for (int v = 0; v < 3; ++v) {
+      vertices(0, v) = xy[v * n + k];
+      vertices(1, v) = xy[(3 + v) * n + k];
+    }
+    const lf::geometry::TriaO1 geo(vertices);
+    const double area = lf::geometry::Volume(geo);
+    EXPECT_NEAR(area_ref[k], area, 1.0E-12);
+    Eigen::Matrix<double, 3, 2> grad;
+    grad << -1.0, -1.0, 1.0, 0.0, 0.0, 1.0;
+    const Eigen::Matrix2d jig{
+        geo.JacobianInverseGramian(Eigen::Vector2d::Zero())};
+    grad = grad * jig.transpose();
+    const Eigen::Matrix3d A = area * grad * grad.transpose();
+    const std::array<double, 6> a{A(0, 0), A(0, 1), A(0, 2),
+                                  A(1, 1), A(1, 2), A(2, 2)};
+    for (std::size_t j = 0; j < 6; ++j) {
+      EXPECT_NEAR(lapl_ref[j * n + k], a[j], 1.0E-10);
+    }
+  }
+  // All instruction sets available on this CPU yield the same result
+  for (const SimdLevel level : {SimdLevel::kAVX2, SimdLevel::kAVX512}) {
+    if (static_cast<int>(level) > static_cast<int>(DetectSimdLevel())) {
+      continue;
+    }
+    std::vector<double> lapl(6 * n);
+    std::vector<double> area(n);
+    LinearFETriaKernel(level, n, xy.data(), lapl.data(), area.data());
+    for (std::size_t k = 0; k < 6 * n; ++k) {
+      EXPECT_NEAR(lapl[k], lapl_ref[k], 1.0E-12 * std::abs(lapl_ref[k]))
+          << level << ", entry " << k;
+    }
+    for (std::size_t k = 0; k < n; ++k) {
+      EXPECT_NEAR(area[k], area_ref[k], 1.0E-14) << level;
+    }
+  }
+}
+
+template <class FE_SPACE>
+void CheckFixedSizeProvider() {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  auto fe_space = std::make_shared<FE_SPACE>(mesh_p);
+  auto alpha = mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> Eigen::Matrix2d {
+        return (Eigen::Matrix2d() << 2.0, x[0], x[0], 1.0 + x[1] * x[1])
+            .finished();
+      });
+  auto gamma = mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> double { return x[0] - x[1]; });
+  ReactionDiffusionElementMatrixProvider dyn_builder(fe_space, alpha, gamma);
+  FixedSizeReactionDiffusionElementMatrixProvider fix_builder(fe_space, alpha,
+                                                              gamma);
+  for (const lf::mesh::Entity *cell : mesh_p->Entities(0)) {
+    const auto dyn_mat{dyn_builder.Eval(*cell)};
+    const auto fix_mat{fix_builder.Eval(*cell)};
+    ASSERT_EQ(dyn_mat.rows(), fix_mat.rows());
+    ASSERT_EQ(dyn_mat.cols(), fix_mat.cols());
+    EXPECT_NEAR((dyn_mat - fix_mat).norm(), 0.0, 1.0E-12 * dyn_mat.norm());
+  }
+}
+
+TEST(lf_uscalfe, fixed_size_reaction_diffusion) {
+  CheckFixedSizeProvider<FeSpaceLagrangeO1<double>>();
+  CheckFixedSizeProvider<FeSpaceLagrangeO2<double>>();
+  CheckFixedSizeProvider<FeSpaceLagrangeO3<double>>();
+}
+
+template <class MESH_BUILDER>
+void CheckCachedProvider(unsigned int num_cells_1d) {
+  auto mesh_factory = std::make_unique<lf::mesh::hybrid2d::MeshFactory>(2);
+  MESH_BUILDER builder(std::move(mesh_factory));
+  builder.setBottomLeftCorner(Eigen::Vector2d{0.0, 0.0})
+      .setTopRightCorner(Eigen::Vector2d{1.0, 1.0})
+      .setNumXCells(num_cells_1d)
+      .setNumYCells(num_cells_1d);
+  std::shared_ptr<const lf::mesh::Mesh> mesh_p = builder.Build();
+  auto fe_space = std::make_shared<FeSpaceLagrangeO2<double>>(mesh_p);
+  const lf::assemble::DofHandler &dofh{fe_space->LocGlobMap()};
+
+  // Diffusion coefficient constant on the cells of the two halves of the
+  // square, constant reaction coefficient
+  auto alpha = mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> double { return (x[0] < 0.5) ? 1.0 : 3.0; });
+  auto gamma = mesh::utils::MeshFunctionConstant(2.0);
+  ReactionDiffusionElementMatrixProvider elmat_builder(fe_space, alpha, gamma);
+  auto coeff_key = [&alpha](const lf::mesh::Entity &cell) {
+    const double c =
+        (cell.RefEl() == lf::base::RefEl::kTria()) ? 1.0 / 3.0 : 0.5;
+    return alpha(cell, Eigen::MatrixXd::Constant(2, 1, c));
+  };
+  lf::assemble::CachedEntityMatrixProvider cached_builder(elmat_builder,
+                                                          coeff_key);
+
+  const auto A_ref{lf::assemble::AssembleMatrixLocally<
+      lf::assemble::COOMatrix<double>>(0, dofh, dofh, elmat_builder)};
+  const auto A_cached{lf::assemble::AssembleMatrixLocally<
+      lf::assemble::COOMatrix<double>>(0, dofh, dofh, cached_builder)};
+  EXPECT_NEAR((A_ref.makeDense() - A_cached.makeDense()).norm(), 0.0,
+              1.0E-10 * A_ref.makeDense().norm());
+  EXPECT_EQ(cached_builder.Hits() + cached_builder.Misses(),
+            mesh_p->NumEntities(0));
+  EXPECT_EQ(cached_builder.Bypassed(), 0);
+  EXPECT_EQ(cached_builder.Misses(), cached_builder.CacheSize());
+  EXPECT_GT(cached_builder.Hits(), 4 * cached_builder.Misses());
+}
+
+TEST(lf_uscalfe, cached_element_matrices) {
+  CheckCachedProvider<lf::mesh::hybrid2d::TPTriagMeshBuilder>(10);
+  CheckCachedProvider<lf::mesh::hybrid2d::TPQuadMeshBuilder>(10);
+}
+
+TEST(lf_uscalfe, cached_element_matrices_curved) {
+  // Two second-order triangles with the same vertex positions up to a
+  // translation. The edge of the second one opposite to its first vertex is
+  // curved, which leaves the Jacobian at that vertex unchanged. Still, the two
+  // cells must not share an element matrix.
+  auto mesh_factory = std::make_unique<lf::mesh::hybrid2d::MeshFactory>(2);
+  const std::array<Eigen::Vector2d, 5> node_coords{
+      Eigen::Vector2d{0.0, 0.0}, Eigen::Vector2d{1.0, 0.0},
+      Eigen::Vector2d{0.0, 1.0}, Eigen::Vector2d{2.0, 0.0},
+      Eigen::Vector2d{1.0, 1.0}};
+  for (const auto &coord : node_coords) {
+    mesh_factory->AddPoint(coord);
+  }
+  Eigen::Matrix<double, 2, 6> straight;
+  straight << 0.0, 1.0, 0.0, 0.5, 0.5, 0.0, 0.0, 0.0, 1.0, 0.0, 0.5, 0.5;
+  Eigen::Matrix<double, 2, 6> curved = straight;
+  curved.row(0).array() += 1.0;
+  curved.col(4).array() += 0.1;
+  const std::array<lf::mesh::Mesh::size_type, 3> tria0{0, 1, 2};
+  const std::array<lf::mesh::Mesh::size_type, 3> tria1{1, 3, 4};
+  mesh_factory->AddEntity(lf::base::RefEl::kTria(), tria0,
+                          std::make_unique<lf::geometry::TriaO2>(straight));
+  mesh_factory->AddEntity(lf::base::RefEl::kTria(), tria1,
+                          std::make_unique<lf::geometry::TriaO2>(curved));
+  std::shared_ptr<const lf::mesh::Mesh> mesh_p = mesh_factory->Build();
+
+  auto fe_space = std::make_shared<FeSpaceLagrangeO2<double>>(mesh_p);
+  const lf::assemble::DofHandler &dofh{fe_space->LocGlobMap()};
+  auto alpha = mesh::utils::MeshFunctionConstant(1.0);
+  auto gamma = mesh::utils::MeshFunctionConstant(2.0);
+  ReactionDiffusionElementMatrixProvider elmat_builder(fe_space, alpha, gamma);
+  lf::assemble::CachedEntityMatrixProvider cached_builder(elmat_builder);
+
+  const auto A_ref{lf::assemble::AssembleMatrixLocally<
+      lf::assemble::COOMatrix<double>>(0, dofh, dofh, elmat_builder)};
+  const auto A_cached{lf::assemble::AssembleMatrixLocally<
+      lf::assemble::COOMatrix<double>>(0, dofh, dofh, cached_builder)};
+  EXPECT_NEAR((A_ref.makeDense() - A_cached.makeDense()).norm(), 0.0,
+              1.0E-10 * A_ref.makeDense().norm());
+  EXPECT_EQ(cached_builder.Bypassed(), mesh_p->NumEntities(0));
+  EXPECT_EQ(cached_builder.Hits(), 0U);
+}
+
+template <class FE_SPACE>
+void CheckStaticCondensation() {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  auto fe_space = std::make_shared<FE_SPACE>(mesh_p);
+  const lf::assemble::DofHandler &dofh{fe_space->LocGlobMap()};
+  const lf::assemble::size_type N_dofs(dofh.NumDofs());
+
+  auto alpha = mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> double { return 1.0 + x[0] * x[1]; });
+  auto gamma = mesh::utils::MeshFunctionConstant(1.0);
+  auto f = mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> double { return x[0] - 2.0 * x[1]; });
+  ReactionDiffusionElementMatrixProvider elmat_builder(fe_space, alpha, gamma);
+  ScalarLoadElementVectorProvider elvec_builder(fe_space, f);
+
+  // Reference: solution of the full system
+  const auto A{lf::assemble::AssembleMatrixLocally<
+      lf::assemble::COOMatrix<double>>(0, dofh, dofh, elmat_builder)};
+  const auto phi{lf::assemble::AssembleVectorLocally<Eigen::VectorXd>(
+      0, dofh, elvec_builder)};
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> solver(A.makeSparse());
+  const Eigen::VectorXd sol = solver.solve(phi);
+
+  // Condensed system
+  lf::assemble::StaticCondensation<double> condensation(dofh);
+  const lf::assemble::size_type N_skel = condensation.NumSkeletonDofs();
+  lf::assemble::size_type num_interior = 0;
+  for (const lf::mesh::Entity *cell : mesh_p->Entities(0)) {
+    num_interior += dofh.NumInteriorDofs(*cell);
+  }
+  EXPECT_EQ(N_skel + num_interior, N_dofs);
+  lf::assemble::COOMatrix<double> A_skel(N_skel, N_skel);
+  Eigen::VectorXd phi_skel = Eigen::VectorXd::Zero(N_skel);
+  condensation.AssembleSkeleton(elmat_builder, elvec_builder, A_skel,
+                                phi_skel);
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> skel_solver(A_skel.makeSparse());
+  const Eigen::VectorXd sol_skel = skel_solver.solve(phi_skel);
+  const Eigen::VectorXd sol_cond = condensation.Reconstruct(sol_skel, 2);
+  EXPECT_NEAR((sol - sol_cond).norm(), 0.0, 1.0E-10 * sol.norm());
+}
+
+TEST(lf_uscalfe, static_condensation) {
+  CheckStaticCondensation<FeSpaceLagrangeO2<double>>();
+  CheckStaticCondensation<FeSpaceLagrangeO3<double>>();
+}
+
+// Element matrix provider switched off on one cell
+template <class ELMAT_BUILDER>
+class SkipCellProvider {
+ public:
+  SkipCellProvider(ELMAT_BUILDER &builder, const lf::mesh::Entity &skip)
+      : builder_(builder), skip_(&skip) {}
+  [[nodiscard]] bool isActive(const lf::mesh::Entity &cell) const {
+    return (&cell != skip_) && builder_.isActive(cell);
+  }
+  auto Eval(const lf::mesh::Entity &cell) { return builder_.Eval(cell); }
+
+ private:
+  ELMAT_BUILDER &builder_;
+  const lf::mesh::Entity *skip_;
+};
+
+TEST(lf_uscalfe, static_condensation_inactive_matrix_provider) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  auto fe_space = std::make_shared<FeSpaceLagrangeO1<double>>(mesh_p);
+  const lf::assemble::DofHandler &dofh{fe_space->LocGlobMap()};
+  auto alpha = mesh::utils::MeshFunctionConstant(1.0);
+  auto gamma = mesh::utils::MeshFunctionConstant(1.0);
+  auto f = mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> double { return 1.0 + x[0]; });
+  ReactionDiffusionElementMatrixProvider elmat_builder(fe_space, alpha, gamma);
+  SkipCellProvider skip_builder(elmat_builder, *mesh_p->EntityByIndex(0, 0));
+  ScalarLoadElementVectorProvider elvec_builder(fe_space, f);
+
+  // The load on the cell without element matrix must not get lost
+  const auto phi{lf::assemble::AssembleVectorLocally<Eigen::VectorXd>(
+      0, dofh, elvec_builder)};
+  const auto A{lf::assemble::AssembleMatrixLocally<
+      lf::assemble::COOMatrix<double>>(0, dofh, dofh, skip_builder)};
+  lf::assemble::StaticCondensation<double> condensation(dofh);
+  const lf::assemble::size_type N_skel = condensation.NumSkeletonDofs();
+  ASSERT_EQ(N_skel, dofh.NumDofs());
+  lf::assemble::COOMatrix<double> A_skel(N_skel, N_skel);
+  Eigen::VectorXd phi_skel = Eigen::VectorXd::Zero(N_skel);
+  condensation.AssembleSkeleton(skip_builder, elvec_builder, A_skel,
+                                phi_skel);
+  const Eigen::MatrixXd A_dense = A.makeDense();
+  const Eigen::MatrixXd A_skel_dense = A_skel.makeDense();
+  for (lf::assemble::gdof_idx_t i = 0; i < dofh.NumDofs(); ++i) {
+    const lf::assemble::gdof_idx_t si = condensation.SkeletonIndex(i);
+    EXPECT_NEAR(phi_skel[si], phi[i], 1.0E-12);
+    for (lf::assemble::gdof_idx_t j = 0; j < dofh.NumDofs(); ++j) {
+      EXPECT_NEAR(A_skel_dense(si, condensation.SkeletonIndex(j)),
+                  A_dense(i, j), 1.0E-12);
+    }
+  }
+}
+
+TEST(lf_uscalfe, multi_load_vector) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  auto fe_space = std::make_shared<FeSpaceLagrangeO2<double>>(mesh_p);
+  const lf::assemble::DofHandler &dofh{fe_space->LocGlobMap()};
+  const int k = 5;
+  // Family of source functions depending on a parameter
+  auto f_j = [](int j, const Eigen::Vector2d &x) -> double {
+    return std::sin(j * x[0]) + j * x[1] * x[1];
+  };
+  auto f_all = mesh::utils::MeshFunctionGlobal(
+      [&f_j](const Eigen::Vector2d &x) -> Eigen::Matrix<double, k, 1> {
+        Eigen::Matrix<double, k, 1> val;
+        for (int j = 0; j < k; ++j) {
+          val[j] = f_j(j, x);
+        }
+        return val;
+      });
+  ScalarLoadElementMultiVectorProvider multi_elvec_builder(fe_space, f_all);
+  const Eigen::MatrixXd phi =
+      lf::assemble::AssembleMultiVectorLocally<Eigen::MatrixXd>(
+          0, dofh, k, multi_elvec_builder);
+  ASSERT_EQ(phi.rows(), dofh.NumDofs());
+  ASSERT_EQ(phi.cols(), k);
+  for (int j = 0; j < k; ++j) {
+    auto f = mesh::utils::MeshFunctionGlobal(
+        [&f_j, j](const Eigen::Vector2d &x) -> double { return f_j(j, x); });
+    ScalarLoadElementVectorProvider elvec_builder(fe_space, f);
+    const Eigen::VectorXd phi_j =
+        lf::assemble::AssembleVectorLocally<Eigen::VectorXd>(0, dofh,
+                                                             elvec_builder);
+    EXPECT_NEAR((phi.col(j) - phi_j).norm(), 0.0, 1.0E-12);
+  }
+}
+
+TEST(lf_uscalfe, multi_load_vector_complex) {
+  using scalar_t = std::complex<double>;
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  auto fe_space = std::make_shared<FeSpaceLagrangeO2<scalar_t>>(mesh_p);
+  const lf::assemble::DofHandler &dofh{fe_space->LocGlobMap()};
+  // Two complex source functions
+  auto f_all = mesh::utils::MeshFunctionGlobal(
+      [](const Eigen::Vector2d &x) -> Eigen::Matrix<scalar_t, 2, 1> {
+        return {scalar_t(x[0], x[1]), scalar_t(1.0, -x[0] * x[1])};
+      });
+  ScalarLoadElementMultiVectorProvider multi_elvec_builder(fe_space, f_all);
+  const Eigen::MatrixXcd phi =
+      lf::assemble::AssembleMultiVectorLocally<Eigen::MatrixXcd>(
+          0, dofh, 2, multi_elvec_builder);
+  ASSERT_EQ(phi.rows(), dofh.NumDofs());
+  ASSERT_EQ(phi.cols(), 2);
+  for (int j = 0; j < 2; ++j) {
+    auto f = mesh::utils::MeshFunctionGlobal(
+        [j](const Eigen::Vector2d &x) -> scalar_t {
+          return (j == 0) ? scalar_t(x[0], x[1])
+                          : scalar_t(1.0, -x[0] * x[1]);
+        });
+    ScalarLoadElementVectorProvider elvec_builder(fe_space, f);
+    const Eigen::VectorXcd phi_j =
+        lf::assemble::AssembleVectorLocally<Eigen::VectorXcd>(0, dofh,
+                                                              elvec_builder);
+    EXPECT_NEAR((phi.col(j) - phi_j).norm(), 0.0, 1.0E-12);
+  }
+}
+
 }  // namespace lf::uscalfe::test
@@ -0,0 +1,80 @@
+/**
+ * @file
+ * @brief Tests for the matrix-free application of Galerkin matrices
+ * @date   October 2026
+ * @copyright MIT License
+ */
+
+#include <gtest/gtest.h>
+#include <lf/mesh/test_utils/test_meshes.h>
+#include <lf/uscalfe/uscalfe.h>
+
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseLU>
+
+namespace lf::uscalfe::test {
+
+TEST(lf_uscalfe, matrix_free_product) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  auto fe_space = std::make_shared<FeSpaceLagrangeO2<double>>(mesh_p);
+  const lf::assemble::DofHandler &dofh{fe_space->LocGlobMap()};
+  // Non-symmetric matrix-valued diffusion coefficient
+  auto alpha = mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> Eigen::Matrix2d {
+        return (Eigen::Matrix2d() << 2.0, x[0], -x[1], 1.0).finished();
+      });
+  auto gamma = mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> double { return 1.0 + x[0]; });
+  ReactionDiffusionElementMatrixProvider elmat_builder(fe_space, alpha, gamma);
+
+  const Eigen::SparseMatrix<double> A{
+      lf::assemble::AssembleMatrixLocally<lf::assemble::COOMatrix<double>>(
+          0, dofh, dofh, elmat_builder)
+          .makeSparse()};
+  const MatrixFreeOperator<double> A_mf(dofh, elmat_builder);
+  EXPECT_EQ(A_mf.NumCells(), mesh_p->NumEntities(0));
+  EXPECT_EQ(A_mf.rows(), A.rows());
+
+  const Eigen::VectorXd x{Eigen::VectorXd::LinSpaced(A.cols(), -1.0, 2.0)};
+  const Eigen::VectorXd y{A_mf * x};
+  EXPECT_NEAR((y - A * x).norm(), 0.0, 1.0E-12 * (A * x).norm());
+  // Accumulating product with a scaling factor
+  Eigen::VectorXd z{Eigen::VectorXd::Ones(A.rows())};
+  z.noalias() += 2.0 * (A_mf * x);
+  EXPECT_NEAR((z - Eigen::VectorXd::Ones(A.rows()) - 2.0 * A * x).norm(), 0.0,
+              1.0E-12 * z.norm());
+  EXPECT_NEAR((A_mf.Diagonal() - Eigen::VectorXd(A.diagonal())).norm(), 0.0,
+              1.0E-12 * A.diagonal().norm());
+}
+
+TEST(lf_uscalfe, matrix_free_cg) {
+  auto mesh_p = lf::mesh::test_utils::GenerateHybrid2DTestMesh();
+  auto fe_space = std::make_shared<FeSpaceLagrangeO1<double>>(mesh_p);
+  const lf::assemble::DofHandler &dofh{fe_space->LocGlobMap()};
+  auto alpha = mesh::utils::MeshFunctionGlobal(
+      [](Eigen::Vector2d x) -> double { return 1.0 + x[0] * x[0]; });
+  auto gamma = mesh::utils::MeshFunctionConstant(1.0);
+  ReactionDiffusionElementMatrixProvider elmat_builder(fe_space, alpha, gamma);
+
+  const Eigen::SparseMatrix<double> A{
+      lf::assemble::AssembleMatrixLocally<lf::assemble::COOMatrix<double>>(
+          0, dofh, dofh, elmat_builder)
+          .makeSparse()};
+  const Eigen::VectorXd b{Eigen::VectorXd::LinSpaced(A.rows(), 1.0, 3.0)};
+  Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
+  solver.compute(A);
+  const Eigen::VectorXd x_ref{solver.solve(b)};
+
+  const MatrixFreeOperator<double> A_mf(dofh, elmat_builder);
+  Eigen::ConjugateGradient<MatrixFreeOperator<double>,
+                           Eigen::Lower | Eigen::Upper,
+                           Eigen::IdentityPreconditioner>
+      cg;
+  cg.setTolerance(1.0E-13);
+  cg.compute(A_mf);
+  const Eigen::VectorXd x{cg.solve(b)};
+  EXPECT_EQ(cg.info(), Eigen::Success);
+  EXPECT_NEAR((x - x_ref).norm(), 0.0, 1.0E-10 * x_ref.norm());
+}
+
+}  // namespace lf::uscalfe::test
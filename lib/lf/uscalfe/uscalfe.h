@@ -20,8 +20,10 @@
 #include "fe_space_lagrange_o3.h"
 #include "fe_tools.h"
 #include "lin_fe.h"
+#include "lin_fe_simd.h"
 #include "loc_comp_ellbvp.h"
 #include "loc_comp_norms.h"
+#include "matrix_free_operator.h"
 #include "mesh_function_fe.h"
 #include "mesh_function_grad_fe.h"
 #include "uniform_scalar_fe_space.h"